@@ -315,6 +315,40 @@ extern "C" {
  */
 #define SDL_HINT_AUTO_UPDATE_SENSORS    "SDL_AUTO_UPDATE_SENSORS"
 
+/**
+ *  \brief  A variable controlling whether SDL collects statistics about the software blitters
+ *
+ *  When enabled, SDL counts the calls, pixels and time spent in each blit
+ *  function selected by SDL_BlitSurface() and friends, per source format,
+ *  destination format and blit flags.  RLE accelerated blits are not counted.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Statistics are not collected (default)
+ *    "1"       - Statistics are collected
+ *
+ *  The statistics are logged with SDL_Log() and reset whenever this hint is
+ *  set back to "0", and at SDL_Quit().
+ *
+ *  This hint can be toggled on and off at runtime, once SDL_Init() has been called.
+ */
+#define SDL_HINT_BLIT_STATS "SDL_BLIT_STATS"
+
+/**
+ *  \brief  A variable controlling whether BMP files can be loaded without copying the pixels.
+ *
+ *  32-bit top-down BMP files with aligned pixel data that are read from a file
+ *  can be loaded as a surface that uses a private mapping of the file for its
+ *  pixels, instead of reading them into memory. Writing to the surface doesn't
+ *  change the file, but the file must not be changed or truncated while the
+ *  surface is in use. Depending on the platform, truncating it may crash the
+ *  application.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Always copy the pixels into memory (default)
+ *    "1"       - Use a mapping of the file when possible
+ */
+#define SDL_HINT_BMP_LOAD_MAPPED "SDL_BMP_LOAD_MAPPED"
+
 /**
  *  \brief Prevent SDL from using version 4 of the bitmap header when saving BMPs.
  *
@@ -334,6 +368,37 @@ extern "C" {
  */
 #define SDL_HINT_BMP_SAVE_LEGACY_FORMAT "SDL_BMP_SAVE_LEGACY_FORMAT"
 
+/**
+ *  \brief  A variable controlling how many threads SDL_ConvertPixels() and SDL_ConvertSurface() use
+ *
+ *  Large conversions can be split into bands of rows that are converted in
+ *  parallel on a pool of threads shared with the rest of SDL.  This covers
+ *  RGB to RGB conversions, and conversions between RGB and YUV formats.
+ *
+ *  This variable can be set to the following values:
+ *    "1"       - Conversions run on the calling thread (default)
+ *    "0"       - Conversions use one thread per CPU core
+ *    "N"       - Conversions use up to N threads, including the calling one
+ *
+ *  Only images with at least SDL_HINT_CONVERT_THREADS_MIN_PIXELS pixels are split.
+ *
+ *  This hint can be changed at any time.
+ */
+#define SDL_HINT_CONVERT_THREADS "SDL_CONVERT_THREADS"
+
+/**
+ *  \brief  A variable setting the smallest image SDL_HINT_CONVERT_THREADS applies to
+ *
+ *  This is a number of pixels, width times height.  Smaller conversions
+ *  always run on the calling thread, since starting the other threads would
+ *  cost more than it saves.
+ *
+ *  The default is "1048576", the size of a 1024x1024 image.
+ *
+ *  This hint can be changed at any time.
+ */
+#define SDL_HINT_CONVERT_THREADS_MIN_PIXELS "SDL_CONVERT_THREADS_MIN_PIXELS"
+
 /**
  *  \brief Override for SDL_GetDisplayUsableBounds()
  *
@@ -1503,6 +1568,53 @@ extern "C" {
  */
 #define SDL_HINT_SCREENSAVER_INHIBIT_ACTIVITY_NAME "SDL_SCREENSAVER_INHIBIT_ACTIVITY_NAME"
 
+/**
+ *  \brief  A variable controlling whether the rows of new surfaces are SIMD aligned.
+ *
+ *  When enabled, the pitch of surfaces created by SDL is a multiple of
+ *  SDL_SIMDGetAlignment(), so every row starts on a SIMD boundary. This can
+ *  waste memory for narrow surfaces, and applications that assume the pitch
+ *  of a new surface is its width in bytes rounded up to 4 will break.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Pad rows to a multiple of 4 bytes (default)
+ *    "1"       - Pad rows to a multiple of the SIMD alignment
+ */
+#define SDL_HINT_SURFACE_ALIGNED_PITCH "SDL_SURFACE_ALIGNED_PITCH"
+
+/**
+ *  \brief  A variable controlling whether copies of a surface share its pixels.
+ *
+ *  When enabled, SDL_DuplicateSurface() and SDL_ConvertSurface() to the same
+ *  pixel format don't copy the pixels. The surfaces share them until one of
+ *  them is locked or drawn to with SDL functions, and only then does that
+ *  surface get its own copy. This saves memory and time for copies that only
+ *  get a different color key, color modulation or blend mode.
+ *
+ *  An application that enables this must call SDL_LockSurface() before
+ *  writing to the pixels of a surface itself, even if SDL_MUSTLOCK() is false.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Surface copies always copy the pixels (default)
+ *    "1"       - Surface copies share the pixels until they are written
+ */
+#define SDL_HINT_SURFACE_COPY_ON_WRITE "SDL_SURFACE_COPY_ON_WRITE"
+
+/**
+ *  \brief  A variable setting how many bytes of freed surface pixels SDL keeps for reuse.
+ *
+ *  Surfaces that are created and freed in a loop, like conversion scratch
+ *  surfaces and render targets, can reuse the pixels of freed surfaces of a
+ *  similar size instead of getting new memory from the system every time.
+ *  Only buffers between 4 KB and 1 GB are kept.
+ *
+ *  The default is "0", which keeps nothing. Setting a lower value releases
+ *  memory that is over the new limit, and the memory is released at SDL_Quit().
+ *
+ *  This hint takes effect once SDL_Init() has been called.
+ */
+#define SDL_HINT_SURFACE_POOL_SIZE "SDL_SURFACE_POOL_SIZE"
+
 /**
  *  \brief Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as realtime.
  *
@@ -2280,6 +2392,20 @@ extern "C" {
  */
 #define SDL_HINT_X11_WINDOW_TYPE "SDL_X11_WINDOW_TYPE"
 
+/**
+ *  \brief  A variable controlling whether SDL uses SIMD code to convert YUV pixels
+ *
+ *  This affects SDL_ConvertPixels() and YUV textures on the software renderer,
+ *  and is mostly useful to compare the SIMD conversions with the C ones.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Only the C conversions are used
+ *    "1"       - SSE2, AVX2, NEON or LSX conversions are used if the CPU supports them (default)
+ *
+ *  This hint can be changed at any time, once SDL_Init() has been called.
+ */
+#define SDL_HINT_YUV_INTRINSICS "SDL_YUV_INTRINSICS"
+
 /**
  *  \brief  A variable that decides whether to send SDL_QUIT when closing the final window.
  *
@@ -354,6 +354,40 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_LoadBMP_RW(SDL_RWops * src,
  */
 #define SDL_LoadBMP(file)   SDL_LoadBMP_RW(SDL_RWFromFile(file, "rb"), 1)
 
+/**
+ * Load a BMP image from a seekable SDL data stream into a surface with a
+ * specific pixel format.
+ *
+ * This gives the same result as SDL_LoadBMP_RW() followed by
+ * SDL_ConvertSurfaceFormat(), but uncompressed 16, 24 and 32-bit images are
+ * converted row by row as they're read, without an intermediate surface.
+ *
+ * \param src the data stream for the surface
+ * \param freesrc non-zero to close the stream after being read
+ * \param format the SDL_PixelFormatEnum of the new surface, or
+ *               SDL_PIXELFORMAT_UNKNOWN to use the format of the image
+ * \returns a pointer to a new SDL_Surface structure or NULL if there was an
+ *          error; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.28.0.
+ *
+ * \sa SDL_FreeSurface
+ * \sa SDL_LoadBMP_RW
+ * \sa SDL_LoadBMPFormat
+ * \sa SDL_ConvertSurfaceFormat
+ */
+extern DECLSPEC SDL_Surface *SDLCALL SDL_LoadBMPFormat_RW(SDL_RWops * src,
+                                                          int freesrc,
+                                                          Uint32 format);
+
+/**
+ * Load a surface with a specific pixel format from a file.
+ *
+ * Convenience macro.
+ */
+#define SDL_LoadBMPFormat(file, format) \
+        SDL_LoadBMPFormat_RW(SDL_RWFromFile(file, "rb"), 1, format)
+
 /**
  * Save a surface to a seekable SDL data stream in BMP format.
  *
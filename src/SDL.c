@@ -52,6 +52,10 @@
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
+#include "thread/SDL_workerpool_c.h"
+#include "video/SDL_blit.h"
+#include "video/SDL_pixels_c.h"
+#include "video/SDL_yuv_c.h"
 
 /* Initialization/Cleanup routines */
 #if !SDL_TIMERS_DISABLED
@@ -208,6 +212,11 @@ int SDL_InitSubSystem(Uint32 flags)
     SDL_TicksInit();
 #endif
 
+    /* Blits and conversions may run on worker threads, so watch their hints from here */
+    SDL_InitBlitStats();
+    SDL_InitYUVIntrinsics();
+    SDL_InitSurfacePool();
+
     /* Initialize the event subsystem */
     if ((flags & SDL_INIT_EVENTS)) {
 #if !SDL_EVENTS_DISABLED
@@ -487,6 +496,10 @@ void SDL_Quit(void)
     SDL_TicksQuit();
 #endif
 
+    SDL_QuitWorkerPool();
+    SDL_QuitBlitStats();
+    SDL_QuitSurfacePool();
+    SDL_QuitYUVIntrinsics();
     SDL_ClearHints();
     SDL_AssertionsQuit();
 
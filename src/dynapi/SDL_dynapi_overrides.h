@@ -894,3 +894,4 @@
 #define SDL_ResetHints SDL_ResetHints_REAL
 #define SDL_strcasestr SDL_strcasestr_REAL
 #define SDL_GDKSuspendComplete SDL_GDKSuspendComplete_REAL
+#define SDL_LoadBMPFormat_RW SDL_LoadBMPFormat_RW_REAL
@@ -979,3 +979,4 @@ SDL_DYNAPI_PROC(char*,SDL_strcasestr,(const char *a, const char *b),(a,b),return
 #if defined(__GDK__)
 SDL_DYNAPI_PROC(void,SDL_GDKSuspendComplete,(void),(),return)
 #endif
+SDL_DYNAPI_PROC(SDL_Surface*,SDL_LoadBMPFormat_RW,(SDL_RWops *a, int b, Uint32 c),(a,b,c),return)
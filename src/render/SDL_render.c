@@ -47,6 +47,11 @@ this should probably be removed at some point in the future.  --ryan. */
 
 #define SDL_WINDOWRENDERDATA "_SDL_WindowRenderData"
 
+/* Pending changes to a texture backed by a native texture are kept to this
+   many boxes, and merged into this many rects when they're converted */
+#define SDL_MAX_PENDING_TEXTURE_BOXES 64
+#define SDL_MAX_PENDING_TEXTURE_RECTS 8
+
 #define CHECK_RENDERER_MAGIC(renderer, retval)             \
     if (!renderer || renderer->magic != &renderer_magic) { \
         SDL_InvalidParamError("renderer");                 \
@@ -248,12 +253,16 @@ static int FlushRenderCommands(SDL_Renderer *renderer)
 
     retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
 
-    /* Move the whole render command queue to the unused pool so we can reuse them next time. */
-    if (renderer->render_commands_tail != NULL) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        renderer->render_commands_pool = renderer->render_commands;
-        renderer->render_commands_tail = NULL;
-        renderer->render_commands = NULL;
+    /* Rewind the command blocks so we can reuse them next time. */
+    renderer->render_commands_tail = NULL;
+    renderer->render_commands = NULL;
+    renderer->render_command_block = NULL;
+    if (renderer->render_commands_queued > renderer->render_commands_high_water) {
+        renderer->render_commands_high_water = renderer->render_commands_queued;
+    }
+    renderer->render_commands_queued = 0;
+    if (renderer->vertex_data_used > renderer->vertex_data_high_water) {
+        renderer->vertex_data_high_water = renderer->vertex_data_used;
     }
     renderer->vertex_data_used = 0;
     renderer->render_command_generation++;
@@ -322,19 +331,30 @@ SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t numbytes, const
 static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
 {
     SDL_RenderCommand *retval = NULL;
+    SDL_RenderCommandBlock *block = renderer->render_command_block;
 
     /* !!! FIXME: are there threading limitations in SDL's render API? If not, we need to mutex this. */
-    retval = renderer->render_commands_pool;
-    if (retval != NULL) {
-        renderer->render_commands_pool = retval->next;
-        retval->next = NULL;
-    } else {
-        retval = SDL_calloc(1, sizeof(*retval));
-        if (retval == NULL) {
-            SDL_OutOfMemory();
-            return NULL;
+    if (block == NULL || block->used == SDL_RENDER_COMMAND_BLOCK_SIZE) {
+        SDL_RenderCommandBlock *next = block ? block->next : renderer->render_command_blocks;
+        if (next == NULL) {
+            next = (SDL_RenderCommandBlock *)SDL_malloc(sizeof(*next));
+            if (next == NULL) {
+                SDL_OutOfMemory();
+                return NULL;
+            }
+            next->next = NULL;
+            if (block != NULL) {
+                block->next = next;
+            } else {
+                renderer->render_command_blocks = next;
+            }
         }
+        next->used = 0;
+        renderer->render_command_block = block = next;
     }
+    retval = &block->commands[block->used++];
+    retval->next = NULL;
+    renderer->render_commands_queued++;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
     if (renderer->render_commands_tail != NULL) {
@@ -1308,6 +1328,7 @@ SDL_CreateTexture(SDL_Renderer *renderer, Uint32 format, int access, int w, int
             closest_format = renderer->info.texture_formats[0];
         }
 
+        SDL_InitRegion(&texture->pending);
         texture->native = SDL_CreateTexture(renderer, closest_format, access, w, h);
         if (!texture->native) {
             SDL_DestroyTexture(texture);
@@ -1656,51 +1677,159 @@ SDL_GetTextureUserData(SDL_Texture *texture)
     return texture->userdata;
 }
 
-#if SDL_HAVE_YUV
-static int SDL_UpdateTextureYUV(SDL_Texture *texture, const SDL_Rect *rect,
-                                const void *pixels, int pitch)
+/* Convert rect of the YUV data or the streaming pixels of a texture into its native texture */
+static int SDL_ConvertToNativeTexture(SDL_Texture *texture, const SDL_Rect *rect)
 {
     SDL_Texture *native = texture->native;
-    SDL_Rect full_rect;
+    void *native_pixels = NULL;
+    int native_pitch = 0;
+    void *temp_pixels = NULL;
 
-    if (SDL_SW_UpdateYUVTexture(texture->yuv, rect, pixels, pitch) < 0) {
-        return -1;
+    if (!rect->w || !rect->h) {
+        return 0; /* nothing to do. */
     }
 
-    full_rect.x = 0;
-    full_rect.y = 0;
-    full_rect.w = texture->w;
-    full_rect.h = texture->h;
-    rect = &full_rect;
-
     if (texture->access == SDL_TEXTUREACCESS_STREAMING) {
         /* We can lock the texture and copy to it */
-        void *native_pixels = NULL;
-        int native_pitch = 0;
-
         if (SDL_LockTexture(native, rect, &native_pixels, &native_pitch) < 0) {
             return -1;
         }
+    } else {
+        /* Use a temporary buffer for updating */
+        native_pitch = (((rect->w * SDL_BYTESPERPIXEL(native->format)) + 3) & ~3);
+        temp_pixels = SDL_malloc((size_t)rect->h * native_pitch);
+        if (temp_pixels == NULL) {
+            return SDL_OutOfMemory();
+        }
+        native_pixels = temp_pixels;
+    }
+
+#if SDL_HAVE_YUV
+    if (texture->yuv) {
         SDL_SW_CopyYUVToRGB(texture->yuv, rect, native->format,
-                            rect->w, rect->h, native_pixels, native_pitch);
+                            rect->w, rect->h, native_pixels, native_pitch, texture->scaleMode);
+    } else
+#endif
+    {
+        const void *pixels = (void *)((Uint8 *)texture->pixels +
+                                      rect->y * texture->pitch +
+                                      rect->x * SDL_BYTESPERPIXEL(texture->format));
+        SDL_ConvertPixels(rect->w, rect->h,
+                          texture->format, pixels, texture->pitch,
+                          native->format, native_pixels, native_pitch);
+    }
+
+    if (temp_pixels) {
+        SDL_UpdateTexture(native, rect, temp_pixels, native_pitch);
+        SDL_free(temp_pixels);
+    } else {
         SDL_UnlockTexture(native);
+    }
+    return 0;
+}
+
+/* Updates of the YUV data or the streaming pixels of a texture are only
+   converted into its native texture once the texture is used, so a texture
+   that is updated or locked several times per frame is only converted once,
+   and parts that are overwritten before then are never converted at all. */
+static int SDL_AddPendingTextureRect(SDL_Texture *texture, const SDL_Rect *rect)
+{
+    if (texture->access == SDL_TEXTUREACCESS_TARGET) {
+        /* Keep the order of updates and rendering to the texture */
+        return SDL_ConvertToNativeTexture(texture, rect);
+    }
+    if (!rect->w || !rect->h || texture->pending_all) {
+        return 0;
+    }
+    if (SDL_UnionRegionRect(&texture->pending, rect) < 0 ||
+        (texture->pending.numboxes > SDL_MAX_PENDING_TEXTURE_BOXES &&
+         SDL_SimplifyRegion(&texture->pending, SDL_MAX_PENDING_TEXTURE_RECTS) < 0)) {
+        /* Convert the whole texture when it's used instead */
+        SDL_ClearRegion(&texture->pending);
+        texture->pending_all = SDL_TRUE;
+    }
+    return 0;
+}
+
+/* Bring the native texture up to date before it's used */
+static int SDL_FlushPendingTexture(SDL_Texture *texture)
+{
+    SDL_Rect rects[SDL_MAX_PENDING_TEXTURE_RECTS];
+    int i, numrects;
+
+    if (!texture->pending_all && SDL_RegionEmpty(&texture->pending)) {
+        return 0;
+    }
+
+    if (!texture->pending_all && SDL_SimplifyRegion(&texture->pending, SDL_arraysize(rects)) < 0) {
+        texture->pending_all = SDL_TRUE;
+    }
+    if (texture->pending_all) {
+        rects[0].x = 0;
+        rects[0].y = 0;
+        rects[0].w = texture->w;
+        rects[0].h = texture->h;
+        numrects = 1;
     } else {
-        /* Use a temporary buffer for updating */
-        const int temp_pitch = (((rect->w * SDL_BYTESPERPIXEL(native->format)) + 3) & ~3);
-        const size_t alloclen = (size_t)rect->h * temp_pitch;
-        if (alloclen > 0) {
-            void *temp_pixels = SDL_malloc(alloclen);
-            if (temp_pixels == NULL) {
-                return SDL_OutOfMemory();
-            }
-            SDL_SW_CopyYUVToRGB(texture->yuv, rect, native->format,
-                                rect->w, rect->h, temp_pixels, temp_pitch);
-            SDL_UpdateTexture(native, rect, temp_pixels, temp_pitch);
-            SDL_free(temp_pixels);
+        numrects = SDL_GetRegionRects(&texture->pending, rects, SDL_arraysize(rects));
+    }
+    texture->pending_all = SDL_FALSE;
+    SDL_ClearRegion(&texture->pending);
+
+    for (i = 0; i < numrects; ++i) {
+        if (SDL_ConvertToNativeTexture(texture, &rects[i]) < 0) {
+            return -1;
         }
     }
     return 0;
 }
+
+#if SDL_HAVE_YUV
+/* The area of the native texture to refresh after the YUV data in rect
+   changed, widened to whole chroma samples since those span 2x2 pixels */
+static void GetYUVConvertRect(SDL_Texture *texture, const SDL_Rect *rect, SDL_Rect *convert_rect)
+{
+    convert_rect->x = SDL_max(rect->x, 0) & ~1;
+    convert_rect->y = SDL_max(rect->y, 0) & ~1;
+    convert_rect->w = SDL_max(SDL_min((rect->x + rect->w + 1) & ~1, texture->w) - convert_rect->x, 0);
+    convert_rect->h = SDL_max(SDL_min((rect->y + rect->h + 1) & ~1, texture->h) - convert_rect->y, 0);
+}
+
+/* Scaled copies of a YUV texture without color, alpha or blend modes can
+   be converted and scaled in one pass by the renderer, instead of
+   converting the source into the native texture and scaling that. Targets
+   are drawn into their native texture, so they always use that. */
+static SDL_bool SDL_CanScaleYUVTexture(SDL_Renderer *renderer, SDL_Texture *texture,
+                                       const SDL_Rect *srcrect, const SDL_FRect *dstrect)
+{
+    if (!texture->yuv || texture->access == SDL_TEXTUREACCESS_TARGET ||
+        !renderer->scale_yuv_textures || renderer->QueueCopy == NULL) {
+        return SDL_FALSE;
+    }
+    if (texture->blendMode != SDL_BLENDMODE_NONE || texture->modMode != SDL_TEXTUREMODULATE_NONE) {
+        return SDL_FALSE;
+    }
+    return ((int)(dstrect->w * renderer->scale.x) != srcrect->w ||
+            (int)(dstrect->h * renderer->scale.y) != srcrect->h) ? SDL_TRUE : SDL_FALSE;
+}
+
+static int SDL_UpdateTextureYUV(SDL_Texture *texture, const SDL_Rect *rect,
+                                const void *pixels, int pitch)
+{
+    SDL_Rect convert_rect;
+
+    /* Queued scaled copies read the planes, see SDL_CanScaleYUVTexture() */
+    if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+        return -1;
+    }
+
+    if (SDL_SW_UpdateYUVTexture(texture->yuv, rect, pixels, pitch) < 0) {
+        return -1;
+    }
+
+    GetYUVConvertRect(texture, rect, &convert_rect);
+    return SDL_AddPendingTextureRect(texture, &convert_rect);
+}
 #endif /* SDL_HAVE_YUV */
 
 static int SDL_UpdateTextureNative(SDL_Texture *texture, const SDL_Rect *rect,
@@ -1713,17 +1842,15 @@ static int SDL_UpdateTextureNative(SDL_Texture *texture, const SDL_Rect *rect,
     }
 
     if (texture->access == SDL_TEXTUREACCESS_STREAMING) {
-        /* We can lock the texture and copy to it */
-        void *native_pixels = NULL;
-        int native_pitch = 0;
+        /* Keep the streaming pixels up to date and convert them when used */
+        void *texture_pixels = (void *)((Uint8 *)texture->pixels +
+                                        rect->y * texture->pitch +
+                                        rect->x * SDL_BYTESPERPIXEL(texture->format));
 
-        if (SDL_LockTexture(native, rect, &native_pixels, &native_pitch) < 0) {
-            return -1;
-        }
         SDL_ConvertPixels(rect->w, rect->h,
                           texture->format, pixels, pitch,
-                          native->format, native_pixels, native_pitch);
-        SDL_UnlockTexture(native);
+                          texture->format, texture_pixels, texture->pitch);
+        return SDL_AddPendingTextureRect(texture, rect);
     } else {
         /* Use a temporary buffer for updating */
         const int temp_pitch = (((rect->w * SDL_BYTESPERPIXEL(native->format)) + 3) & ~3);
@@ -1790,100 +1917,36 @@ static int SDL_UpdateTextureYUVPlanar(SDL_Texture *texture, const SDL_Rect *rect
                                       const Uint8 *Uplane, int Upitch,
                                       const Uint8 *Vplane, int Vpitch)
 {
-    SDL_Texture *native = texture->native;
-    SDL_Rect full_rect;
+    SDL_Rect convert_rect;
 
-    if (SDL_SW_UpdateYUVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch) < 0) {
+    if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
         return -1;
     }
 
-    full_rect.x = 0;
-    full_rect.y = 0;
-    full_rect.w = texture->w;
-    full_rect.h = texture->h;
-    rect = &full_rect;
-
-    if (!rect->w || !rect->h) {
-        return 0; /* nothing to do. */
+    if (SDL_SW_UpdateYUVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch) < 0) {
+        return -1;
     }
 
-    if (texture->access == SDL_TEXTUREACCESS_STREAMING) {
-        /* We can lock the texture and copy to it */
-        void *native_pixels = NULL;
-        int native_pitch = 0;
-
-        if (SDL_LockTexture(native, rect, &native_pixels, &native_pitch) < 0) {
-            return -1;
-        }
-        SDL_SW_CopyYUVToRGB(texture->yuv, rect, native->format,
-                            rect->w, rect->h, native_pixels, native_pitch);
-        SDL_UnlockTexture(native);
-    } else {
-        /* Use a temporary buffer for updating */
-        const int temp_pitch = (((rect->w * SDL_BYTESPERPIXEL(native->format)) + 3) & ~3);
-        const size_t alloclen = (size_t)rect->h * temp_pitch;
-        if (alloclen > 0) {
-            void *temp_pixels = SDL_malloc(alloclen);
-            if (temp_pixels == NULL) {
-                return SDL_OutOfMemory();
-            }
-            SDL_SW_CopyYUVToRGB(texture->yuv, rect, native->format,
-                                rect->w, rect->h, temp_pixels, temp_pitch);
-            SDL_UpdateTexture(native, rect, temp_pixels, temp_pitch);
-            SDL_free(temp_pixels);
-        }
-    }
-    return 0;
+    GetYUVConvertRect(texture, rect, &convert_rect);
+    return SDL_AddPendingTextureRect(texture, &convert_rect);
 }
 
 static int SDL_UpdateTextureNVPlanar(SDL_Texture *texture, const SDL_Rect *rect,
                                      const Uint8 *Yplane, int Ypitch,
                                      const Uint8 *UVplane, int UVpitch)
 {
-    SDL_Texture *native = texture->native;
-    SDL_Rect full_rect;
+    SDL_Rect convert_rect;
 
-    if (SDL_SW_UpdateNVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, UVplane, UVpitch) < 0) {
+    if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
         return -1;
     }
 
-    full_rect.x = 0;
-    full_rect.y = 0;
-    full_rect.w = texture->w;
-    full_rect.h = texture->h;
-    rect = &full_rect;
-
-    if (!rect->w || !rect->h) {
-        return 0; /* nothing to do. */
+    if (SDL_SW_UpdateNVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, UVplane, UVpitch) < 0) {
+        return -1;
     }
 
-    if (texture->access == SDL_TEXTUREACCESS_STREAMING) {
-        /* We can lock the texture and copy to it */
-        void *native_pixels = NULL;
-        int native_pitch = 0;
-
-        if (SDL_LockTexture(native, rect, &native_pixels, &native_pitch) < 0) {
-            return -1;
-        }
-        SDL_SW_CopyYUVToRGB(texture->yuv, rect, native->format,
-                            rect->w, rect->h, native_pixels, native_pitch);
-        SDL_UnlockTexture(native);
-    } else {
-        /* Use a temporary buffer for updating */
-        const int temp_pitch = (((rect->w * SDL_BYTESPERPIXEL(native->format)) + 3) & ~3);
-        const size_t alloclen = (size_t)rect->h * temp_pitch;
-        if (alloclen > 0) {
-            void *temp_pixels = SDL_malloc(alloclen);
-            if (temp_pixels == NULL) {
-                return SDL_OutOfMemory();
-            }
-            SDL_SW_CopyYUVToRGB(texture->yuv, rect, native->format,
-                                rect->w, rect->h, temp_pixels, temp_pitch);
-            SDL_UpdateTexture(native, rect, temp_pixels, temp_pitch);
-            SDL_free(temp_pixels);
-        }
-    }
-    return 0;
+    GetYUVConvertRect(texture, rect, &convert_rect);
+    return SDL_AddPendingTextureRect(texture, &convert_rect);
 }
 
 #endif /* SDL_HAVE_YUV */
@@ -2019,6 +2082,7 @@ int SDL_UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect,
 static int SDL_LockTextureYUV(SDL_Texture *texture, const SDL_Rect *rect,
                               void **pixels, int *pitch)
 {
+    texture->locked_rect = *rect;
     return SDL_SW_LockYUVTexture(texture->yuv, rect, pixels, pitch);
 }
 #endif /* SDL_HAVE_YUV */
@@ -2111,43 +2175,16 @@ int SDL_LockTextureToSurface(SDL_Texture *texture, const SDL_Rect *rect,
 #if SDL_HAVE_YUV
 static void SDL_UnlockTextureYUV(SDL_Texture *texture)
 {
-    SDL_Texture *native = texture->native;
-    void *native_pixels = NULL;
-    int native_pitch = 0;
     SDL_Rect rect;
 
-    rect.x = 0;
-    rect.y = 0;
-    rect.w = texture->w;
-    rect.h = texture->h;
-
-    if (SDL_LockTexture(native, &rect, &native_pixels, &native_pitch) < 0) {
-        return;
-    }
-    SDL_SW_CopyYUVToRGB(texture->yuv, &rect, native->format,
-                        rect.w, rect.h, native_pixels, native_pitch);
-    SDL_UnlockTexture(native);
+    GetYUVConvertRect(texture, &texture->locked_rect, &rect);
+    SDL_AddPendingTextureRect(texture, &rect);
 }
 #endif /* SDL_HAVE_YUV */
 
 static void SDL_UnlockTextureNative(SDL_Texture *texture)
 {
-    SDL_Texture *native = texture->native;
-    void *native_pixels = NULL;
-    int native_pitch = 0;
-    const SDL_Rect *rect = &texture->locked_rect;
-    const void *pixels = (void *)((Uint8 *)texture->pixels +
-                                  rect->y * texture->pitch +
-                                  rect->x * SDL_BYTESPERPIXEL(texture->format));
-    int pitch = texture->pitch;
-
-    if (SDL_LockTexture(native, rect, &native_pixels, &native_pitch) < 0) {
-        return;
-    }
-    SDL_ConvertPixels(rect->w, rect->h,
-                      texture->format, pixels, pitch,
-                      native->format, native_pixels, native_pitch);
-    SDL_UnlockTexture(native);
+    SDL_AddPendingTextureRect(texture, &texture->locked_rect);
 }
 
 void SDL_UnlockTexture(SDL_Texture *texture)
@@ -2198,7 +2235,10 @@ int SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
             return SDL_SetError("Texture not created with SDL_TEXTUREACCESS_TARGET");
         }
         if (texture->native) {
-            /* Always render to the native texture */
+            /* Always render to the native texture, after any pending changes */
+            if (SDL_FlushPendingTexture(texture) < 0) {
+                return -1;
+            }
             texture = texture->native;
         }
     }
@@ -3428,7 +3468,15 @@ int SDL_RenderCopyF(SDL_Renderer *renderer, SDL_Texture *texture,
         real_dstrect = *dstrect;
     }
 
+#if SDL_HAVE_YUV
+    if (SDL_CanScaleYUVTexture(renderer, texture, &real_srcrect, &real_dstrect)) {
+        /* The renderer converts and scales it straight from the planes */
+    } else
+#endif
     if (texture->native) {
+        if (SDL_FlushPendingTexture(texture) < 0) {
+            return -1;
+        }
         texture = texture->native;
     }
 
@@ -3568,6 +3616,9 @@ int SDL_RenderCopyExF(SDL_Renderer *renderer, SDL_Texture *texture,
     }
 
     if (texture->native) {
+        if (SDL_FlushPendingTexture(texture) < 0) {
+            return -1;
+        }
         texture = texture->native;
     }
 
@@ -4115,6 +4166,9 @@ int SDL_RenderGeometryRaw(SDL_Renderer *renderer,
     }
 
     if (texture && texture->native) {
+        if (SDL_FlushPendingTexture(texture) < 0) {
+            return -1;
+        }
         texture = texture->native;
     }
 
@@ -4285,6 +4339,7 @@ void SDL_DestroyTexture(SDL_Texture *texture)
     if (texture->native) {
         SDL_DestroyTexture(texture->native);
     }
+    SDL_FreeRegion(&texture->pending);
 #if SDL_HAVE_YUV
     if (texture->yuv) {
         SDL_SW_DestroyYUVTexture(texture->yuv);
@@ -4302,27 +4357,26 @@ void SDL_DestroyTexture(SDL_Texture *texture)
 
 void SDL_DestroyRenderer(SDL_Renderer *renderer)
 {
-    SDL_RenderCommand *cmd;
+    SDL_RenderCommandBlock *block;
 
     CHECK_RENDERER_MAGIC(renderer, );
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
 
-    if (renderer->render_commands_tail != NULL) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        cmd = renderer->render_commands;
-    } else {
-        cmd = renderer->render_commands_pool;
-    }
+    SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Render queue high water mark: %d commands, %u bytes of vertex data",
+                 renderer->render_commands_high_water, (unsigned int)renderer->vertex_data_high_water);
 
-    renderer->render_commands_pool = NULL;
+    block = renderer->render_command_blocks;
+
+    renderer->render_command_blocks = NULL;
+    renderer->render_command_block = NULL;
     renderer->render_commands_tail = NULL;
     renderer->render_commands = NULL;
 
-    while (cmd != NULL) {
-        SDL_RenderCommand *next = cmd->next;
-        SDL_free(cmd);
-        cmd = next;
+    while (block != NULL) {
+        SDL_RenderCommandBlock *next = block->next;
+        SDL_free(block);
+        block = next;
     }
 
     SDL_free(renderer->vertex_data);
@@ -4357,6 +4411,9 @@ int SDL_GL_BindTexture(SDL_Texture *texture, float *texw, float *texh)
     CHECK_TEXTURE_MAGIC(texture, -1);
     renderer = texture->renderer;
     if (texture->native) {
+        if (SDL_FlushPendingTexture(texture) < 0) {
+            return -1;
+        }
         return SDL_GL_BindTexture(texture->native, texw, texh);
     } else if (renderer && renderer->GL_BindTexture) {
         FlushRenderCommandsIfTextureNeeded(texture); /* in case the app is going to mess with it. */
@@ -27,6 +27,7 @@
 #include "SDL_events.h"
 #include "SDL_mutex.h"
 #include "SDL_yuv_sw_c.h"
+#include "../video/SDL_region_c.h"
 
 /* Set up for C function definitions, even when using C++ */
 #ifdef __cplusplus
@@ -70,6 +71,8 @@ struct SDL_Texture
     int pitch;
     SDL_Rect locked_rect;
     SDL_Surface *locked_surface; /**< Locked region exposed as a SDL surface */
+    SDL_bool pending_all;        /**< The whole native texture needs converting */
+    SDL_Region pending;          /**< Changes not converted into the native texture yet */
 
     Uint32 last_command_generation; /* last command queue generation this texture was in. */
 
@@ -127,6 +130,18 @@ typedef struct SDL_RenderCommand
     struct SDL_RenderCommand *next;
 } SDL_RenderCommand;
 
+/* Render commands are handed out in order from these blocks, so a queue is
+   laid out mostly contiguously in memory. The blocks are kept for reuse
+   when the queue is flushed. */
+#define SDL_RENDER_COMMAND_BLOCK_SIZE 256
+
+typedef struct SDL_RenderCommandBlock
+{
+    struct SDL_RenderCommandBlock *next;
+    int used;
+    SDL_RenderCommand commands[SDL_RENDER_COMMAND_BLOCK_SIZE];
+} SDL_RenderCommandBlock;
+
 typedef struct SDL_VertexSolid
 {
     SDL_FPoint position;
@@ -249,6 +264,10 @@ struct SDL_Renderer
     /* The method of drawing lines */
     SDL_RenderLineMethod line_method;
 
+    /* Whether QueueCopy takes scaled copies of YUV textures, converting and
+       scaling them straight from their planes instead of the native texture */
+    SDL_bool scale_yuv_textures;
+
     /* List of triangle indices to draw rects */
     int rect_index_order[6];
 
@@ -268,7 +287,10 @@ struct SDL_Renderer
     SDL_bool batching;
     SDL_RenderCommand *render_commands;
     SDL_RenderCommand *render_commands_tail;
-    SDL_RenderCommand *render_commands_pool;
+    SDL_RenderCommandBlock *render_command_blocks;
+    SDL_RenderCommandBlock *render_command_block; /* the block being filled, NULL after a flush */
+    int render_commands_queued;
+    int render_commands_high_water; /* most commands queued between two flushes */
     Uint32 render_command_generation;
     Uint32 last_queued_color;
     SDL_DRect last_queued_viewport;
@@ -281,6 +303,7 @@ struct SDL_Renderer
     void *vertex_data;
     size_t vertex_data_used;
     size_t vertex_data_allocation;
+    size_t vertex_data_high_water; /* most vertex data queued between two flushes */
 
     void *driverdata;
 };
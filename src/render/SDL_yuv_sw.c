@@ -26,6 +26,7 @@
 
 #include "SDL_yuv_sw_c.h"
 #include "SDL_cpuinfo.h"
+#include "../video/SDL_yuv_c.h"
 
 SDL_SW_YUVTexture *
 SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
@@ -53,7 +54,6 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
     }
 
     swdata->format = format;
-    swdata->target_format = SDL_PIXELFORMAT_UNKNOWN;
     swdata->w = w;
     swdata->h = h;
     {
@@ -356,79 +356,18 @@ void SDL_SW_UnlockYUVTexture(SDL_SW_YUVTexture *swdata)
 
 int SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture *swdata, const SDL_Rect *srcrect,
                         Uint32 target_format, int w, int h, void *pixels,
-                        int pitch)
+                        int pitch, SDL_ScaleMode scaleMode)
 {
-    int stretch;
-
-    /* Make sure we're set up to display in the desired format */
-    if (target_format != swdata->target_format && swdata->display) {
-        SDL_FreeSurface(swdata->display);
-        swdata->display = NULL;
-    }
-
-    stretch = 0;
-    if (srcrect->x || srcrect->y || srcrect->w < swdata->w || srcrect->h < swdata->h) {
-        /* The source rectangle has been clipped.
-           Using a scratch surface is easier than adding clipped
-           source support to all the blitters, plus that would
-           slow them down in the general unclipped case.
-         */
-        stretch = 1;
-    } else if ((srcrect->w != w) || (srcrect->h != h)) {
-        stretch = 1;
-    }
-    if (stretch) {
-        int bpp;
-        Uint32 Rmask, Gmask, Bmask, Amask;
-
-        if (swdata->display) {
-            swdata->display->w = w;
-            swdata->display->h = h;
-            swdata->display->pixels = pixels;
-            swdata->display->pitch = pitch;
-        } else {
-            /* This must have succeeded in SDL_SW_SetupYUVDisplay() earlier */
-            SDL_PixelFormatEnumToMasks(target_format, &bpp, &Rmask, &Gmask,
-                                       &Bmask, &Amask);
-            swdata->display =
-                SDL_CreateRGBSurfaceFrom(pixels, w, h, bpp, pitch, Rmask,
-                                         Gmask, Bmask, Amask);
-            if (!swdata->display) {
-                return -1;
-            }
-        }
-        if (!swdata->stretch) {
-            /* This must have succeeded in SDL_SW_SetupYUVDisplay() earlier */
-            SDL_PixelFormatEnumToMasks(target_format, &bpp, &Rmask, &Gmask,
-                                       &Bmask, &Amask);
-            swdata->stretch =
-                SDL_CreateRGBSurface(0, swdata->w, swdata->h, bpp, Rmask,
-                                     Gmask, Bmask, Amask);
-            if (!swdata->stretch) {
-                return -1;
-            }
-        }
-        pixels = swdata->stretch->pixels;
-        pitch = swdata->stretch->pitch;
-    }
-    if (SDL_ConvertPixels(swdata->w, swdata->h, swdata->format,
-                          swdata->planes[0], swdata->pitches[0],
-                          target_format, pixels, pitch) < 0) {
-        return -1;
-    }
-    if (stretch) {
-        SDL_Rect rect = *srcrect;
-        SDL_SoftStretch(swdata->stretch, &rect, swdata->display, NULL);
-    }
-    return 0;
+    /* Convert only srcrect, scaling straight from the planes into the destination */
+    return SDL_ConvertPixels_YUV_to_RGB_Scaled(swdata->w, swdata->h, swdata->format,
+                                               swdata->planes[0], swdata->pitches[0], srcrect,
+                                               target_format, pixels, w, h, pitch, scaleMode);
 }
 
 void SDL_SW_DestroyYUVTexture(SDL_SW_YUVTexture *swdata)
 {
     if (swdata) {
         SDL_SIMDFree(swdata->pixels);
-        SDL_FreeSurface(swdata->stretch);
-        SDL_FreeSurface(swdata->display);
         SDL_free(swdata);
     }
 }
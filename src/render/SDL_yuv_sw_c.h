@@ -25,23 +25,19 @@
 #include "../SDL_internal.h"
 
 #include "SDL_video.h"
+#include "SDL_render.h"
 
 /* This is the software implementation of the YUV texture support */
 
 struct SDL_SW_YUVTexture
 {
     Uint32 format;
-    Uint32 target_format;
     int w, h;
     Uint8 *pixels;
 
     /* These are just so we don't have to allocate them separately */
     Uint16 pitches[3];
     Uint8 *planes[3];
-
-    /* This is a temporary surface in case we have to stretch copy */
-    SDL_Surface *stretch;
-    SDL_Surface *display;
 };
 
 typedef struct SDL_SW_YUVTexture SDL_SW_YUVTexture;
@@ -63,7 +59,7 @@ int SDL_SW_LockYUVTexture(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect,
 void SDL_SW_UnlockYUVTexture(SDL_SW_YUVTexture *swdata);
 int SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture *swdata, const SDL_Rect *srcrect,
                         Uint32 target_format, int w, int h, void *pixels,
-                        int pitch);
+                        int pitch, SDL_ScaleMode scaleMode);
 void SDL_SW_DestroyYUVTexture(SDL_SW_YUVTexture *swdata);
 
 #endif /* SDL_yuv_sw_c_h_ */
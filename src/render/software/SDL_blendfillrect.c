@@ -23,8 +23,499 @@
 #if SDL_VIDEO_RENDER_SW && !SDL_RENDER_DISABLED
 
 #include "SDL_draw.h"
+#include "SDL_cpuinfo.h"
 #include "SDL_blendfillrect.h"
 
+#if defined(__SSE2__)
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if defined(__ARM_NEON)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#if defined(HAVE_SSE2_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+
+/* The SIMD fills compute every channel c of the destination as
+     min(c * m1 / 255 + c * m2 / 255 + k, 255)
+   with the divisions rounding down like DRAW_MUL(), so they match the
+   DRAW_SETPIXEL macros exactly:
+     blend: m1 = 255 - a, k = the premultiplied color (and a for alpha)
+     add:   k = the premultiplied color, added with saturation
+     mod:   m1 = the color (and 255 for alpha)
+     mul:   m1 = the color (and a for alpha), m2 = 255 - a
+ */
+typedef struct
+{
+    Uint32 m1, m2, k; /* per channel, packed like the pixels */
+    Uint32 keep;      /* the channels of the format, the others are cleared */
+} SDL_BlendFill8888;
+
+typedef struct
+{
+    Uint16 m1[3], m2[3], k[3]; /* red, green, blue */
+} SDL_BlendFill565;
+
+#define BLEND_FILL_BLEND 0
+#define BLEND_FILL_ADD   1
+#define BLEND_FILL_MOD   2
+#define BLEND_FILL_MUL   3
+
+#endif /* HAVE_SSE2_INTRINSICS || HAVE_NEON_INTRINSICS */
+
+#if defined(HAVE_SSE2_INTRINSICS)
+/* x * m / 255, for 16-bit lanes holding 8-bit values */
+SDL_FORCE_INLINE __m128i MulDiv255_SSE2(__m128i x, __m128i m)
+{
+    const __m128i t = _mm_mullo_epi16(x, m);
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_set1_epi16(1)), _mm_srli_epi16(t, 8)), 8);
+}
+
+SDL_FORCE_INLINE __m128i BlendFillChannels_SSE2(__m128i c, __m128i m1, __m128i m2, __m128i k, const int mode)
+{
+    __m128i result = MulDiv255_SSE2(c, m1);
+
+    if (mode == BLEND_FILL_MUL) {
+        result = _mm_add_epi16(result, MulDiv255_SSE2(c, m2));
+    } else if (mode == BLEND_FILL_BLEND) {
+        result = _mm_add_epi16(result, k);
+    }
+    return result;
+}
+
+SDL_FORCE_INLINE void BlendFillRect8888_SSE2(Uint8 *pixels, int pitch, int width, int height,
+                                             const SDL_BlendFill8888 *p, const int mode)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i m1 = _mm_unpacklo_epi8(_mm_set1_epi32((int)p->m1), zero);
+    const __m128i m2 = _mm_unpacklo_epi8(_mm_set1_epi32((int)p->m2), zero);
+    const __m128i k = _mm_set1_epi32((int)p->k);
+    const __m128i k16 = _mm_unpacklo_epi8(k, zero);
+    const __m128i keep = _mm_set1_epi32((int)p->keep);
+    Uint32 buf[4];
+
+    while (height--) {
+        Uint32 *dst = (Uint32 *)pixels;
+        int n = width;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = dst;
+            __m128i c;
+
+            if (count < 4) {
+                SDL_memcpy(buf, dst, count * sizeof(Uint32));
+                d = buf;
+            }
+            c = _mm_loadu_si128((const __m128i *)d);
+            if (mode == BLEND_FILL_ADD) {
+                c = _mm_adds_epu8(c, k);
+            } else {
+                c = _mm_packus_epi16(BlendFillChannels_SSE2(_mm_unpacklo_epi8(c, zero), m1, m2, k16, mode),
+                                     BlendFillChannels_SSE2(_mm_unpackhi_epi8(c, zero), m1, m2, k16, mode));
+            }
+            _mm_storeu_si128((__m128i *)d, _mm_and_si128(c, keep));
+            if (count < 4) {
+                SDL_memcpy(dst, buf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        pixels += pitch;
+    }
+}
+
+SDL_FORCE_INLINE __m128i BlendFillChannel565_SSE2(__m128i c, const SDL_BlendFill565 *p, int i, const int mode)
+{
+    const __m128i k = _mm_set1_epi16((short)p->k[i]);
+
+    if (mode == BLEND_FILL_ADD) {
+        c = _mm_add_epi16(c, k);
+    } else {
+        c = BlendFillChannels_SSE2(c, _mm_set1_epi16((short)p->m1[i]), _mm_set1_epi16((short)p->m2[i]), k, mode);
+    }
+    return _mm_min_epi16(c, _mm_set1_epi16(0xFF));
+}
+
+SDL_FORCE_INLINE void BlendFillRect565_SSE2(Uint8 *pixels, int pitch, int width, int height,
+                                            const SDL_BlendFill565 *p, const int mode)
+{
+    Uint16 buf[8];
+
+    while (height--) {
+        Uint16 *dst = (Uint16 *)pixels;
+        int n = width;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            Uint16 *d = dst;
+            __m128i c, r, g, b;
+
+            if (count < 8) {
+                SDL_memcpy(buf, dst, count * sizeof(Uint16));
+                d = buf;
+            }
+            c = _mm_loadu_si128((const __m128i *)d);
+
+            /* Expand to 8 bits like RGB_FROM_RGB565(), which rounds down:
+               x * 255 / 31 == (x * 2106) >> 8
+               x * 255 / 63 == (x << 2) + ((x * 49) >> 10)
+             */
+            r = _mm_srli_epi16(c, 11);
+            g = _mm_and_si128(_mm_srli_epi16(c, 5), _mm_set1_epi16(0x3F));
+            b = _mm_and_si128(c, _mm_set1_epi16(0x1F));
+            r = _mm_srli_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(2106)), 8);
+            g = _mm_add_epi16(_mm_slli_epi16(g, 2), _mm_srli_epi16(_mm_mullo_epi16(g, _mm_set1_epi16(49)), 10));
+            b = _mm_srli_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(2106)), 8);
+
+            r = BlendFillChannel565_SSE2(r, p, 0, mode);
+            g = BlendFillChannel565_SSE2(g, p, 1, mode);
+            b = BlendFillChannel565_SSE2(b, p, 2, mode);
+
+            c = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(r, 3), 11),
+                                          _mm_slli_epi16(_mm_srli_epi16(g, 2), 5)),
+                             _mm_srli_epi16(b, 3));
+            _mm_storeu_si128((__m128i *)d, c);
+            if (count < 8) {
+                SDL_memcpy(dst, buf, count * sizeof(Uint16));
+            }
+            dst += count;
+            n -= count;
+        }
+        pixels += pitch;
+    }
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if defined(HAVE_NEON_INTRINSICS)
+/* x * m / 255, for 16-bit lanes holding 8-bit values */
+SDL_FORCE_INLINE uint16x8_t MulDiv255_NEON(uint16x8_t t)
+{
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(t, vdupq_n_u16(1)), vshrq_n_u16(t, 8)), 8);
+}
+
+SDL_FORCE_INLINE uint8x8_t BlendFillChannels_NEON(uint8x8_t c, uint8x8_t m1, uint8x8_t m2, uint8x8_t k, const int mode)
+{
+    uint16x8_t result = MulDiv255_NEON(vmull_u8(c, m1));
+
+    if (mode == BLEND_FILL_MUL) {
+        result = vaddq_u16(result, MulDiv255_NEON(vmull_u8(c, m2)));
+    } else if (mode == BLEND_FILL_BLEND) {
+        result = vaddw_u8(result, k);
+    }
+    return vqmovn_u16(result);
+}
+
+SDL_FORCE_INLINE void BlendFillRect8888_NEON(Uint8 *pixels, int pitch, int width, int height,
+                                             const SDL_BlendFill8888 *p, const int mode)
+{
+    const uint8x8_t m1 = vreinterpret_u8_u32(vdup_n_u32(p->m1));
+    const uint8x8_t m2 = vreinterpret_u8_u32(vdup_n_u32(p->m2));
+    const uint8x8_t k = vreinterpret_u8_u32(vdup_n_u32(p->k));
+    const uint8x16_t k16 = vreinterpretq_u8_u32(vdupq_n_u32(p->k));
+    const uint8x16_t keep = vreinterpretq_u8_u32(vdupq_n_u32(p->keep));
+    Uint32 buf[4];
+
+    while (height--) {
+        Uint32 *dst = (Uint32 *)pixels;
+        int n = width;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = dst;
+            uint8x16_t c;
+
+            if (count < 4) {
+                SDL_memcpy(buf, dst, count * sizeof(Uint32));
+                d = buf;
+            }
+            c = vld1q_u8((const uint8_t *)d);
+            if (mode == BLEND_FILL_ADD) {
+                c = vqaddq_u8(c, k16);
+            } else {
+                c = vcombine_u8(BlendFillChannels_NEON(vget_low_u8(c), m1, m2, k, mode),
+                                BlendFillChannels_NEON(vget_high_u8(c), m1, m2, k, mode));
+            }
+            vst1q_u8((uint8_t *)d, vandq_u8(c, keep));
+            if (count < 4) {
+                SDL_memcpy(dst, buf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        pixels += pitch;
+    }
+}
+
+SDL_FORCE_INLINE uint16x8_t BlendFillChannel565_NEON(uint16x8_t c, const SDL_BlendFill565 *p, int i, const int mode)
+{
+    const uint16x8_t k = vdupq_n_u16(p->k[i]);
+
+    if (mode == BLEND_FILL_ADD) {
+        c = vaddq_u16(c, k);
+    } else {
+        uint16x8_t result = MulDiv255_NEON(vmulq_u16(c, vdupq_n_u16(p->m1[i])));
+        if (mode == BLEND_FILL_MUL) {
+            result = vaddq_u16(result, MulDiv255_NEON(vmulq_u16(c, vdupq_n_u16(p->m2[i]))));
+        } else if (mode == BLEND_FILL_BLEND) {
+            result = vaddq_u16(result, k);
+        }
+        c = result;
+    }
+    return vminq_u16(c, vdupq_n_u16(0xFF));
+}
+
+SDL_FORCE_INLINE void BlendFillRect565_NEON(Uint8 *pixels, int pitch, int width, int height,
+                                            const SDL_BlendFill565 *p, const int mode)
+{
+    Uint16 buf[8];
+
+    while (height--) {
+        Uint16 *dst = (Uint16 *)pixels;
+        int n = width;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            Uint16 *d = dst;
+            uint16x8_t c, r, g, b;
+
+            if (count < 8) {
+                SDL_memcpy(buf, dst, count * sizeof(Uint16));
+                d = buf;
+            }
+            c = vld1q_u16(d);
+
+            /* Expand to 8 bits like RGB_FROM_RGB565(), see the SSE2 version */
+            r = vshrq_n_u16(c, 11);
+            g = vandq_u16(vshrq_n_u16(c, 5), vdupq_n_u16(0x3F));
+            b = vandq_u16(c, vdupq_n_u16(0x1F));
+            r = vshrq_n_u16(vmulq_u16(r, vdupq_n_u16(2106)), 8);
+            g = vaddq_u16(vshlq_n_u16(g, 2), vshrq_n_u16(vmulq_u16(g, vdupq_n_u16(49)), 10));
+            b = vshrq_n_u16(vmulq_u16(b, vdupq_n_u16(2106)), 8);
+
+            r = BlendFillChannel565_NEON(r, p, 0, mode);
+            g = BlendFillChannel565_NEON(g, p, 1, mode);
+            b = BlendFillChannel565_NEON(b, p, 2, mode);
+
+            c = vorrq_u16(vorrq_u16(vshlq_n_u16(vshrq_n_u16(r, 3), 11),
+                                    vshlq_n_u16(vshrq_n_u16(g, 2), 5)),
+                          vshrq_n_u16(b, 3));
+            vst1q_u16(d, c);
+            if (count < 8) {
+                SDL_memcpy(dst, buf, count * sizeof(Uint16));
+            }
+            dst += count;
+            n -= count;
+        }
+        pixels += pitch;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+#if defined(HAVE_SSE2_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+#if defined(HAVE_SSE2_INTRINSICS)
+#define SIMD_FILL(format, mode) BlendFillRect##format##_SSE2(pixels, pitch, width, height, p, mode)
+#else
+#define SIMD_FILL(format, mode) BlendFillRect##format##_NEON(pixels, pitch, width, height, p, mode)
+#endif
+
+/* A column only has one pixel per row, so it is gathered into a row and
+   blended as one span. */
+#define SIMD_FILL_COLUMN(format, type)                                         \
+    if (rect->w == 1 && rect->h > 1) {                                         \
+        type column[16];                                                       \
+        int y, row, count;                                                     \
+        for (y = 0; y < rect->h; y += count) {                                 \
+            count = SDL_min(rect->h - y, (int)SDL_arraysize(column));          \
+            for (row = 0; row < count; ++row) {                                \
+                column[row] = *(type *)(pixels + (y + row) * dst->pitch);      \
+            }                                                                  \
+            BlendFillSpans##format((Uint8 *)column, 0, count, 1, &p, mode);    \
+            for (row = 0; row < count; ++row) {                                \
+                *(type *)(pixels + (y + row) * dst->pitch) = column[row];      \
+            }                                                                  \
+        }                                                                      \
+        return;                                                                \
+    }
+
+static void BlendFillSpans8888(Uint8 *pixels, int pitch, int width, int height,
+                               const SDL_BlendFill8888 *p, int mode)
+{
+    switch (mode) {
+    case BLEND_FILL_BLEND:
+        SIMD_FILL(8888, BLEND_FILL_BLEND);
+        break;
+    case BLEND_FILL_ADD:
+        SIMD_FILL(8888, BLEND_FILL_ADD);
+        break;
+    case BLEND_FILL_MOD:
+        SIMD_FILL(8888, BLEND_FILL_MOD);
+        break;
+    default:
+        SIMD_FILL(8888, BLEND_FILL_MUL);
+        break;
+    }
+}
+
+static void BlendFillSpans565(Uint8 *pixels, int pitch, int width, int height,
+                              const SDL_BlendFill565 *p, int mode)
+{
+    switch (mode) {
+    case BLEND_FILL_BLEND:
+        SIMD_FILL(565, BLEND_FILL_BLEND);
+        break;
+    case BLEND_FILL_ADD:
+        SIMD_FILL(565, BLEND_FILL_ADD);
+        break;
+    case BLEND_FILL_MOD:
+        SIMD_FILL(565, BLEND_FILL_MOD);
+        break;
+    default:
+        SIMD_FILL(565, BLEND_FILL_MUL);
+        break;
+    }
+}
+
+static SDL_bool SDL_HasBlendFillSIMD(void)
+{
+#if defined(HAVE_SSE2_INTRINSICS)
+    return SDL_HasSSE2();
+#else
+    return SDL_HasNEON();
+#endif
+}
+
+static SDL_bool SDL_IsByteMask(Uint32 mask)
+{
+    return mask == 0x000000FF || mask == 0x0000FF00 || mask == 0x00FF0000 || mask == 0xFF000000;
+}
+
+static int SDL_BlendFillModeIndex(SDL_BlendMode blendMode)
+{
+    switch (blendMode) {
+    case SDL_BLENDMODE_BLEND:
+        return BLEND_FILL_BLEND;
+    case SDL_BLENDMODE_ADD:
+        return BLEND_FILL_ADD;
+    case SDL_BLENDMODE_MOD:
+        return BLEND_FILL_MOD;
+    case SDL_BLENDMODE_MUL:
+        return BLEND_FILL_MUL;
+    default:
+        return -1;
+    }
+}
+
+static void SDL_BlendFillRect8888SIMD(SDL_Surface *dst, const SDL_Rect *rect, int mode,
+                                      Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    const SDL_PixelFormat *fmt = dst->format;
+    Uint8 *pixels = (Uint8 *)dst->pixels + rect->y * dst->pitch + rect->x * 4;
+    const unsigned inva = 0xff - a;
+    unsigned m1[4], m2[4], k[4];
+    SDL_BlendFill8888 p;
+
+    /* Red, green, blue and alpha */
+    switch (mode) {
+    case BLEND_FILL_BLEND:
+        m1[0] = m1[1] = m1[2] = m1[3] = inva;
+        m2[0] = m2[1] = m2[2] = m2[3] = 0;
+        k[0] = r, k[1] = g, k[2] = b, k[3] = a;
+        break;
+    case BLEND_FILL_ADD:
+        m1[0] = m1[1] = m1[2] = m1[3] = 0xff;
+        m2[0] = m2[1] = m2[2] = m2[3] = 0;
+        k[0] = r, k[1] = g, k[2] = b, k[3] = 0;
+        break;
+    case BLEND_FILL_MOD:
+        m1[0] = r, m1[1] = g, m1[2] = b, m1[3] = 0xff;
+        m2[0] = m2[1] = m2[2] = m2[3] = 0;
+        k[0] = k[1] = k[2] = k[3] = 0;
+        break;
+    default:
+        m1[0] = r, m1[1] = g, m1[2] = b, m1[3] = a;
+        m2[0] = m2[1] = m2[2] = m2[3] = inva;
+        k[0] = k[1] = k[2] = k[3] = 0;
+        break;
+    }
+    p.m1 = (m1[0] << fmt->Rshift) | (m1[1] << fmt->Gshift) | (m1[2] << fmt->Bshift);
+    p.m2 = (m2[0] << fmt->Rshift) | (m2[1] << fmt->Gshift) | (m2[2] << fmt->Bshift);
+    p.k = (k[0] << fmt->Rshift) | (k[1] << fmt->Gshift) | (k[2] << fmt->Bshift);
+    p.keep = fmt->Rmask | fmt->Gmask | fmt->Bmask | fmt->Amask;
+    if (fmt->Amask) {
+        p.m1 |= m1[3] << fmt->Ashift;
+        p.m2 |= m2[3] << fmt->Ashift;
+        p.k |= k[3] << fmt->Ashift;
+    }
+
+    SIMD_FILL_COLUMN(8888, Uint32)
+
+    BlendFillSpans8888(pixels, dst->pitch, rect->w, rect->h, &p, mode);
+}
+
+static void SDL_BlendFillRect565SIMD(SDL_Surface *dst, const SDL_Rect *rect, int mode,
+                                     Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    Uint8 *pixels = (Uint8 *)dst->pixels + rect->y * dst->pitch + rect->x * 2;
+    const Uint16 inva = 0xff - a;
+    SDL_BlendFill565 p;
+    int i;
+
+    SDL_zero(p);
+    for (i = 0; i < 3; ++i) {
+        const Uint16 c = (i == 0) ? r : (i == 1) ? g : b;
+        switch (mode) {
+        case BLEND_FILL_BLEND:
+            p.m1[i] = inva;
+            p.k[i] = c;
+            break;
+        case BLEND_FILL_ADD:
+            p.k[i] = c;
+            break;
+        case BLEND_FILL_MOD:
+            p.m1[i] = c;
+            break;
+        default:
+            p.m1[i] = c;
+            p.m2[i] = inva;
+            break;
+        }
+    }
+
+    SIMD_FILL_COLUMN(565, Uint16)
+
+    BlendFillSpans565(pixels, dst->pitch, rect->w, rect->h, &p, mode);
+}
+#undef SIMD_FILL
+#undef SIMD_FILL_COLUMN
+#endif /* HAVE_SSE2_INTRINSICS || HAVE_NEON_INTRINSICS */
+
+SDL_bool SDL_BlendFillRectSIMD(SDL_Surface *dst, const SDL_Rect *rect,
+                               SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+#if defined(HAVE_SSE2_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+    const SDL_PixelFormat *fmt = dst->format;
+    const int mode = SDL_BlendFillModeIndex(blendMode);
+
+    if (mode < 0 || !SDL_HasBlendFillSIMD()) {
+        return SDL_FALSE;
+    }
+
+    if (fmt->BytesPerPixel == 4 &&
+        SDL_IsByteMask(fmt->Rmask) && SDL_IsByteMask(fmt->Gmask) && SDL_IsByteMask(fmt->Bmask) &&
+        (fmt->Amask == 0 || SDL_IsByteMask(fmt->Amask))) {
+        SDL_BlendFillRect8888SIMD(dst, rect, mode, r, g, b, a);
+        return SDL_TRUE;
+    }
+    if (fmt->BytesPerPixel == 2 &&
+        fmt->Rmask == 0xF800 && fmt->Gmask == 0x07E0 && fmt->Bmask == 0x001F) {
+        SDL_BlendFillRect565SIMD(dst, rect, mode, r, g, b, a);
+        return SDL_TRUE;
+    }
+#endif
+    return SDL_FALSE;
+}
+
 static int SDL_BlendFillRect_RGB555(SDL_Surface *dst, const SDL_Rect *rect,
                                     SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
@@ -237,6 +728,10 @@ int SDL_BlendFillRect(SDL_Surface *dst, const SDL_Rect *rect,
         b = DRAW_MUL(b, a);
     }
 
+    if (SDL_BlendFillRectSIMD(dst, rect, blendMode, r, g, b, a)) {
+        return 0;
+    }
+
     switch (dst->format->BitsPerPixel) {
     case 15:
         switch (dst->format->Rmask) {
@@ -338,6 +833,9 @@ int SDL_BlendFillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
         if (!SDL_IntersectRect(&rects[i], &dst->clip_rect, &rect)) {
             continue;
         }
+        if (SDL_BlendFillRectSIMD(dst, &rect, blendMode, r, g, b, a)) {
+            continue;
+        }
         status = func(dst, &rect, blendMode, r, g, b, a);
     }
     return status;
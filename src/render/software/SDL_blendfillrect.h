@@ -27,6 +27,12 @@
 extern int SDL_BlendFillRect(SDL_Surface *dst, const SDL_Rect *rect, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 extern int SDL_BlendFillRects(SDL_Surface *dst, const SDL_Rect *rects, int count, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
+/* Blend a color over a rect that's already clipped, using SIMD for 32-bit
+   formats with 8 bits per channel and RGB565. The color is premultiplied
+   for SDL_BLENDMODE_BLEND and SDL_BLENDMODE_ADD, like in SDL_draw.h.
+   Returns SDL_FALSE without touching the surface if there's no SIMD path. */
+extern SDL_bool SDL_BlendFillRectSIMD(SDL_Surface *dst, const SDL_Rect *rect, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
 #endif /* SDL_blendfillrect_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
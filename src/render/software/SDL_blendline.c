@@ -23,6 +23,7 @@
 #if SDL_VIDEO_RENDER_SW && !SDL_RENDER_DISABLED
 
 #include "SDL_draw.h"
+#include "SDL_blendfillrect.h"
 #include "SDL_blendline.h"
 #include "SDL_blendpoint.h"
 
@@ -793,6 +794,49 @@ static BlendLineFunc SDL_CalculateBlendLineFunc(const SDL_PixelFormat *fmt)
     return NULL;
 }
 
+/* Horizontal and vertical lines are blended as rects one pixel thick, so
+   they get the SIMD spans of SDL_BlendFillRectSIMD() */
+static SDL_bool SDL_BlendLineSIMD(SDL_Surface *dst, int x1, int y1, int x2, int y2,
+                                  SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a,
+                                  SDL_bool draw_end)
+{
+    SDL_Rect rect;
+
+    if (y1 == y2) {
+        rect.x = SDL_min(x1, x2);
+        rect.y = y1;
+        rect.w = SDL_abs(x2 - x1);
+        rect.h = 1;
+        if (draw_end) {
+            ++rect.w;
+        } else if (x1 > x2) {
+            ++rect.x;
+        }
+    } else if (x1 == x2) {
+        rect.x = x1;
+        rect.y = SDL_min(y1, y2);
+        rect.w = 1;
+        rect.h = SDL_abs(y2 - y1);
+        if (draw_end) {
+            ++rect.h;
+        } else if (y1 > y2) {
+            ++rect.y;
+        }
+    } else {
+        return SDL_FALSE;
+    }
+    if (SDL_RectEmpty(&rect)) {
+        return SDL_TRUE;
+    }
+
+    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
+        r = DRAW_MUL(r, a);
+        g = DRAW_MUL(g, a);
+        b = DRAW_MUL(b, a);
+    }
+    return SDL_BlendFillRectSIMD(dst, &rect, blendMode, r, g, b, a);
+}
+
 int SDL_BlendLine(SDL_Surface *dst, int x1, int y1, int x2, int y2,
                   SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
@@ -813,6 +857,9 @@ int SDL_BlendLine(SDL_Surface *dst, int x1, int y1, int x2, int y2,
         return 0;
     }
 
+    if (SDL_BlendLineSIMD(dst, x1, y1, x2, y2, blendMode, r, g, b, a, SDL_TRUE)) {
+        return 0;
+    }
     func(dst, x1, y1, x2, y2, blendMode, r, g, b, a, SDL_TRUE);
     return 0;
 }
@@ -850,6 +897,9 @@ int SDL_BlendLines(SDL_Surface *dst, const SDL_Point *points, int count,
         /* Draw the end if it was clipped */
         draw_end = (x2 != points[i].x || y2 != points[i].y);
 
+        if (SDL_BlendLineSIMD(dst, x1, y1, x2, y2, blendMode, r, g, b, a, draw_end)) {
+            continue;
+        }
         func(dst, x1, y1, x2, y2, blendMode, r, g, b, a, draw_end);
     }
     if (points[0].x != points[count - 1].x || points[0].y != points[count - 1].y) {
@@ -34,9 +34,18 @@
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
 #include "SDL_triangle.h"
+#include "../../video/SDL_pixels_c.h"
+#include "../../video/SDL_region_c.h"
 
 /* SDL surface based renderer implementation */
 
+/* Damage rects are collected while running the command queue and merged
+   into the damage region in batches, which is simplified to a few rects
+   for the window update when presenting. */
+#define SW_MAX_PENDING_DAMAGE 256
+#define SW_MAX_DAMAGE_BOXES   64
+#define SW_MAX_PRESENT_RECTS  16
+
 typedef struct
 {
     const SDL_Rect *viewport;
@@ -48,8 +57,52 @@ typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    /* What changed in the window surface since the last present */
+    SDL_bool damage_all;
+    SDL_Region damage;
+    SDL_Rect pending_damage[SW_MAX_PENDING_DAMAGE];
+    int num_pending_damage;
 } SW_RenderData;
 
+static void SW_FlushDamage(SW_RenderData *data)
+{
+    if (data->num_pending_damage == 0) {
+        return;
+    }
+    if (SDL_UnionRegionRects(&data->damage, data->pending_damage, data->num_pending_damage) < 0 ||
+        SDL_SimplifyRegion(&data->damage, SW_MAX_DAMAGE_BOXES) < 0) {
+        data->damage_all = SDL_TRUE;
+    }
+    data->num_pending_damage = 0;
+}
+
+static void SW_AddDamage(SW_RenderData *data, SDL_Surface *surface, const SDL_Rect *rect)
+{
+    if (surface != data->window || data->damage_all) {
+        return;
+    }
+    if (data->num_pending_damage == SW_MAX_PENDING_DAMAGE) {
+        SW_FlushDamage(data);
+    }
+    if (SDL_IntersectRect(rect, &surface->clip_rect, &data->pending_damage[data->num_pending_damage])) {
+        ++data->num_pending_damage;
+    }
+}
+
+static void SW_AddPointsDamage(SW_RenderData *data, SDL_Surface *surface, const SDL_Point *points, int count)
+{
+    SDL_Rect rect;
+
+    if (surface != data->window || data->damage_all) {
+        return;
+    }
+    /* Lines include their end points, so both behave the same */
+    if (SDL_EnclosePoints(points, count, NULL, &rect)) {
+        SW_AddDamage(data, surface, &rect);
+    }
+}
+
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
 {
     SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
@@ -74,6 +127,18 @@ static void SW_WindowEvent(SDL_Renderer *renderer, const SDL_WindowEvent *event)
         data->surface = NULL;
         data->window = NULL;
     }
+
+    /* The window system may have lost what was presented before */
+    switch (event->event) {
+    case SDL_WINDOWEVENT_SIZE_CHANGED:
+    case SDL_WINDOWEVENT_SHOWN:
+    case SDL_WINDOWEVENT_EXPOSED:
+    case SDL_WINDOWEVENT_RESTORED:
+        data->damage_all = SDL_TRUE;
+        break;
+    default:
+        break;
+    }
 }
 
 static int SW_GetOutputSize(SDL_Renderer *renderer, int *w, int *h)
@@ -309,6 +374,51 @@ static int Blit_to_Screen(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *surf
     return retval;
 }
 
+static void SW_AddCopyExDamage(SW_RenderData *data, SDL_Surface *surface, const CopyExData *copydata)
+{
+    SDL_Rect rect;
+    double cangle, sangle;
+
+    if (surface != data->window || data->damage_all) {
+        return;
+    }
+
+    /* This is where SW_RenderCopyEx() blits the rotated texture to */
+    SDLgfx_rotozoomSurfaceSizeTrig(copydata->dstrect.w, copydata->dstrect.h, copydata->angle, &copydata->center,
+                                   &rect, &cangle, &sangle);
+    rect.x += copydata->dstrect.x;
+    rect.y += copydata->dstrect.y;
+    if (copydata->scale_x != 1.0f || copydata->scale_y != 1.0f) {
+        rect.x = (int)((float)rect.x * copydata->scale_x);
+        rect.y = (int)((float)rect.y * copydata->scale_y);
+        rect.w = (int)((float)rect.w * copydata->scale_x);
+        rect.h = (int)((float)rect.h * copydata->scale_y);
+    }
+    SW_AddDamage(data, surface, &rect);
+}
+
+static void SW_AddGeometryDamage(SW_RenderData *data, SDL_Surface *surface, const SDL_Point *dst, size_t stride, int count)
+{
+    SDL_Point min, max;
+    SDL_Rect rect;
+    int i;
+
+    if (surface != data->window || data->damage_all || count <= 0) {
+        return;
+    }
+
+    min = max = *dst;
+    for (i = 1; i < count; i++) {
+        dst = (const SDL_Point *)((const Uint8 *)dst + stride);
+        min.x = SDL_min(min.x, dst->x);
+        min.y = SDL_min(min.y, dst->y);
+        max.x = SDL_max(max.x, dst->x);
+        max.y = SDL_max(max.y, dst->y);
+    }
+    fixedpoint_bounding_rect(&min, &max, &rect);
+    SW_AddDamage(data, surface, &rect);
+}
+
 static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Texture *texture,
                            const SDL_Rect *srcrect, const SDL_Rect *final_rect,
                            const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip, float scale_x, float scale_y)
@@ -658,14 +768,62 @@ static void SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
     }
 }
 
+#if SDL_HAVE_YUV
+/* Convert and scale srcrect of a YUV texture into dstrect in one pass */
+static int SW_RenderCopyYUV(SDL_Surface *surface, SDL_Texture *texture, const SDL_Rect *srcrect, const SDL_Rect *dstrect)
+{
+    const Uint32 format = SDL_ISPIXELFORMAT_INDEXED(surface->format->format) ? SDL_PIXELFORMAT_ARGB8888 : surface->format->format;
+    SDL_Surface *tmp;
+    SDL_Rect clipped;
+    int retval;
+
+    if (!SDL_IntersectRect(dstrect, &surface->clip_rect, &clipped)) {
+        return 0;
+    }
+
+    if (format == surface->format->format && SDL_RectEquals(&clipped, dstrect)) {
+        /* All of it is visible, so write it straight into the surface */
+        if (SDL_LockSurface(surface) < 0) {
+            return -1;
+        }
+        retval = SDL_SW_CopyYUVToRGB(texture->yuv, srcrect, format, dstrect->w, dstrect->h,
+                                     (Uint8 *)surface->pixels + dstrect->y * surface->pitch + dstrect->x * surface->format->BytesPerPixel,
+                                     surface->pitch, texture->scaleMode);
+        SDL_UnlockSurface(surface);
+        return retval;
+    }
+
+    /* Scale to an intermediate surface, then blit the visible part, so the
+       clipping doesn't change which source pixels are sampled */
+    tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h, 0, format);
+    if (tmp == NULL) {
+        return -1;
+    }
+    retval = SDL_SW_CopyYUVToRGB(texture->yuv, srcrect, format, dstrect->w, dstrect->h,
+                                 tmp->pixels, tmp->pitch, texture->scaleMode);
+    if (retval == 0) {
+        SDL_Rect r = *dstrect;
+
+        SDL_SetSurfaceBlendMode(tmp, SDL_BLENDMODE_NONE);
+        retval = SDL_BlitSurface(tmp, NULL, surface, &r);
+    }
+    SDL_FreeSurface(tmp);
+    return retval;
+}
+#endif /* SDL_HAVE_YUV */
+
 static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
 
     if (surface == NULL) {
         return -1;
     }
+    if (SDL_UnshareSurfacePixels(surface) < 0) {
+        return -1;
+    }
 
     drawstate.viewport = NULL;
     drawstate.cliprect = NULL;
@@ -698,6 +856,9 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                 SDL_SetClipRect(surface, NULL);
                 SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
                 drawstate.surface_cliprect_dirty = SDL_TRUE;
+                if (surface == data->window) {
+                    data->damage_all = SDL_TRUE;
+                }
                 break;
             }
 
@@ -720,6 +881,8 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                     }
                 }
 
+                SW_AddPointsDamage(data, surface, verts, count);
+
                 if (blend == SDL_BLENDMODE_NONE) {
                     SDL_DrawPoints(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
                 } else {
@@ -747,6 +910,8 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                     }
                 }
 
+                SW_AddPointsDamage(data, surface, verts, count);
+
                 if (blend == SDL_BLENDMODE_NONE) {
                     SDL_DrawLines(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
                 } else {
@@ -774,6 +939,13 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                     }
                 }
 
+                if (surface == data->window && !data->damage_all) {
+                    int i;
+                    for (i = 0; i < count; i++) {
+                        SW_AddDamage(data, surface, &verts[i]);
+                    }
+                }
+
                 if (blend == SDL_BLENDMODE_NONE) {
                     SDL_FillRects(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
                 } else {
@@ -783,65 +955,120 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
             }
 
             case SDL_RENDERCMD_COPY: {
-                SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_Rect *srcrect = verts;
-                SDL_Rect *dstrect = verts + 1;
+                /* as long as we have the same copy command in a row, with the
+                   same texture and color/alpha/blend mods, the surface state
+                   only has to be set up once for all of them. */
                 SDL_Texture *texture = cmd->data.draw.texture;
                 SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+                SDL_RenderCommand *finalcmd = cmd;
+                SDL_RenderCommand *nextcmd = cmd->next;
+
+#if SDL_HAVE_YUV
+                if (texture->yuv) {
+                    /* Only scaled copies of YUV textures get here, see SDL_CanScaleYUVTexture() */
+                    SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                    SDL_Rect *dstrect = verts + 1;
+
+                    SetDrawState(surface, &drawstate);
+
+                    /* Apply viewport */
+                    if (drawstate.viewport != NULL && (drawstate.viewport->x || drawstate.viewport->y)) {
+                        dstrect->x += drawstate.viewport->x;
+                        dstrect->y += drawstate.viewport->y;
+                    }
+
+                    SW_AddDamage(data, surface, dstrect);
+
+                    SW_RenderCopyYUV(surface, texture, verts, dstrect);
+                    break;
+                }
+#endif
+
+                while (nextcmd != NULL) {
+                    if (nextcmd->command != SDL_RENDERCMD_COPY) {
+                        break; /* can't go any further on this batch, different render command up next. */
+                    } else if (nextcmd->data.draw.texture != texture ||
+                               nextcmd->data.draw.blend != cmd->data.draw.blend ||
+                               nextcmd->data.draw.r != cmd->data.draw.r ||
+                               nextcmd->data.draw.g != cmd->data.draw.g ||
+                               nextcmd->data.draw.b != cmd->data.draw.b ||
+                               nextcmd->data.draw.a != cmd->data.draw.a) {
+                        break; /* can't go any further on this batch, different texture/mods up next. */
+                    }
+                    finalcmd = nextcmd; /* we can combine copy operations here. Mark this one as the furthest okay command. */
+                    nextcmd = nextcmd->next;
+                }
 
                 SetDrawState(surface, &drawstate);
 
                 PrepTextureForCopy(cmd);
 
-                /* Apply viewport */
-                if (drawstate.viewport != NULL && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    dstrect->x += drawstate.viewport->x;
-                    dstrect->y += drawstate.viewport->y;
-                }
+                for (;;) {
+                    SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                    const SDL_Rect *srcrect = verts;
+                    SDL_Rect *dstrect = verts + 1;
 
-                if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
-                    SDL_BlitSurface(src, srcrect, surface, dstrect);
-                } else {
-                    /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
-                     * to avoid potentially frequent RLE encoding/decoding.
-                     */
-                    SDL_SetSurfaceRLE(surface, 0);
-
-                    /* Prevent to do scaling + clipping on viewport boundaries as it may lose proportion */
-                    if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
-                        SDL_Surface *tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h, 0, src->format->format);
-                        /* Scale to an intermediate surface, then blit */
-                        if (tmp) {
-                            SDL_Rect r;
-                            SDL_BlendMode blendmode;
-                            Uint8 alphaMod, rMod, gMod, bMod;
-
-                            SDL_GetSurfaceBlendMode(src, &blendmode);
-                            SDL_GetSurfaceAlphaMod(src, &alphaMod);
-                            SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
-
-                            r.x = 0;
-                            r.y = 0;
-                            r.w = dstrect->w;
-                            r.h = dstrect->h;
-
-                            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
-                            SDL_SetSurfaceColorMod(src, 255, 255, 255);
-                            SDL_SetSurfaceAlphaMod(src, 255);
-
-                            SDL_PrivateUpperBlitScaled(src, srcrect, tmp, &r, texture->scaleMode);
-
-                            SDL_SetSurfaceColorMod(tmp, rMod, gMod, bMod);
-                            SDL_SetSurfaceAlphaMod(tmp, alphaMod);
-                            SDL_SetSurfaceBlendMode(tmp, blendmode);
-
-                            SDL_BlitSurface(tmp, NULL, surface, dstrect);
-                            SDL_FreeSurface(tmp);
-                            /* No need to set back r/g/b/a/blendmode to 'src' since it's done in PrepTextureForCopy() */
+                    /* Apply viewport */
+                    if (drawstate.viewport != NULL && (drawstate.viewport->x || drawstate.viewport->y)) {
+                        dstrect->x += drawstate.viewport->x;
+                        dstrect->y += drawstate.viewport->y;
+                    }
+
+                    SW_AddDamage(data, surface, dstrect);
+
+                    if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
+                        SDL_BlitSurface(src, srcrect, surface, dstrect);
+                    } else {
+                        /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
+                         * to avoid potentially frequent RLE encoding/decoding.
+                         */
+                        SDL_SetSurfaceRLE(surface, 0);
+
+                        /* Prevent to do scaling + clipping on viewport boundaries as it may lose proportion */
+                        if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
+                            SDL_Surface *tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h, 0, src->format->format);
+                            /* Scale to an intermediate surface, then blit */
+                            if (tmp) {
+                                SDL_Rect r;
+                                SDL_BlendMode blendmode;
+                                Uint8 alphaMod, rMod, gMod, bMod;
+
+                                SDL_GetSurfaceBlendMode(src, &blendmode);
+                                SDL_GetSurfaceAlphaMod(src, &alphaMod);
+                                SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
+
+                                r.x = 0;
+                                r.y = 0;
+                                r.w = dstrect->w;
+                                r.h = dstrect->h;
+
+                                SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+                                SDL_SetSurfaceColorMod(src, 255, 255, 255);
+                                SDL_SetSurfaceAlphaMod(src, 255);
+
+                                SDL_PrivateUpperBlitScaled(src, srcrect, tmp, &r, texture->scaleMode);
+
+                                SDL_SetSurfaceColorMod(tmp, rMod, gMod, bMod);
+                                SDL_SetSurfaceAlphaMod(tmp, alphaMod);
+                                SDL_SetSurfaceBlendMode(tmp, blendmode);
+
+                                SDL_BlitSurface(tmp, NULL, surface, dstrect);
+                                SDL_FreeSurface(tmp);
+
+                                /* Set back r/g/b/a/blendmode to 'src' for the rest of the batch */
+                                SDL_SetSurfaceColorMod(src, rMod, gMod, bMod);
+                                SDL_SetSurfaceAlphaMod(src, alphaMod);
+                                SDL_SetSurfaceBlendMode(src, blendmode);
+                            }
+                        } else{
+                            SDL_PrivateUpperBlitScaled(src, srcrect, surface, dstrect, texture->scaleMode);
                         }
-                    } else{
-                        SDL_PrivateUpperBlitScaled(src, srcrect, surface, dstrect, texture->scaleMode);
                     }
+
+                    if (cmd == finalcmd) {
+                        break;
+                    }
+                    cmd = cmd->next;
                 }
                 break;
             }
@@ -857,6 +1084,8 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                     copydata->dstrect.y += drawstate.viewport->y;
                 }
 
+                SW_AddCopyExDamage(data, surface, copydata);
+
                 SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
                                 &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
                                 copydata->scale_x, copydata->scale_y);
@@ -891,6 +1120,8 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                         }
                     }
 
+                    SW_AddGeometryDamage(data, surface, &ptr->dst, sizeof(*ptr), count);
+
                     for (i = 0; i < count; i += 3, ptr += 3) {
                         SDL_SW_BlitTriangle(
                                 src,
@@ -914,6 +1145,8 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                         }
                     }
 
+                    SW_AddGeometryDamage(data, surface, &ptr->dst, sizeof(*ptr), count);
+
                     for (i = 0; i < count; i += 3, ptr += 3) {
                         SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
                     }
@@ -963,12 +1196,29 @@ static int SW_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
 
 static int SW_RenderPresent(SDL_Renderer *renderer)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Window *window = renderer->window;
+    SDL_Rect rects[SW_MAX_PRESENT_RECTS];
+    int numrects, retval;
 
     if (window == NULL) {
         return -1;
     }
-    return SDL_UpdateWindowSurface(window);
+
+    /* Only update the parts of the window that were drawn to */
+    SW_FlushDamage(data);
+    if (!data->damage_all && SDL_SimplifyRegion(&data->damage, SW_MAX_PRESENT_RECTS) < 0) {
+        data->damage_all = SDL_TRUE;
+    }
+    if (data->damage_all) {
+        retval = SDL_UpdateWindowSurface(window);
+    } else {
+        numrects = SDL_GetRegionRects(&data->damage, rects, SDL_arraysize(rects));
+        retval = SDL_UpdateWindowSurfaceRects(window, rects, numrects);
+    }
+    data->damage_all = SDL_FALSE;
+    SDL_ClearRegion(&data->damage);
+    return retval;
 }
 
 static void SW_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
@@ -982,6 +1232,9 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
 {
     SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
 
+    if (data) {
+        SDL_FreeRegion(&data->damage);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -1011,6 +1264,8 @@ SW_CreateRendererForSurface(SDL_Surface *surface)
     }
     data->surface = surface;
     data->window = surface;
+    data->damage_all = SDL_TRUE;
+    SDL_InitRegion(&data->damage);
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -1035,6 +1290,7 @@ SW_CreateRendererForSurface(SDL_Surface *surface)
     renderer->DestroyRenderer = SW_DestroyRenderer;
     renderer->info = SW_RenderDriver.info;
     renderer->driverdata = data;
+    renderer->scale_yuv_textures = SDL_TRUE;
 
     SW_ActivateRenderer(renderer);
 
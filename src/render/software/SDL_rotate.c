@@ -42,6 +42,8 @@ Andreas Schiffler -- aschiffler at ferzkopp dot net
 #include "SDL.h"
 #include "SDL_rotate.h"
 
+#include "../../video/SDL_blit_rotate.h"
+
 /* ---- Internally used structures */
 
 /* !
@@ -173,82 +175,19 @@ void SDLgfx_rotozoomSurfaceSizeTrig(int width, int height, double angle, const S
     }
 }
 
-/* Computes source pointer X/Y increments for a rotation that's a multiple of 90 degrees. */
-static void computeSourceIncrements90(SDL_Surface *src, int bpp, int angle, int flipx, int flipy,
-                                      int *sincx, int *sincy, int *signx, int *signy)
-{
-    int pitch = flipy ? -src->pitch : src->pitch;
-    if (flipx) {
-        bpp = -bpp;
-    }
-    switch (angle) { /* 0:0 deg, 1:90 deg, 2:180 deg, 3:270 deg */
-    case 0:
-        *sincx = bpp;
-        *sincy = pitch - src->w * *sincx;
-        *signx = *signy = 1;
-        break;
-    case 1:
-        *sincx = -pitch;
-        *sincy = bpp - *sincx * src->h;
-        *signx = 1;
-        *signy = -1;
-        break;
-    case 2:
-        *sincx = -bpp;
-        *sincy = -src->w * *sincx - pitch;
-        *signx = *signy = -1;
-        break;
-    case 3:
-    default:
-        *sincx = pitch;
-        *sincy = -*sincx * src->h - bpp;
-        *signx = -1;
-        *signy = 1;
-        break;
-    }
-    if (flipx) {
-        *signx = -*signx;
-    }
-    if (flipy) {
-        *signy = -*signy;
-    }
-}
-
-/* Performs a relatively fast rotation/flip when the angle is a multiple of 90 degrees. */
-#define TRANSFORM_SURFACE_90(pixelType)                                                                     \
-    int dy, dincy = dst->pitch - dst->w * sizeof(pixelType), sincx, sincy, signx, signy;                    \
-    Uint8 *sp = (Uint8 *)src->pixels, *dp = (Uint8 *)dst->pixels, *de;                                      \
-                                                                                                            \
-    computeSourceIncrements90(src, sizeof(pixelType), angle, flipx, flipy, &sincx, &sincy, &signx, &signy); \
-    if (signx < 0)                                                                                          \
-        sp += (src->w - 1) * sizeof(pixelType);                                                             \
-    if (signy < 0)                                                                                          \
-        sp += (src->h - 1) * src->pitch;                                                                    \
-                                                                                                            \
-    for (dy = 0; dy < dst->h; sp += sincy, dp += dincy, dy++) {                                             \
-        if (sincx == sizeof(pixelType)) { /* if advancing src and dest equally, use SDL_memcpy */           \
-            SDL_memcpy(dp, sp, dst->w * sizeof(pixelType));                                                 \
-            sp += dst->w * sizeof(pixelType);                                                               \
-            dp += dst->w * sizeof(pixelType);                                                               \
-        } else {                                                                                            \
-            for (de = dp + dst->w * sizeof(pixelType); dp != de; sp += sincx, dp += sizeof(pixelType)) {    \
-                *(pixelType *)dp = *(pixelType *)sp;                                                        \
-            }                                                                                               \
-        }                                                                                                   \
-    }
-
+/* Performs a fast rotation/flip when the angle is a multiple of 90 degrees. */
 static void transformSurfaceRGBA90(SDL_Surface *src, SDL_Surface *dst, int angle, int flipx, int flipy)
 {
-    TRANSFORM_SURFACE_90(tColorRGBA);
+    SDL_BlitRotate90(src->pixels, src->pitch, dst->pixels, dst->pitch, src->w, src->h,
+                     sizeof(tColorRGBA), angle, flipx ? SDL_TRUE : SDL_FALSE, flipy ? SDL_TRUE : SDL_FALSE);
 }
 
 static void transformSurfaceY90(SDL_Surface *src, SDL_Surface *dst, int angle, int flipx, int flipy)
 {
-    TRANSFORM_SURFACE_90(tColorY);
+    SDL_BlitRotate90(src->pixels, src->pitch, dst->pixels, dst->pitch, src->w, src->h,
+                     sizeof(tColorY), angle, flipx ? SDL_TRUE : SDL_FALSE, flipy ? SDL_TRUE : SDL_FALSE);
 }
 
-#undef TRANSFORM_SURFACE_90
-
 /* !
 \brief Internal 32 bit rotozoomer with optional anti-aliasing.
 
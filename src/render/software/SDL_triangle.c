@@ -119,6 +119,15 @@ void trianglepoint_2_fixedpoint(SDL_Point *a)
     a->y <<= FP_BITS;
 }
 
+/* rect covering every pixel touched between two corners (in fixed point) */
+void fixedpoint_bounding_rect(const SDL_Point *min, const SDL_Point *max, SDL_Rect *r)
+{
+    r->x = min->x >> FP_BITS;
+    r->y = min->y >> FP_BITS;
+    r->w = (max->x >> FP_BITS) - r->x + 1;
+    r->h = (max->y >> FP_BITS) - r->y + 1;
+}
+
 /* bounding rect of three points (in fixed point) */
 static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, const SDL_Point *c, SDL_Rect *r)
 {
@@ -36,6 +36,7 @@ extern int SDL_SW_BlitTriangle(
     SDL_Color c0, SDL_Color c1, SDL_Color c2);
 
 extern void trianglepoint_2_fixedpoint(SDL_Point *a);
+extern void fixedpoint_bounding_rect(const SDL_Point *min, const SDL_Point *max, SDL_Rect *r);
 
 #endif /* SDL_triangle_h_ */
 
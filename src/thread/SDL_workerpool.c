@@ -0,0 +1,211 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* A pool of threads that parts of SDL can split work across */
+
+#include "SDL_thread.h"
+#include "SDL_systhread.h"
+#include "SDL_workerpool_c.h"
+
+#if !SDL_THREADS_DISABLED
+
+/* The most threads the pool will start, besides the calling thread */
+#define SDL_MAX_WORKER_THREADS 63
+
+typedef struct SDL_WorkerJob
+{
+    SDL_WorkerFunc func;
+    void *data;
+    int count;
+    SDL_atomic_t next;
+} SDL_WorkerJob;
+
+typedef struct SDL_WorkerPool
+{
+    SDL_mutex *lock;     /* protects everything below */
+    SDL_cond *wake;      /* a job was posted, or the pool is shutting down */
+    SDL_cond *idle;      /* a worker finished its part of the job */
+    SDL_Thread *threads[SDL_MAX_WORKER_THREADS];
+    int num_threads;
+    SDL_WorkerJob *job;
+    int free_slots; /* how many more workers may join the job */
+    int active;     /* how many workers are running the job */
+    SDL_bool quit;
+    SDL_atomic_t busy; /* set while a thread is running a job */
+} SDL_WorkerPool;
+
+static SDL_WorkerPool SDL_worker_pool;
+static SDL_SpinLock SDL_worker_pool_lock = 0;
+
+static void SDL_RunWorkerJob(SDL_WorkerJob *job)
+{
+    int index;
+
+    while ((index = SDL_AtomicAdd(&job->next, 1)) < job->count) {
+        job->func(job->data, index);
+    }
+}
+
+static int SDLCALL SDL_WorkerThread(void *data)
+{
+    SDL_WorkerPool *pool = (SDL_WorkerPool *)data;
+
+    SDL_LockMutex(pool->lock);
+    for (;;) {
+        SDL_WorkerJob *job;
+
+        while (!pool->quit && (pool->job == NULL || pool->free_slots == 0)) {
+            SDL_CondWait(pool->wake, pool->lock);
+        }
+        if (pool->quit) {
+            break;
+        }
+        job = pool->job;
+        --pool->free_slots;
+        ++pool->active;
+        SDL_UnlockMutex(pool->lock);
+
+        SDL_RunWorkerJob(job);
+
+        SDL_LockMutex(pool->lock);
+        if (--pool->active == 0) {
+            SDL_CondSignal(pool->idle);
+        }
+    }
+    SDL_UnlockMutex(pool->lock);
+    return 0;
+}
+
+static SDL_bool SDL_InitWorkerPool(SDL_WorkerPool *pool)
+{
+    SDL_bool retval;
+
+    SDL_AtomicLock(&SDL_worker_pool_lock);
+    if (pool->lock == NULL) {
+        pool->lock = SDL_CreateMutex();
+        pool->wake = SDL_CreateCond();
+        pool->idle = SDL_CreateCond();
+        if (!pool->lock || !pool->wake || !pool->idle) {
+            SDL_DestroyMutex(pool->lock);
+            SDL_DestroyCond(pool->wake);
+            SDL_DestroyCond(pool->idle);
+            SDL_zerop(pool);
+        }
+    }
+    retval = (pool->lock != NULL);
+    SDL_AtomicUnlock(&SDL_worker_pool_lock);
+    return retval;
+}
+
+void SDL_RunOnWorkers(SDL_WorkerFunc func, void *data, int count, int num_threads)
+{
+    SDL_WorkerPool *pool = &SDL_worker_pool;
+    SDL_WorkerJob job;
+    int workers, i;
+
+    /* Only one job runs at a time. If another thread is using the pool,
+       or a job is calling back in, just do the work here. */
+    num_threads = SDL_min(num_threads, count);
+    if (num_threads <= 1 || !SDL_InitWorkerPool(pool) || !SDL_AtomicCAS(&pool->busy, 0, 1)) {
+        for (i = 0; i < count; ++i) {
+            func(data, i);
+        }
+        return;
+    }
+
+    job.func = func;
+    job.data = data;
+    job.count = count;
+    SDL_AtomicSet(&job.next, 0);
+
+    /* The calling thread is one of the workers */
+    workers = SDL_min(num_threads - 1, SDL_MAX_WORKER_THREADS);
+
+    SDL_LockMutex(pool->lock);
+    while (pool->num_threads < workers) {
+        SDL_Thread *thread = SDL_CreateThreadInternal(SDL_WorkerThread, "SDLWorker", 0, pool);
+        if (thread == NULL) {
+            break;
+        }
+        pool->threads[pool->num_threads++] = thread;
+    }
+    pool->job = &job;
+    pool->free_slots = workers;
+    SDL_CondBroadcast(pool->wake);
+    SDL_UnlockMutex(pool->lock);
+
+    SDL_RunWorkerJob(&job);
+
+    /* Every part has been picked up, wait for the workers still running one */
+    SDL_LockMutex(pool->lock);
+    pool->job = NULL;
+    pool->free_slots = 0;
+    while (pool->active > 0) {
+        SDL_CondWait(pool->idle, pool->lock);
+    }
+    SDL_UnlockMutex(pool->lock);
+
+    SDL_AtomicSet(&pool->busy, 0);
+}
+
+void SDL_QuitWorkerPool(void)
+{
+    SDL_WorkerPool *pool = &SDL_worker_pool;
+    int i;
+
+    if (pool->lock == NULL) {
+        return;
+    }
+
+    SDL_LockMutex(pool->lock);
+    pool->quit = SDL_TRUE;
+    SDL_CondBroadcast(pool->wake);
+    SDL_UnlockMutex(pool->lock);
+
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+
+    SDL_DestroyMutex(pool->lock);
+    SDL_DestroyCond(pool->wake);
+    SDL_DestroyCond(pool->idle);
+    SDL_zerop(pool);
+}
+
+#else
+
+void SDL_RunOnWorkers(SDL_WorkerFunc func, void *data, int count, int num_threads)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        func(data, i);
+    }
+}
+
+void SDL_QuitWorkerPool(void)
+{
+}
+
+#endif /* !SDL_THREADS_DISABLED */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,39 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef SDL_workerpool_c_h_
+#define SDL_workerpool_c_h_
+
+typedef void (SDLCALL *SDL_WorkerFunc)(void *data, int index);
+
+/* Call func for each index from 0 to count - 1, spread across up to
+   num_threads threads including the calling one, and return once all
+   of them are done. Falls back to running everything on the calling
+   thread if the pool is busy or threads aren't available. */
+extern void SDL_RunOnWorkers(SDL_WorkerFunc func, void *data, int count, int num_threads);
+
+/* Stop the pool threads, called from SDL_Quit() */
+extern void SDL_QuitWorkerPool(void);
+
+#endif /* SDL_workerpool_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -20,6 +20,8 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_hints.h"
+#include "SDL_timer.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -28,6 +30,182 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../SDL_hints_c.h"
+
+/* Optional per-blitter statistics, enabled with SDL_HINT_BLIT_STATS */
+#define BLIT_STATS_SIZE 128
+
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    Uint32 flags;
+    SDL_BlitFunc blit;
+    Uint64 calls;
+    Uint64 pixels;
+    Uint64 ticks;
+} SDL_BlitStatsEntry;
+
+static SDL_BlitStatsEntry blit_stats[BLIT_STATS_SIZE];
+static Uint64 blit_stats_dropped = 0;
+static SDL_SpinLock blit_stats_lock = 0;
+static SDL_bool blit_stats_enabled = SDL_FALSE;
+static SDL_bool blit_stats_watching = SDL_FALSE;
+
+static void SDL_RecordBlitStats(const SDL_BlitInfo *info, SDL_BlitFunc blit, Uint64 pixels, Uint64 ticks)
+{
+    const Uint32 src_format = info->src_fmt->format;
+    const Uint32 dst_format = info->dst_fmt->format;
+    const Uint32 flags = info->flags & ~SDL_COPY_RLE_DESIRED;
+    Uint32 hash;
+    int i, slot;
+
+    hash = src_format;
+    hash = hash * 31 + dst_format;
+    hash = hash * 31 + flags;
+    hash ^= hash >> 16;
+    slot = (int)(hash % BLIT_STATS_SIZE);
+
+    SDL_AtomicLock(&blit_stats_lock);
+    for (i = 0; i < BLIT_STATS_SIZE; ++i) {
+        SDL_BlitStatsEntry *entry = &blit_stats[(slot + i) % BLIT_STATS_SIZE];
+        if (entry->blit == NULL) {
+            entry->src_format = src_format;
+            entry->dst_format = dst_format;
+            entry->flags = flags;
+            entry->blit = blit;
+        } else if (entry->blit != blit ||
+                   entry->src_format != src_format ||
+                   entry->dst_format != dst_format ||
+                   entry->flags != flags) {
+            continue;
+        }
+        entry->calls++;
+        entry->pixels += pixels;
+        entry->ticks += ticks;
+        break;
+    }
+    if (i == BLIT_STATS_SIZE) {
+        ++blit_stats_dropped;
+    }
+    SDL_AtomicUnlock(&blit_stats_lock);
+}
+
+static const char *SDL_GetBlitFuncName(SDL_BlitFunc blit)
+{
+    if (blit == SDL_Blit_Slow) {
+        return "SDL_Blit_Slow";
+    }
+    if (blit == SDL_BlitCopy) {
+        return "SDL_BlitCopy";
+    }
+#if SDL_HAVE_BLIT_AUTO
+    {
+        const SDL_BlitFuncEntry *entry;
+
+        for (entry = SDL_GeneratedBlitFuncTable; entry->func; ++entry) {
+            if (entry->func == blit) {
+                if (entry->cpu & SDL_CPU_AVX2) {
+                    return "generated AVX2";
+                } else if (entry->cpu & SDL_CPU_SSE2) {
+                    return "generated SSE2";
+                } else if (entry->cpu & SDL_CPU_NEON) {
+                    return "generated NEON";
+                }
+                return "generated";
+            }
+        }
+    }
+#endif
+    return "specialized";
+}
+
+static int SDLCALL SDL_CompareBlitStats(const void *a, const void *b)
+{
+    const SDL_BlitStatsEntry *A = (const SDL_BlitStatsEntry *)a;
+    const SDL_BlitStatsEntry *B = (const SDL_BlitStatsEntry *)b;
+
+    if (A->ticks != B->ticks) {
+        return (A->ticks > B->ticks) ? -1 : 1;
+    }
+    if (A->pixels != B->pixels) {
+        return (A->pixels > B->pixels) ? -1 : 1;
+    }
+    return 0;
+}
+
+/* Log the collected statistics, most expensive blitters first, and reset them */
+static void SDL_DumpBlitStats(void)
+{
+    SDL_BlitStatsEntry *entries;
+    Uint64 dropped;
+    double frequency;
+    int i, count = 0;
+
+    entries = (SDL_BlitStatsEntry *)SDL_malloc(sizeof(blit_stats));
+    if (entries == NULL) {
+        return;
+    }
+
+    SDL_AtomicLock(&blit_stats_lock);
+    for (i = 0; i < BLIT_STATS_SIZE; ++i) {
+        if (blit_stats[i].blit) {
+            entries[count++] = blit_stats[i];
+        }
+    }
+    dropped = blit_stats_dropped;
+    SDL_zeroa(blit_stats);
+    blit_stats_dropped = 0;
+    SDL_AtomicUnlock(&blit_stats_lock);
+
+    if (count > 0) {
+        frequency = (double)SDL_GetPerformanceFrequency();
+        SDL_qsort(entries, count, sizeof(*entries), SDL_CompareBlitStats);
+
+        SDL_Log("Blit statistics:");
+        for (i = 0; i < count; ++i) {
+            const SDL_BlitStatsEntry *entry = &entries[i];
+            const double ms = (double)entry->ticks * 1000.0 / frequency;
+
+            SDL_Log("  %s -> %s, flags 0x%x: %s (%p), %" SDL_PRIu64 " calls, %" SDL_PRIu64 " pixels, %.3f ms, %.2f Mpixels/s",
+                        SDL_GetPixelFormatName(entry->src_format), SDL_GetPixelFormatName(entry->dst_format), entry->flags,
+                        SDL_GetBlitFuncName(entry->blit), (void *)entry->blit,
+                        entry->calls, entry->pixels, ms,
+                        (ms > 0.0) ? ((double)entry->pixels / (ms * 1000.0)) : 0.0);
+        }
+        if (dropped > 0) {
+            SDL_Log("  %" SDL_PRIu64 " blits were not recorded, too many combinations", dropped);
+        }
+    }
+    SDL_free(entries);
+}
+
+static void SDLCALL SDL_BlitStatsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    blit_stats_enabled = SDL_GetStringBoolean(hint, SDL_FALSE);
+    if (!blit_stats_enabled) {
+        SDL_DumpBlitStats();
+    }
+}
+
+void SDL_InitBlitStats(void)
+{
+    if (blit_stats_watching) {
+        return;
+    }
+    blit_stats_watching = SDL_TRUE;
+    SDL_AddHintCallback(SDL_HINT_BLIT_STATS, SDL_BlitStatsChanged, NULL);
+}
+
+void SDL_QuitBlitStats(void)
+{
+    if (blit_stats_watching) {
+        SDL_DelHintCallback(SDL_HINT_BLIT_STATS, SDL_BlitStatsChanged, NULL);
+        blit_stats_watching = SDL_FALSE;
+    }
+    blit_stats_enabled = SDL_FALSE;
+    SDL_DumpBlitStats();
+}
 
 /* The general purpose software blit routine */
 static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
@@ -84,7 +262,15 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
         RunBlit = (SDL_BlitFunc)src->map->data;
 
         /* Run the actual software blit */
-        RunBlit(info);
+        if (blit_stats_enabled) {
+            const Uint64 pixels = (Uint64)info->dst_w * info->dst_h;
+            const Uint64 start = SDL_GetPerformanceCounter();
+
+            RunBlit(info);
+            SDL_RecordBlitStats(info, RunBlit, pixels, SDL_GetPerformanceCounter() - start);
+        } else {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -151,6 +337,12 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int
             if (SDL_HasSSE2()) {
                 features |= SDL_CPU_SSE2;
             }
+            if (SDL_HasAVX2()) {
+                features |= SDL_CPU_AVX2;
+            }
+            if (SDL_HasNEON()) {
+                features |= SDL_CPU_NEON;
+            }
             if (SDL_HasAltiVec()) {
                 if (SDL_UseAltivecPrefetch()) {
                     features |= SDL_CPU_ALTIVEC_PREFETCH;
@@ -188,45 +380,51 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int
 #endif /* SDL_HAVE_BLIT_AUTO */
 
 /* Figure out which of many blit routines to set up on a surface */
-int SDL_CalculateBlit(SDL_Surface *surface)
-{
-    SDL_BlitFunc blit = NULL;
-    SDL_BlitMap *map = surface->map;
-    SDL_Surface *dst = map->dst;
+/* Resolved blitters only depend on the pixel formats, the copy flags and
+   whether the mapping is an identity, so they're cached on those. This way
+   a surface switching between targets doesn't search the blitters again. */
+#define BLIT_CACHE_SIZE 64
 
-    /* We don't currently support blitting to < 8 bpp surfaces */
-    if (dst->format->BitsPerPixel < 8) {
-        SDL_InvalidateMap(map);
-        return SDL_SetError("Blit combination not supported");
-    }
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    Uint32 flags;
+    int identity;
+    SDL_BlitFunc blit;
+} SDL_BlitCacheEntry;
 
-#if SDL_HAVE_RLE
-    /* Clean everything out to start */
-    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(surface, 1);
-    }
-#endif
+static SDL_BlitCacheEntry blit_cache[BLIT_CACHE_SIZE];
+static SDL_SpinLock blit_cache_lock = 0;
 
-    map->blit = SDL_SoftBlit;
-    map->info.src_fmt = surface->format;
-    map->info.src_pitch = surface->pitch;
-    map->info.dst_fmt = dst->format;
-    map->info.dst_pitch = dst->pitch;
+static int SDL_GetBlitCacheSlot(Uint32 src_format, Uint32 dst_format, Uint32 flags, int identity)
+{
+    Uint32 hash = src_format;
+    hash = hash * 31 + dst_format;
+    hash = hash * 31 + flags;
+    hash = hash * 31 + (identity ? 1 : 0);
+    hash ^= hash >> 16;
+    return (int)(hash % BLIT_CACHE_SIZE);
+}
 
-#if SDL_HAVE_RLE
-    /* See if we can do RLE acceleration */
-    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
-        if (SDL_RLESurface(surface) == 0) {
-            return 0;
-        }
-    }
-#endif
+static SDL_BlitFunc SDL_ChooseBlit(SDL_Surface *surface)
+{
+    SDL_BlitFunc blit = NULL;
+    SDL_BlitMap *map = surface->map;
+    SDL_Surface *dst = map->dst;
 
     /* Choose a standard blit function */
     if (map->identity && !(map->info.flags & ~SDL_COPY_RLE_DESIRED)) {
         blit = SDL_BlitCopy;
     } else if (surface->format->Rloss > 8 || dst->format->Rloss > 8) {
-        blit = SDL_Blit_Slow;
+        /* The standard blitters only handle up to 8 bits per channel */
+#if SDL_HAVE_BLIT_AUTO
+        blit = SDL_ChooseBlitFunc(surface->format->format, dst->format->format,
+                                  map->info.flags, SDL_GeneratedBlitFuncTable);
+#endif
+        if (blit == NULL) {
+            blit = SDL_Blit_Slow;
+        }
     }
 #if SDL_HAVE_BLIT_0
     else if (surface->format->BitsPerPixel < 8 &&
@@ -275,6 +473,80 @@ int SDL_CalculateBlit(SDL_Surface *surface)
             blit = SDL_Blit_Slow;
         }
     }
+    return blit;
+}
+
+int SDL_CalculateBlit(SDL_Surface *surface)
+{
+    SDL_BlitFunc blit = NULL;
+    SDL_BlitMap *map = surface->map;
+    SDL_Surface *dst = map->dst;
+    Uint32 src_format, dst_format, flags;
+    int slot;
+
+    /* We don't currently support blitting to < 8 bpp surfaces */
+    if (dst->format->BitsPerPixel < 8) {
+        SDL_InvalidateMap(map);
+        return SDL_SetError("Blit combination not supported");
+    }
+
+#if SDL_HAVE_RLE
+    /* Clean everything out to start */
+    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
+        SDL_UnRLESurface(surface, 1);
+    }
+#endif
+
+    map->blit = SDL_SoftBlit;
+    map->info.src_fmt = surface->format;
+    map->info.src_pitch = surface->pitch;
+    map->info.dst_fmt = dst->format;
+    map->info.dst_pitch = dst->pitch;
+
+#if SDL_HAVE_RLE
+    /* See if we can do RLE acceleration */
+    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
+        if (SDL_RLESurface(surface) == 0) {
+            return 0;
+        }
+    }
+#endif
+
+    /* Choose a standard blit function */
+    src_format = surface->format->format;
+    dst_format = dst->format->format;
+    flags = map->info.flags & ~SDL_COPY_RLE_DESIRED;
+    slot = SDL_GetBlitCacheSlot(src_format, dst_format, flags, map->identity);
+
+    SDL_AtomicLock(&blit_cache_lock);
+    if (blit_cache[slot].blit &&
+        blit_cache[slot].src_format == src_format &&
+        blit_cache[slot].dst_format == dst_format &&
+        blit_cache[slot].flags == flags &&
+        blit_cache[slot].identity == map->identity) {
+        blit = blit_cache[slot].blit;
+    }
+    SDL_AtomicUnlock(&blit_cache_lock);
+
+    if (blit == NULL) {
+        blit = SDL_ChooseBlit(surface);
+
+        /* Report the combinations that don't have a faster blitter yet */
+        if (blit == SDL_Blit_Slow) {
+            SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Using SDL_Blit_Slow() for %s -> %s, flags 0x%x",
+                         SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format), flags);
+        }
+
+        if (blit != NULL && src_format != SDL_PIXELFORMAT_UNKNOWN && dst_format != SDL_PIXELFORMAT_UNKNOWN) {
+            SDL_AtomicLock(&blit_cache_lock);
+            blit_cache[slot].src_format = src_format;
+            blit_cache[slot].dst_format = dst_format;
+            blit_cache[slot].flags = flags;
+            blit_cache[slot].identity = map->identity;
+            blit_cache[slot].blit = blit;
+            SDL_AtomicUnlock(&blit_cache_lock);
+        }
+    }
     map->data = blit;
 
     /* Make sure we have a blit function */
@@ -33,6 +33,41 @@
 #undef SDL_ARM_NEON_BLITTERS
 #endif
 
+/* x86 intrinsics for the vectorized pixel loops. SSSE3 and AVX2 code can be
+   built with a target attribute when the compiler isn't targeting them, and
+   is only called after checking SDL_HasSSSE3() or SDL_HasAVX2(). */
+#if defined(__SSE2__)
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if defined(__SSSE3__)
+#define HAVE_SSSE3_INTRINSICS 1
+#define SDL_TARGET_SSSE3
+#elif defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) && defined(HAVE_SSE2_INTRINSICS)
+#if defined(__clang__)
+#if __has_attribute(target)
+#define HAVE_SSSE3_INTRINSICS 1
+#endif
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define HAVE_SSSE3_INTRINSICS 1
+#endif
+#define SDL_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
+#if defined(__AVX2__)
+#define HAVE_AVX2_INTRINSICS 1
+#define SDL_TARGET_AVX2
+#elif defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) && defined(HAVE_SSE2_INTRINSICS)
+#if defined(__clang__)
+#if __has_attribute(target)
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#define SDL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
 /* Table to do pixel byte expansion */
 extern Uint8 *SDL_expand_byte[9];
 
@@ -58,6 +93,8 @@ extern Uint8 *SDL_expand_byte[9];
 #define SDL_CPU_SSE2               0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000020
+#define SDL_CPU_AVX2               0x00000040
+#define SDL_CPU_NEON               0x00000080
 
 typedef struct
 {
@@ -93,6 +130,7 @@ typedef struct
 struct SDL_BlitMap
 {
     SDL_Surface *dst;
+    SDL_Surface *owner; /* the surface this map was allocated for, if it has SDL_SurfaceData */
     int identity;
     SDL_blit blit;
     void *data;
@@ -106,6 +144,9 @@ struct SDL_BlitMap
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface *surface);
+/* Start and stop watching SDL_HINT_BLIT_STATS, from SDL_InitSubSystem() and SDL_Quit() */
+extern void SDL_InitBlitStats(void);
+extern void SDL_QuitBlitStats(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
@@ -181,6 +222,10 @@ extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface);
         }                                                  \
     } while (0)
 
+/* Index of an RGB triple in the table of nearest palette colors that
+   SDL_MapSurface() builds for blits to palettized surfaces */
+#define RGB555_INDEX(r, g, b) ((((r) >> 3) << 10) | (((g) >> 3) << 5) | ((b) >> 3))
+
 #define DISEMBLE_RGB(buf, bpp, fmt, Pixel, r, g, b) \
     do {                                            \
         switch (bpp) {                              \
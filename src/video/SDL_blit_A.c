@@ -61,7 +61,7 @@ static void BlitNto1SurfaceAlpha(SDL_BlitInfo *info)
         if ( palmap == NULL ) {
             *dst =((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0));
         } else {
-            *dst = palmap[((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0))];
+            *dst = palmap[RGB555_INDEX(dR, dG, dB)];
         }
         dst++;
         src += srcbpp;
@@ -106,7 +106,7 @@ static void BlitNto1PixelAlpha(SDL_BlitInfo *info)
         if ( palmap == NULL ) {
             *dst =((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0));
         } else {
-            *dst = palmap[((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0))];
+            *dst = palmap[RGB555_INDEX(dR, dG, dB)];
         }
         dst++;
         src += srcbpp;
@@ -154,7 +154,7 @@ static void BlitNto1SurfaceAlphaKey(SDL_BlitInfo *info)
             if ( palmap == NULL ) {
                 *dst =((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0));
             } else {
-                *dst = palmap[((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0))];
+                *dst = palmap[RGB555_INDEX(dR, dG, dB)];
             }
         }
         dst++;
@@ -167,221 +167,384 @@ static void BlitNto1SurfaceAlphaKey(SDL_BlitInfo *info)
     }
 }
 
-#ifdef __MMX__
+#if defined(HAVE_SSE2_INTRINSICS)
+/* The SSE2 blenders work on 4 pixels at a time. Rows that aren't a multiple
+   of 4 pixels wide have their last pixels blended through a small buffer, so
+   every pixel goes through exactly the same arithmetic. */
 
-/* fast RGB888->(A)RGB888 blending with surface alpha=128 special case */
-static void BlitRGBtoRGBSurfaceAlpha128MMX(SDL_BlitInfo *info)
+/* ARGB888->(A)RGB888 blending with pixel alpha. The alpha channel may be in
+   any byte. Matches the former MMX blitter: (s * A + d * (255 - A)) >> 8 for
+   the color channels, with the source alpha weighted by 255 instead of A,
+   and transparent and opaque pixels passed through unchanged. */
+static SDL_INLINE __m128i BlendPixelAlpha4_SSE2(__m128i s, __m128i d, __m128i amask, __m128i ashift)
 {
-    int width = info->dst_w;
-    int height = info->dst_h;
-    Uint32 *srcp = (Uint32 *)info->src;
-    int srcskip = info->src_skip >> 2;
-    Uint32 *dstp = (Uint32 *)info->dst;
-    int dstskip = info->dst_skip >> 2;
-    Uint32 dalpha = info->dst_fmt->Amask;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i sa = _mm_and_si128(s, amask);
+    const __m128i transparent = _mm_cmpeq_epi32(sa, zero);
+    const __m128i opaque = _mm_cmpeq_epi32(sa, amask);
+    __m128i a, ia, lo, hi, result;
+
+    a = _mm_srl_epi32(sa, ashift);                                /* 000A per pixel */
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 8));
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 16));                   /* AAAA per pixel */
+    ia = _mm_xor_si128(a, _mm_set1_epi32(-1));                    /* 255 - A per channel */
+    a = _mm_or_si128(a, amask);                                   /* source alpha is weighted by 255 */
+
+    lo = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(a, zero)), 8),
+                       _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(ia, zero)), 8));
+    hi = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(a, zero)), 8),
+                       _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(ia, zero)), 8));
+    result = _mm_packus_epi16(lo, hi);
+
+    result = _mm_or_si128(_mm_and_si128(opaque, s), _mm_andnot_si128(opaque, result));
+    return _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, result));
+}
 
-    __m64 src1, src2, dst1, dst2, lmask, hmask, dsta;
+static void BlitRGBtoRGBPixelAlphaRow_SSE2(const Uint32 *srcp, Uint32 *dstp, int n, __m128i amask, __m128i ashift)
+{
+    const __m128i zero = _mm_setzero_si128();
 
-    hmask = _mm_set_pi32(0x00fefefe, 0x00fefefe); /* alpha128 mask -> hmask */
-    lmask = _mm_set_pi32(0x00010101, 0x00010101); /* !alpha128 mask -> lmask */
-    dsta = _mm_set_pi32(dalpha, dalpha);          /* dst alpha mask -> dsta */
+    for (; n >= 4; n -= 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)srcp);
+        const __m128i sa = _mm_and_si128(s, amask);
 
-    while (height--) {
-        int n = width;
-        if (n & 1) {
-            Uint32 s = *srcp++;
-            Uint32 d = *dstp;
-            *dstp++ = ((((s & 0x00fefefe) + (d & 0x00fefefe)) >> 1) + (s & d & 0x00010101)) | dalpha;
-            n--;
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, zero)) == 0xFFFF) {
+            /* all transparent, nothing to do */
+        } else if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, amask)) == 0xFFFF) {
+            _mm_storeu_si128((__m128i *)dstp, s);
+        } else {
+            const __m128i d = _mm_loadu_si128((const __m128i *)dstp);
+            _mm_storeu_si128((__m128i *)dstp, BlendPixelAlpha4_SSE2(s, d, amask, ashift));
         }
+        srcp += 4;
+        dstp += 4;
+    }
 
-        for (n >>= 1; n > 0; --n) {
-            dst1 = *(__m64 *)dstp; /* 2 x dst -> dst1(ARGBARGB) */
-            dst2 = dst1;           /* 2 x dst -> dst2(ARGBARGB) */
-
-            src1 = *(__m64 *)srcp; /* 2 x src -> src1(ARGBARGB) */
-            src2 = src1;           /* 2 x src -> src2(ARGBARGB) */
+    if (n > 0) {
+        Uint32 s[4] = { 0, 0, 0, 0 };
+        Uint32 d[4] = { 0, 0, 0, 0 };
+        SDL_memcpy(s, srcp, n * sizeof(Uint32));
+        SDL_memcpy(d, dstp, n * sizeof(Uint32));
+        _mm_storeu_si128((__m128i *)d, BlendPixelAlpha4_SSE2(_mm_loadu_si128((const __m128i *)s), _mm_loadu_si128((const __m128i *)d), amask, ashift));
+        SDL_memcpy(dstp, d, n * sizeof(Uint32));
+    }
+}
 
-            dst2 = _mm_and_si64(dst2, hmask); /* dst & mask -> dst2 */
-            src2 = _mm_and_si64(src2, hmask); /* src & mask -> src2 */
-            src2 = _mm_add_pi32(src2, dst2);  /* dst2 + src2 -> src2 */
-            src2 = _mm_srli_pi32(src2, 1);    /* src2 >> 1 -> src2 */
+static void BlitRGBtoRGBPixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcpitch = info->src_pitch;
+    int dstpitch = info->dst_pitch;
+    const __m128i amask = _mm_set1_epi32((int)info->src_fmt->Amask);
+    const __m128i ashift = _mm_cvtsi32_si128(info->src_fmt->Ashift);
 
-            dst1 = _mm_and_si64(dst1, src1);  /* src & dst -> dst1 */
-            dst1 = _mm_and_si64(dst1, lmask); /* dst1 & !mask -> dst1 */
-            dst1 = _mm_add_pi32(dst1, src2);  /* src2 + dst1 -> dst1 */
-            dst1 = _mm_or_si64(dst1, dsta);   /* dsta(full alpha) | dst1 -> dst1 */
+    while (height--) {
+        BlitRGBtoRGBPixelAlphaRow_SSE2((const Uint32 *)src, (Uint32 *)dst, width, amask, ashift);
+        src += srcpitch;
+        dst += dstpitch;
+    }
+}
 
-            *(__m64 *)dstp = dst1; /* dst1 -> 2 x dst pixels */
-            dstp += 2;
-            srcp += 2;
-        }
+/* RGB888->(A)RGB888 blending with surface alpha, for the channels in
+   'chanmask': d + (((s - d) * alpha) >> 8), then the destination alpha
+   mask is set. */
+static SDL_INLINE __m128i BlendSurfaceAlpha4_SSE2(__m128i s, __m128i d, __m128i alpha, __m128i dalpha)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i slo = _mm_unpacklo_epi8(s, zero);
+    __m128i shi = _mm_unpackhi_epi8(s, zero);
+    __m128i dlo = _mm_unpacklo_epi8(d, zero);
+    __m128i dhi = _mm_unpackhi_epi8(d, zero);
+
+    slo = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(slo, dlo), alpha), 8);
+    shi = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(shi, dhi), alpha), 8);
+    dlo = _mm_add_epi8(slo, dlo);
+    dhi = _mm_add_epi8(shi, dhi);
+    return _mm_or_si128(_mm_packus_epi16(dlo, dhi), dalpha);
+}
 
-        srcp += srcskip;
-        dstp += dstskip;
-    }
-    _mm_empty();
+/* Same with surface alpha=128: the average of both pixels */
+static SDL_INLINE __m128i BlendSurfaceAlpha128_4_SSE2(__m128i s, __m128i d, __m128i dalpha)
+{
+    const __m128i hmask = _mm_set1_epi32(0x00fefefe);
+    const __m128i lmask = _mm_set1_epi32(0x00010101);
+    __m128i avg = _mm_srli_epi32(_mm_add_epi32(_mm_and_si128(s, hmask), _mm_and_si128(d, hmask)), 1);
+    avg = _mm_add_epi32(avg, _mm_and_si128(_mm_and_si128(s, d), lmask));
+    return _mm_or_si128(avg, dalpha);
 }
 
-/* fast RGB888->(A)RGB888 blending with surface alpha */
-static void BlitRGBtoRGBSurfaceAlphaMMX(SDL_BlitInfo *info)
+static void BlitRGBtoRGBSurfaceAlphaSSE2(SDL_BlitInfo *info)
 {
     SDL_PixelFormat *df = info->dst_fmt;
-    Uint32 chanmask;
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcpitch = info->src_pitch;
+    int dstpitch = info->dst_pitch;
     unsigned alpha = info->a;
+    /* only use the alpha=128 version when R,G,B occupy lower bits */
+    const SDL_bool half = (alpha == 128 && (df->Rmask | df->Gmask | df->Bmask) == 0x00FFFFFF);
+    const Uint32 chanmask = (0xffU << df->Rshift) | (0xffU << df->Gshift) | (0xffU << df->Bshift);
+    Uint32 amult = alpha | (alpha << 8);
+    __m128i mm_alpha, dalpha;
 
-    if (alpha == 128 && (df->Rmask | df->Gmask | df->Bmask) == 0x00FFFFFF) {
-        /* only call a128 version when R,G,B occupy lower bits */
-        BlitRGBtoRGBSurfaceAlpha128MMX(info);
-    } else {
-        int width = info->dst_w;
-        int height = info->dst_h;
-        Uint32 *srcp = (Uint32 *)info->src;
-        int srcskip = info->src_skip >> 2;
-        Uint32 *dstp = (Uint32 *)info->dst;
-        int dstskip = info->dst_skip >> 2;
-        Uint32 dalpha = df->Amask;
-        Uint32 amult;
-
-        __m64 src1, src2, dst1, dst2, mm_alpha, mm_zero, dsta;
-
-        mm_zero = _mm_setzero_si64(); /* 0 -> mm_zero */
-        /* form the alpha mult */
-        amult = alpha | (alpha << 8);
-        amult = amult | (amult << 16);
-        chanmask =
-            (0xff << df->Rshift) | (0xff << df->Gshift) | (0xff << df->Bshift);
-        mm_alpha = _mm_set_pi32(0, amult & chanmask);   /* 0000AAAA -> mm_alpha, minus 1 chan */
-        mm_alpha = _mm_unpacklo_pi8(mm_alpha, mm_zero); /* 0A0A0A0A -> mm_alpha, minus 1 chan */
-        /* at this point mm_alpha can be 000A0A0A or 0A0A0A00 or another combo */
-        dsta = _mm_set_pi32(dalpha, dalpha); /* dst alpha mask -> dsta */
+    amult = amult | (amult << 16);
+    mm_alpha = _mm_unpacklo_epi8(_mm_set1_epi32((int)(amult & chanmask)), _mm_setzero_si128());
+    dalpha = _mm_set1_epi32((int)df->Amask);
 
-        while (height--) {
-            int n = width;
-            if (n & 1) {
-                /* One Pixel Blend */
-                src2 = _mm_cvtsi32_si64(*srcp);         /* src(ARGB) -> src2 (0000ARGB) */
-                src2 = _mm_unpacklo_pi8(src2, mm_zero); /* 0A0R0G0B -> src2 */
+    while (height--) {
+        const Uint32 *srcp = (const Uint32 *)src;
+        Uint32 *dstp = (Uint32 *)dst;
+        int n;
+
+        for (n = width; n >= 4; n -= 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *)srcp);
+            const __m128i d = _mm_loadu_si128((const __m128i *)dstp);
+            _mm_storeu_si128((__m128i *)dstp, half ? BlendSurfaceAlpha128_4_SSE2(s, d, dalpha) : BlendSurfaceAlpha4_SSE2(s, d, mm_alpha, dalpha));
+            srcp += 4;
+            dstp += 4;
+        }
 
-                dst1 = _mm_cvtsi32_si64(*dstp);         /* dst(ARGB) -> dst1 (0000ARGB) */
-                dst1 = _mm_unpacklo_pi8(dst1, mm_zero); /* 0A0R0G0B -> dst1 */
+        if (n > 0) {
+            Uint32 s[4] = { 0, 0, 0, 0 };
+            Uint32 d[4] = { 0, 0, 0, 0 };
+            __m128i result;
+            SDL_memcpy(s, srcp, n * sizeof(Uint32));
+            SDL_memcpy(d, dstp, n * sizeof(Uint32));
+            if (half) {
+                result = BlendSurfaceAlpha128_4_SSE2(_mm_loadu_si128((const __m128i *)s), _mm_loadu_si128((const __m128i *)d), dalpha);
+            } else {
+                result = BlendSurfaceAlpha4_SSE2(_mm_loadu_si128((const __m128i *)s), _mm_loadu_si128((const __m128i *)d), mm_alpha, dalpha);
+            }
+            _mm_storeu_si128((__m128i *)d, result);
+            SDL_memcpy(dstp, d, n * sizeof(Uint32));
+        }
 
-                src2 = _mm_sub_pi16(src2, dst1);       /* src2 - dst2 -> src2 */
-                src2 = _mm_mullo_pi16(src2, mm_alpha); /* src2 * alpha -> src2 */
-                src2 = _mm_srli_pi16(src2, 8);         /* src2 >> 8 -> src2 */
-                dst1 = _mm_add_pi8(src2, dst1);        /* src2 + dst1 -> dst1 */
+        src += srcpitch;
+        dst += dstpitch;
+    }
+}
 
-                dst1 = _mm_packs_pu16(dst1, mm_zero); /* 0000ARGB -> dst1 */
-                dst1 = _mm_or_si64(dst1, dsta);       /* dsta | dst1 -> dst1 */
-                *dstp = _mm_cvtsi64_si32(dst1);       /* dst1 -> pixel */
+/* Low 32 bits of a * b in each 32-bit lane, for b < 65536 (_mm_mullo_epi32
+   needs SSE4.1) */
+static SDL_INLINE __m128i MulLo32By16_SSE2(__m128i a, __m128i b)
+{
+    b = _mm_or_si128(b, _mm_slli_epi32(b, 16));
+    return _mm_add_epi32(_mm_mullo_epi16(a, b), _mm_slli_epi32(_mm_mulhi_epu16(a, b), 16));
+}
 
-                ++srcp;
-                ++dstp;
+/* ARGB8888->RGB565 blending with pixel alpha, computed exactly like
+   BlitARGBto565PixelAlpha() with one pixel per 32-bit lane: both pixels are
+   spread out to G0RAB65565 and blended with a 5 bit alpha. */
+static SDL_INLINE __m128i BlendARGBto565_4_SSE2(__m128i s, __m128i d)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i spread = _mm_set1_epi32(0x07e0f81f);
+    const __m128i alpha = _mm_srli_epi32(s, 27);
+    const __m128i transparent = _mm_cmpeq_epi32(alpha, zero);
+    const __m128i opaque = _mm_cmpeq_epi32(alpha, _mm_set1_epi32(SDL_ALPHA_OPAQUE >> 3));
+    const __m128i sr = _mm_and_si128(_mm_srli_epi32(s, 8), _mm_set1_epi32(0xf800));
+    const __m128i sb = _mm_and_si128(_mm_srli_epi32(s, 3), _mm_set1_epi32(0x1f));
+    __m128i s565, sx, dx, result;
+
+    s565 = _mm_add_epi32(_mm_add_epi32(sr, _mm_and_si128(_mm_srli_epi32(s, 5), _mm_set1_epi32(0x7e0))), sb);
+    sx = _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(_mm_and_si128(s, _mm_set1_epi32(0xfc00)), 11), sr), sb);
+    dx = _mm_and_si128(_mm_or_si128(d, _mm_slli_epi32(d, 16)), spread);
+    dx = _mm_add_epi32(dx, _mm_srli_epi32(MulLo32By16_SSE2(_mm_sub_epi32(sx, dx), alpha), 5));
+    dx = _mm_and_si128(dx, spread);
+    result = _mm_and_si128(_mm_or_si128(dx, _mm_srli_epi32(dx, 16)), _mm_set1_epi32(0xffff));
+
+    result = _mm_or_si128(_mm_and_si128(opaque, s565), _mm_andnot_si128(opaque, result));
+    return _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, result));
+}
 
-                n--;
-            }
+/* Packs the low 16 bits of each 32-bit lane into the low 64 bits */
+static SDL_INLINE __m128i Pack32To16_SSE2(__m128i v)
+{
+    v = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+    return _mm_packs_epi32(v, v);
+}
 
-            for (n >>= 1; n > 0; --n) {
-                /* Two Pixels Blend */
-                src1 = *(__m64 *)srcp;                  /* 2 x src -> src1(ARGBARGB) */
-                src2 = src1;                            /* 2 x src -> src2(ARGBARGB) */
-                src1 = _mm_unpacklo_pi8(src1, mm_zero); /* low - 0A0R0G0B -> src1 */
-                src2 = _mm_unpackhi_pi8(src2, mm_zero); /* high - 0A0R0G0B -> src2 */
+static void BlitARGBto565PixelAlphaRow_SSE2(const Uint32 *srcp, Uint16 *dstp, int n)
+{
+    const __m128i zero = _mm_setzero_si128();
 
-                dst1 = *(__m64 *)dstp;                  /* 2 x dst -> dst1(ARGBARGB) */
-                dst2 = dst1;                            /* 2 x dst -> dst2(ARGBARGB) */
-                dst1 = _mm_unpacklo_pi8(dst1, mm_zero); /* low - 0A0R0G0B -> dst1 */
-                dst2 = _mm_unpackhi_pi8(dst2, mm_zero); /* high - 0A0R0G0B -> dst2 */
+    for (; n >= 4; n -= 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)srcp);
 
-                src1 = _mm_sub_pi16(src1, dst1);       /* src1 - dst1 -> src1 */
-                src1 = _mm_mullo_pi16(src1, mm_alpha); /* src1 * alpha -> src1 */
-                src1 = _mm_srli_pi16(src1, 8);         /* src1 >> 8 -> src1 */
-                dst1 = _mm_add_pi8(src1, dst1);        /* src1 + dst1(dst1) -> dst1 */
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_srli_epi32(s, 27), zero)) != 0xFFFF) {
+            const __m128i d = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)dstp), zero);
+            _mm_storel_epi64((__m128i *)dstp, Pack32To16_SSE2(BlendARGBto565_4_SSE2(s, d)));
+        }
+        srcp += 4;
+        dstp += 4;
+    }
 
-                src2 = _mm_sub_pi16(src2, dst2);       /* src2 - dst2 -> src2 */
-                src2 = _mm_mullo_pi16(src2, mm_alpha); /* src2 * alpha -> src2 */
-                src2 = _mm_srli_pi16(src2, 8);         /* src2 >> 8 -> src2 */
-                dst2 = _mm_add_pi8(src2, dst2);        /* src2 + dst2(dst2) -> dst2 */
+    if (n > 0) {
+        Uint32 s[4] = { 0, 0, 0, 0 };
+        Uint16 d[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+        __m128i result;
+        SDL_memcpy(s, srcp, n * sizeof(Uint32));
+        SDL_memcpy(d, dstp, n * sizeof(Uint16));
+        result = BlendARGBto565_4_SSE2(_mm_loadu_si128((const __m128i *)s),
+                                       _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)d), zero));
+        _mm_storel_epi64((__m128i *)d, Pack32To16_SSE2(result));
+        SDL_memcpy(dstp, d, n * sizeof(Uint16));
+    }
+}
 
-                dst1 = _mm_packs_pu16(dst1, dst2); /* 0A0R0G0B(res1), 0A0R0G0B(res2) -> dst1(ARGBARGB) */
-                dst1 = _mm_or_si64(dst1, dsta);    /* dsta | dst1 -> dst1 */
+static void BlitARGBto565PixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcpitch = info->src_pitch;
+    int dstpitch = info->dst_pitch;
 
-                *(__m64 *)dstp = dst1; /* dst1 -> 2 x pixel */
+    while (height--) {
+        BlitARGBto565PixelAlphaRow_SSE2((const Uint32 *)src, (Uint16 *)dst, width);
+        src += srcpitch;
+        dst += dstpitch;
+    }
+}
+#endif /* HAVE_SSE2_INTRINSICS */
 
-                srcp += 2;
-                dstp += 2;
+#if defined(HAVE_AVX2_INTRINSICS)
+/* AVX2 version of BlendPixelAlpha4_SSE2(), on 8 pixels */
+SDL_TARGET_AVX2
+static SDL_INLINE __m256i BlendPixelAlpha8_AVX2(__m256i s, __m256i d, __m256i amask, __m128i ashift)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i sa = _mm256_and_si256(s, amask);
+    const __m256i transparent = _mm256_cmpeq_epi32(sa, zero);
+    const __m256i opaque = _mm256_cmpeq_epi32(sa, amask);
+    __m256i a, ia, lo, hi, result;
+
+    a = _mm256_srl_epi32(sa, ashift);
+    a = _mm256_or_si256(a, _mm256_slli_epi32(a, 8));
+    a = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+    ia = _mm256_xor_si256(a, _mm256_set1_epi32(-1));
+    a = _mm256_or_si256(a, amask);
+
+    lo = _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(a, zero)), 8),
+                          _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(ia, zero)), 8));
+    hi = _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(a, zero)), 8),
+                          _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(ia, zero)), 8));
+    result = _mm256_packus_epi16(lo, hi);
+
+    result = _mm256_or_si256(_mm256_and_si256(opaque, s), _mm256_andnot_si256(opaque, result));
+    return _mm256_or_si256(_mm256_and_si256(transparent, d), _mm256_andnot_si256(transparent, result));
+}
+
+SDL_TARGET_AVX2
+static void BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcpitch = info->src_pitch;
+    int dstpitch = info->dst_pitch;
+    const __m256i amask = _mm256_set1_epi32((int)info->src_fmt->Amask);
+    const __m128i ashift = _mm_cvtsi32_si128(info->src_fmt->Ashift);
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (height--) {
+        const Uint32 *srcp = (const Uint32 *)src;
+        Uint32 *dstp = (Uint32 *)dst;
+        int n;
+
+        for (n = width; n >= 8; n -= 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *)srcp);
+            const __m256i sa = _mm256_and_si256(s, amask);
+
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(sa, zero)) == -1) {
+                /* all transparent, nothing to do */
+            } else if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(sa, amask)) == -1) {
+                _mm256_storeu_si256((__m256i *)dstp, s);
+            } else {
+                const __m256i d = _mm256_loadu_si256((const __m256i *)dstp);
+                _mm256_storeu_si256((__m256i *)dstp, BlendPixelAlpha8_AVX2(s, d, amask, ashift));
             }
-            srcp += srcskip;
-            dstp += dstskip;
+            srcp += 8;
+            dstp += 8;
         }
-        _mm_empty();
+
+        BlitRGBtoRGBPixelAlphaRow_SSE2(srcp, dstp, n, _mm256_castsi256_si128(amask), ashift);
+
+        src += srcpitch;
+        dst += dstpitch;
     }
 }
 
-/* fast ARGB888->(A)RGB888 blending with pixel alpha */
-static void BlitRGBtoRGBPixelAlphaMMX(SDL_BlitInfo *info)
+/* AVX2 version of BlendARGBto565_4_SSE2(), on 8 pixels */
+SDL_TARGET_AVX2
+static SDL_INLINE __m256i BlendARGBto565_8_AVX2(__m256i s, __m256i d)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i spread = _mm256_set1_epi32(0x07e0f81f);
+    const __m256i alpha = _mm256_srli_epi32(s, 27);
+    const __m256i transparent = _mm256_cmpeq_epi32(alpha, zero);
+    const __m256i opaque = _mm256_cmpeq_epi32(alpha, _mm256_set1_epi32(SDL_ALPHA_OPAQUE >> 3));
+    const __m256i sr = _mm256_and_si256(_mm256_srli_epi32(s, 8), _mm256_set1_epi32(0xf800));
+    const __m256i sb = _mm256_and_si256(_mm256_srli_epi32(s, 3), _mm256_set1_epi32(0x1f));
+    __m256i s565, sx, dx, result;
+
+    s565 = _mm256_add_epi32(_mm256_add_epi32(sr, _mm256_and_si256(_mm256_srli_epi32(s, 5), _mm256_set1_epi32(0x7e0))), sb);
+    sx = _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(s, _mm256_set1_epi32(0xfc00)), 11), sr), sb);
+    dx = _mm256_and_si256(_mm256_or_si256(d, _mm256_slli_epi32(d, 16)), spread);
+    dx = _mm256_add_epi32(dx, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(sx, dx), alpha), 5));
+    dx = _mm256_and_si256(dx, spread);
+    result = _mm256_and_si256(_mm256_or_si256(dx, _mm256_srli_epi32(dx, 16)), _mm256_set1_epi32(0xffff));
+
+    result = _mm256_or_si256(_mm256_and_si256(opaque, s565), _mm256_andnot_si256(opaque, result));
+    return _mm256_or_si256(_mm256_and_si256(transparent, d), _mm256_andnot_si256(transparent, result));
+}
+
+SDL_TARGET_AVX2
+static void BlitARGBto565PixelAlphaAVX2(SDL_BlitInfo *info)
 {
     int width = info->dst_w;
     int height = info->dst_h;
-    Uint32 *srcp = (Uint32 *)info->src;
-    int srcskip = info->src_skip >> 2;
-    Uint32 *dstp = (Uint32 *)info->dst;
-    int dstskip = info->dst_skip >> 2;
-    SDL_PixelFormat *sf = info->src_fmt;
-    Uint32 amask = sf->Amask;
-    Uint32 ashift = sf->Ashift;
-    Uint64 multmask, multmask2;
-
-    __m64 src1, dst1, mm_alpha, mm_zero, mm_alpha2;
-
-    mm_zero = _mm_setzero_si64(); /* 0 -> mm_zero */
-    multmask = 0x00FF;
-    multmask <<= (ashift * 2);
-    multmask2 = 0x00FF00FF00FF00FFULL;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcpitch = info->src_pitch;
+    int dstpitch = info->dst_pitch;
+    const __m256i zero = _mm256_setzero_si256();
 
     while (height--) {
-        /* *INDENT-OFF* */ /* clang-format off */
-        DUFFS_LOOP4({
-        Uint32 alpha = *srcp & amask;
-        if (alpha == 0) {
-            /* do nothing */
-        } else if (alpha == amask) {
-            *dstp = *srcp;
-        } else {
-            src1 = _mm_cvtsi32_si64(*srcp); /* src(ARGB) -> src1 (0000ARGB) */
-            src1 = _mm_unpacklo_pi8(src1, mm_zero); /* 0A0R0G0B -> src1 */
-
-            dst1 = _mm_cvtsi32_si64(*dstp); /* dst(ARGB) -> dst1 (0000ARGB) */
-            dst1 = _mm_unpacklo_pi8(dst1, mm_zero); /* 0A0R0G0B -> dst1 */
-
-            mm_alpha = _mm_cvtsi32_si64(alpha); /* alpha -> mm_alpha (0000000A) */
-            mm_alpha = _mm_srli_si64(mm_alpha, ashift); /* mm_alpha >> ashift -> mm_alpha(0000000A) */
-            mm_alpha = _mm_unpacklo_pi16(mm_alpha, mm_alpha); /* 00000A0A -> mm_alpha */
-            mm_alpha2 = _mm_unpacklo_pi32(mm_alpha, mm_alpha); /* 0A0A0A0A -> mm_alpha2 */
-            mm_alpha = _mm_or_si64(mm_alpha2, *(__m64 *) & multmask);    /* 0F0A0A0A -> mm_alpha */
-            mm_alpha2 = _mm_xor_si64(mm_alpha2, *(__m64 *) & multmask2);    /* 255 - mm_alpha -> mm_alpha */
-
-            /* blend */            
-            src1 = _mm_mullo_pi16(src1, mm_alpha);
-            src1 = _mm_srli_pi16(src1, 8);
-            dst1 = _mm_mullo_pi16(dst1, mm_alpha2);
-            dst1 = _mm_srli_pi16(dst1, 8);
-            dst1 = _mm_add_pi16(src1, dst1);
-            dst1 = _mm_packs_pu16(dst1, mm_zero);
-            
-            *dstp = _mm_cvtsi64_si32(dst1); /* dst1 -> pixel */
+        const Uint32 *srcp = (const Uint32 *)src;
+        Uint16 *dstp = (Uint16 *)dst;
+        int n;
+
+        for (n = width; n >= 8; n -= 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *)srcp);
+
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_srli_epi32(s, 27), zero)) != -1) {
+                const __m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)dstp));
+                __m256i result = BlendARGBto565_8_AVX2(s, d);
+                /* the pack works within each 128-bit half, gather both halves */
+                result = _mm256_packus_epi32(result, result);
+                result = _mm256_permute4x64_epi64(result, _MM_SHUFFLE(3, 1, 2, 0));
+                _mm_storeu_si128((__m128i *)dstp, _mm256_castsi256_si128(result));
+            }
+            srcp += 8;
+            dstp += 8;
         }
-        ++srcp;
-        ++dstp;
-        }, width);
-        /* *INDENT-ON* */ /* clang-format on */
-        srcp += srcskip;
-        dstp += dstskip;
+
+        BlitARGBto565PixelAlphaRow_SSE2(srcp, dstp, n);
+
+        src += srcpitch;
+        dst += dstpitch;
     }
-    _mm_empty();
 }
+#endif /* HAVE_AVX2_INTRINSICS */
 
-#endif /* __MMX__ */
 
 #if SDL_ARM_SIMD_BLITTERS
 void BlitARGBto565PixelAlphaARMSIMDAsm(int32_t w, int32_t h, uint16_t *dst, int32_t dst_stride, uint32_t *src, int32_t src_stride);
@@ -614,78 +777,6 @@ static void BlitRGBtoBGRPixelAlpha(SDL_BlitInfo *info)
     }
 }
 
-#ifdef __3dNOW__
-/* fast (as in MMX with prefetch) ARGB888->(A)RGB888 blending with pixel alpha */
-static void BlitRGBtoRGBPixelAlphaMMX3DNOW(SDL_BlitInfo *info)
-{
-    int width = info->dst_w;
-    int height = info->dst_h;
-    Uint32 *srcp = (Uint32 *)info->src;
-    int srcskip = info->src_skip >> 2;
-    Uint32 *dstp = (Uint32 *)info->dst;
-    int dstskip = info->dst_skip >> 2;
-    SDL_PixelFormat *sf = info->src_fmt;
-    Uint32 amask = sf->Amask;
-    Uint32 ashift = sf->Ashift;
-    Uint64 multmask, multmask2;
-
-    __m64 src1, dst1, mm_alpha, mm_zero, mm_alpha2;
-
-    mm_zero = _mm_setzero_si64(); /* 0 -> mm_zero */
-    multmask = 0x00FF;
-    multmask <<= (ashift * 2);
-    multmask2 = 0x00FF00FF00FF00FFULL;
-
-    while (height--) {
-        /* *INDENT-OFF* */ /* clang-format off */
-        DUFFS_LOOP4({
-        Uint32 alpha;
-
-        _m_prefetch(srcp + 16);
-        _m_prefetch(dstp + 16);
-
-        alpha = *srcp & amask;
-        if (alpha == 0) {
-            /* do nothing */
-        } else if (alpha == amask) {
-            *dstp = *srcp;
-        } else {
-            src1 = _mm_cvtsi32_si64(*srcp); /* src(ARGB) -> src1 (0000ARGB) */
-            src1 = _mm_unpacklo_pi8(src1, mm_zero); /* 0A0R0G0B -> src1 */
-
-            dst1 = _mm_cvtsi32_si64(*dstp); /* dst(ARGB) -> dst1 (0000ARGB) */
-            dst1 = _mm_unpacklo_pi8(dst1, mm_zero); /* 0A0R0G0B -> dst1 */
-
-            mm_alpha = _mm_cvtsi32_si64(alpha); /* alpha -> mm_alpha (0000000A) */
-            mm_alpha = _mm_srli_si64(mm_alpha, ashift); /* mm_alpha >> ashift -> mm_alpha(0000000A) */
-            mm_alpha = _mm_unpacklo_pi16(mm_alpha, mm_alpha); /* 00000A0A -> mm_alpha */
-            mm_alpha2 = _mm_unpacklo_pi32(mm_alpha, mm_alpha); /* 0A0A0A0A -> mm_alpha2 */
-            mm_alpha = _mm_or_si64(mm_alpha2, *(__m64 *) & multmask);    /* 0F0A0A0A -> mm_alpha */
-            mm_alpha2 = _mm_xor_si64(mm_alpha2, *(__m64 *) & multmask2);    /* 255 - mm_alpha -> mm_alpha */
-
-
-            /* blend */            
-            src1 = _mm_mullo_pi16(src1, mm_alpha);
-            src1 = _mm_srli_pi16(src1, 8);
-            dst1 = _mm_mullo_pi16(dst1, mm_alpha2);
-            dst1 = _mm_srli_pi16(dst1, 8);
-            dst1 = _mm_add_pi16(src1, dst1);
-            dst1 = _mm_packs_pu16(dst1, mm_zero);
-            
-            *dstp = _mm_cvtsi64_si32(dst1); /* dst1 -> pixel */
-        }
-        ++srcp;
-        ++dstp;
-        }, width);
-        /* *INDENT-ON* */ /* clang-format on */
-        srcp += srcskip;
-        dstp += dstskip;
-    }
-    _mm_empty();
-}
-
-#endif /* __3dNOW__ */
-
 /* 16bpp special case for per-surface alpha=50%: blend 2 pixels in parallel */
 
 /* blend a single 16 bit pixel at 50% */
@@ -794,282 +885,111 @@ static void Blit16to16SurfaceAlpha128(SDL_BlitInfo *info, Uint16 mask)
     }
 }
 
-#ifdef __MMX__
+#if defined(HAVE_SSE2_INTRINSICS)
 
-/* fast RGB565->RGB565 blending with surface alpha */
-static void Blit565to565SurfaceAlphaMMX(SDL_BlitInfo *info)
+/* RGB565->RGB565 and RGB555->RGB555 blending with surface alpha, 8 pixels
+   at a time. Each channel is blended in its own 16-bit lane with the 5-bit
+   alpha, giving the same results as the C versions below. */
+static void Blit16to16SurfaceAlphaSSE2(SDL_BlitInfo *info, SDL_bool is565)
 {
+    const Uint32 mask = is565 ? 0x07e0f81f : 0x03e07c1f;
     unsigned alpha = info->a;
-    if (alpha == 128) {
-        Blit16to16SurfaceAlpha128(info, 0xf7de);
-    } else {
-        int width = info->dst_w;
-        int height = info->dst_h;
-        Uint16 *srcp = (Uint16 *)info->src;
-        int srcskip = info->src_skip >> 1;
-        Uint16 *dstp = (Uint16 *)info->dst;
-        int dstskip = info->dst_skip >> 1;
-        Uint32 s, d;
-
-        __m64 src1, dst1, src2, dst2, gmask, bmask, mm_res, mm_alpha;
-
-        alpha &= ~(1 + 2 + 4);             /* cut alpha to get the exact same behaviour */
-        mm_alpha = _mm_set_pi32(0, alpha); /* 0000000A -> mm_alpha */
-        alpha >>= 3;                       /* downscale alpha to 5 bits */
-
-        mm_alpha = _mm_unpacklo_pi16(mm_alpha, mm_alpha); /* 00000A0A -> mm_alpha */
-        mm_alpha = _mm_unpacklo_pi32(mm_alpha, mm_alpha); /* 0A0A0A0A -> mm_alpha */
-        /* position alpha to allow for mullo and mulhi on diff channels
-           to reduce the number of operations */
-        mm_alpha = _mm_slli_si64(mm_alpha, 3);
-
-        /* Setup the 565 color channel masks */
-        gmask = _mm_set_pi32(0x07E007E0, 0x07E007E0); /* MASKGREEN -> gmask */
-        bmask = _mm_set_pi32(0x001F001F, 0x001F001F); /* MASKBLUE -> bmask */
-
-        while (height--) {
-            /* *INDENT-OFF* */ /* clang-format off */
-            DUFFS_LOOP_124(
-            {
-                s = *srcp++;
-                d = *dstp;
-                /*
-                 * shift out the middle component (green) to
-                 * the high 16 bits, and process all three RGB
-                 * components at the same time.
-                 */
-                s = (s | s << 16) & 0x07e0f81f;
-                d = (d | d << 16) & 0x07e0f81f;
-                d += (s - d) * alpha >> 5;
-                d &= 0x07e0f81f;
-                *dstp++ = (Uint16)(d | d >> 16);
-            },{
-                s = *srcp++;
-                d = *dstp;
-                /*
-                 * shift out the middle component (green) to
-                 * the high 16 bits, and process all three RGB
-                 * components at the same time.
-                 */
-                s = (s | s << 16) & 0x07e0f81f;
-                d = (d | d << 16) & 0x07e0f81f;
-                d += (s - d) * alpha >> 5;
-                d &= 0x07e0f81f;
-                *dstp++ = (Uint16)(d | d >> 16);
-                s = *srcp++;
-                d = *dstp;
-                /*
-                 * shift out the middle component (green) to
-                 * the high 16 bits, and process all three RGB
-                 * components at the same time.
-                 */
-                s = (s | s << 16) & 0x07e0f81f;
-                d = (d | d << 16) & 0x07e0f81f;
-                d += (s - d) * alpha >> 5;
-                d &= 0x07e0f81f;
-                *dstp++ = (Uint16)(d | d >> 16);
-            },{
-                src1 = *(__m64*)srcp; /* 4 src pixels -> src1 */
-                dst1 = *(__m64*)dstp; /* 4 dst pixels -> dst1 */
-
-                /* red */
-                src2 = src1;
-                src2 = _mm_srli_pi16(src2, 11); /* src2 >> 11 -> src2 [000r 000r 000r 000r] */
-
-                dst2 = dst1;
-                dst2 = _mm_srli_pi16(dst2, 11); /* dst2 >> 11 -> dst2 [000r 000r 000r 000r] */
-
-                /* blend */
-                src2 = _mm_sub_pi16(src2, dst2);/* src - dst -> src2 */
-                src2 = _mm_mullo_pi16(src2, mm_alpha); /* src2 * alpha -> src2 */
-                src2 = _mm_srli_pi16(src2, 11); /* src2 >> 11 -> src2 */
-                dst2 = _mm_add_pi16(src2, dst2); /* src2 + dst2 -> dst2 */
-                dst2 = _mm_slli_pi16(dst2, 11); /* dst2 << 11 -> dst2 */
-
-                mm_res = dst2; /* RED -> mm_res */
-
-                /* green -- process the bits in place */
-                src2 = src1;
-                src2 = _mm_and_si64(src2, gmask); /* src & MASKGREEN -> src2 */
-
-                dst2 = dst1;
-                dst2 = _mm_and_si64(dst2, gmask); /* dst & MASKGREEN -> dst2 */
-
-                /* blend */
-                src2 = _mm_sub_pi16(src2, dst2);/* src - dst -> src2 */
-                src2 = _mm_mulhi_pi16(src2, mm_alpha); /* src2 * alpha -> src2 */
-                src2 = _mm_slli_pi16(src2, 5); /* src2 << 5 -> src2 */
-                dst2 = _mm_add_pi16(src2, dst2); /* src2 + dst2 -> dst2 */
-
-                mm_res = _mm_or_si64(mm_res, dst2); /* RED | GREEN -> mm_res */
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint16 *srcp = (Uint16 *)info->src;
+    int srcskip = info->src_skip >> 1;
+    Uint16 *dstp = (Uint16 *)info->dst;
+    int dstskip = info->dst_skip >> 1;
+    __m128i mm_alpha, rmask, gmask, bmask;
 
-                /* blue */
-                src2 = src1;
-                src2 = _mm_and_si64(src2, bmask); /* src & MASKBLUE -> src2[000b 000b 000b 000b] */
+    alpha &= ~(1 + 2 + 4); /* cut alpha to get the exact same behaviour */
+    /* alpha is positioned to allow for mullo and mulhi on different channels */
+    mm_alpha = _mm_set1_epi16((short)(alpha << 3));
+    alpha >>= 3; /* downscale alpha to 5 bits */
 
-                dst2 = dst1;
-                dst2 = _mm_and_si64(dst2, bmask); /* dst & MASKBLUE -> dst2[000b 000b 000b 000b] */
+    rmask = _mm_set1_epi16(is565 ? (short)0xF800 : 0x7C00);
+    gmask = _mm_set1_epi16(is565 ? 0x07E0 : 0x03E0);
+    bmask = _mm_set1_epi16(0x001F);
 
-                /* blend */
-                src2 = _mm_sub_pi16(src2, dst2);/* src - dst -> src2 */
-                src2 = _mm_mullo_pi16(src2, mm_alpha); /* src2 * alpha -> src2 */
-                src2 = _mm_srli_pi16(src2, 11); /* src2 >> 11 -> src2 */
-                dst2 = _mm_add_pi16(src2, dst2); /* src2 + dst2 -> dst2 */
-                dst2 = _mm_and_si64(dst2, bmask); /* dst2 & MASKBLUE -> dst2 */
+    while (height--) {
+        int n = width;
 
-                mm_res = _mm_or_si64(mm_res, dst2); /* RED | GREEN | BLUE -> mm_res */
+        for (; n >= 8; n -= 8) {
+            const __m128i src = _mm_loadu_si128((const __m128i *)srcp);
+            const __m128i dst = _mm_loadu_si128((const __m128i *)dstp);
+            __m128i s, d, res;
+
+            /* red */
+            if (is565) {
+                /* red is in the top bits, blend it shifted down */
+                s = _mm_srli_epi16(src, 11);
+                d = _mm_srli_epi16(dst, 11);
+                s = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(s, d), mm_alpha), 11);
+                res = _mm_slli_epi16(_mm_add_epi16(s, d), 11);
+            } else {
+                s = _mm_and_si128(src, rmask);
+                d = _mm_and_si128(dst, rmask);
+                s = _mm_slli_epi16(_mm_mulhi_epi16(_mm_sub_epi16(s, d), mm_alpha), 5);
+                res = _mm_and_si128(_mm_add_epi16(s, d), rmask);
+            }
 
-                *(__m64*)dstp = mm_res; /* mm_res -> 4 dst pixels */
+            /* green -- process the bits in place */
+            s = _mm_and_si128(src, gmask);
+            d = _mm_and_si128(dst, gmask);
+            s = _mm_slli_epi16(_mm_mulhi_epi16(_mm_sub_epi16(s, d), mm_alpha), 5);
+            res = _mm_or_si128(res, _mm_add_epi16(s, d));
+
+            /* blue */
+            s = _mm_and_si128(src, bmask);
+            d = _mm_and_si128(dst, bmask);
+            s = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(s, d), mm_alpha), 11);
+            res = _mm_or_si128(res, _mm_and_si128(_mm_add_epi16(s, d), bmask));
+
+            _mm_storeu_si128((__m128i *)dstp, res);
+            srcp += 8;
+            dstp += 8;
+        }
 
-                srcp += 4;
-                dstp += 4;
-            }, width);
-            /* *INDENT-ON* */ /* clang-format on */
-            srcp += srcskip;
-            dstp += dstskip;
+        for (; n > 0; --n) {
+            Uint32 s = *srcp++;
+            Uint32 d = *dstp;
+            /*
+             * shift out the middle component (green) to
+             * the high 16 bits, and process all three RGB
+             * components at the same time.
+             */
+            s = (s | s << 16) & mask;
+            d = (d | d << 16) & mask;
+            d += (s - d) * alpha >> 5;
+            d &= mask;
+            *dstp++ = (Uint16)(d | d >> 16);
         }
-        _mm_empty();
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB565->RGB565 blending with surface alpha */
+static void Blit565to565SurfaceAlphaSSE2(SDL_BlitInfo *info)
+{
+    if (info->a == 128) {
+        Blit16to16SurfaceAlpha128(info, 0xf7de);
+    } else {
+        Blit16to16SurfaceAlphaSSE2(info, SDL_TRUE);
     }
 }
 
 /* fast RGB555->RGB555 blending with surface alpha */
-static void Blit555to555SurfaceAlphaMMX(SDL_BlitInfo *info)
+static void Blit555to555SurfaceAlphaSSE2(SDL_BlitInfo *info)
 {
-    unsigned alpha = info->a;
-    if (alpha == 128) {
+    if (info->a == 128) {
         Blit16to16SurfaceAlpha128(info, 0xfbde);
     } else {
-        int width = info->dst_w;
-        int height = info->dst_h;
-        Uint16 *srcp = (Uint16 *)info->src;
-        int srcskip = info->src_skip >> 1;
-        Uint16 *dstp = (Uint16 *)info->dst;
-        int dstskip = info->dst_skip >> 1;
-        Uint32 s, d;
-
-        __m64 src1, dst1, src2, dst2, rmask, gmask, bmask, mm_res, mm_alpha;
-
-        alpha &= ~(1 + 2 + 4);             /* cut alpha to get the exact same behaviour */
-        mm_alpha = _mm_set_pi32(0, alpha); /* 0000000A -> mm_alpha */
-        alpha >>= 3;                       /* downscale alpha to 5 bits */
-
-        mm_alpha = _mm_unpacklo_pi16(mm_alpha, mm_alpha); /* 00000A0A -> mm_alpha */
-        mm_alpha = _mm_unpacklo_pi32(mm_alpha, mm_alpha); /* 0A0A0A0A -> mm_alpha */
-        /* position alpha to allow for mullo and mulhi on diff channels
-           to reduce the number of operations */
-        mm_alpha = _mm_slli_si64(mm_alpha, 3);
-
-        /* Setup the 555 color channel masks */
-        rmask = _mm_set_pi32(0x7C007C00, 0x7C007C00); /* MASKRED -> rmask */
-        gmask = _mm_set_pi32(0x03E003E0, 0x03E003E0); /* MASKGREEN -> gmask */
-        bmask = _mm_set_pi32(0x001F001F, 0x001F001F); /* MASKBLUE -> bmask */
-
-        while (height--) {
-            /* *INDENT-OFF* */ /* clang-format off */
-            DUFFS_LOOP_124(
-            {
-                s = *srcp++;
-                d = *dstp;
-                /*
-                 * shift out the middle component (green) to
-                 * the high 16 bits, and process all three RGB
-                 * components at the same time.
-                 */
-                s = (s | s << 16) & 0x03e07c1f;
-                d = (d | d << 16) & 0x03e07c1f;
-                d += (s - d) * alpha >> 5;
-                d &= 0x03e07c1f;
-                *dstp++ = (Uint16)(d | d >> 16);
-            },{
-                s = *srcp++;
-                d = *dstp;
-                /*
-                 * shift out the middle component (green) to
-                 * the high 16 bits, and process all three RGB
-                 * components at the same time.
-                 */
-                s = (s | s << 16) & 0x03e07c1f;
-                d = (d | d << 16) & 0x03e07c1f;
-                d += (s - d) * alpha >> 5;
-                d &= 0x03e07c1f;
-                *dstp++ = (Uint16)(d | d >> 16);
-                    s = *srcp++;
-                d = *dstp;
-                /*
-                 * shift out the middle component (green) to
-                 * the high 16 bits, and process all three RGB
-                 * components at the same time.
-                 */
-                s = (s | s << 16) & 0x03e07c1f;
-                d = (d | d << 16) & 0x03e07c1f;
-                d += (s - d) * alpha >> 5;
-                d &= 0x03e07c1f;
-                *dstp++ = (Uint16)(d | d >> 16);
-            },{
-                src1 = *(__m64*)srcp; /* 4 src pixels -> src1 */
-                dst1 = *(__m64*)dstp; /* 4 dst pixels -> dst1 */
-
-                /* red -- process the bits in place */
-                src2 = src1;
-                src2 = _mm_and_si64(src2, rmask); /* src & MASKRED -> src2 */
-
-                dst2 = dst1;
-                dst2 = _mm_and_si64(dst2, rmask); /* dst & MASKRED -> dst2 */
-
-                /* blend */
-                src2 = _mm_sub_pi16(src2, dst2);/* src - dst -> src2 */
-                src2 = _mm_mulhi_pi16(src2, mm_alpha); /* src2 * alpha -> src2 */
-                src2 = _mm_slli_pi16(src2, 5); /* src2 << 5 -> src2 */
-                dst2 = _mm_add_pi16(src2, dst2); /* src2 + dst2 -> dst2 */
-                dst2 = _mm_and_si64(dst2, rmask); /* dst2 & MASKRED -> dst2 */
-
-                mm_res = dst2; /* RED -> mm_res */
-                
-                /* green -- process the bits in place */
-                src2 = src1;
-                src2 = _mm_and_si64(src2, gmask); /* src & MASKGREEN -> src2 */
-
-                dst2 = dst1;
-                dst2 = _mm_and_si64(dst2, gmask); /* dst & MASKGREEN -> dst2 */
-
-                /* blend */
-                src2 = _mm_sub_pi16(src2, dst2);/* src - dst -> src2 */
-                src2 = _mm_mulhi_pi16(src2, mm_alpha); /* src2 * alpha -> src2 */
-                src2 = _mm_slli_pi16(src2, 5); /* src2 << 5 -> src2 */
-                dst2 = _mm_add_pi16(src2, dst2); /* src2 + dst2 -> dst2 */
-
-                mm_res = _mm_or_si64(mm_res, dst2); /* RED | GREEN -> mm_res */
-
-                /* blue */
-                src2 = src1; /* src -> src2 */
-                src2 = _mm_and_si64(src2, bmask); /* src & MASKBLUE -> src2[000b 000b 000b 000b] */
-
-                dst2 = dst1; /* dst -> dst2 */
-                dst2 = _mm_and_si64(dst2, bmask); /* dst & MASKBLUE -> dst2[000b 000b 000b 000b] */
-
-                /* blend */
-                src2 = _mm_sub_pi16(src2, dst2);/* src - dst -> src2 */
-                src2 = _mm_mullo_pi16(src2, mm_alpha); /* src2 * alpha -> src2 */
-                src2 = _mm_srli_pi16(src2, 11); /* src2 >> 11 -> src2 */
-                dst2 = _mm_add_pi16(src2, dst2); /* src2 + dst2 -> dst2 */
-                dst2 = _mm_and_si64(dst2, bmask); /* dst2 & MASKBLUE -> dst2 */
-
-                mm_res = _mm_or_si64(mm_res, dst2); /* RED | GREEN | BLUE -> mm_res */
-
-                *(__m64*)dstp = mm_res; /* mm_res -> 4 dst pixels */
-
-                srcp += 4;
-                dstp += 4;
-            }, width);
-            /* *INDENT-ON* */ /* clang-format on */
-            srcp += srcskip;
-            dstp += dstskip;
-        }
-        _mm_empty();
+        Blit16to16SurfaceAlphaSSE2(info, SDL_FALSE);
     }
 }
 
-#endif /* __MMX__ */
+#endif /* HAVE_SSE2_INTRINSICS */
 
 /* fast RGB565->RGB565 blending with surface alpha */
 static void Blit565to565SurfaceAlpha(SDL_BlitInfo *info)
@@ -1392,6 +1312,16 @@ SDL_CalculateBlitA(SDL_Surface *surface)
 #endif
             if (sf->BytesPerPixel == 4 && sf->Amask == 0xff000000 && sf->Gmask == 0xff00 && ((sf->Rmask == 0xff && df->Rmask == 0x1f) || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
                 if (df->Gmask == 0x7e0) {
+#if defined(HAVE_AVX2_INTRINSICS)
+                    if (SDL_HasAVX2()) {
+                        return BlitARGBto565PixelAlphaAVX2;
+                    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+                    if (SDL_HasSSE2()) {
+                        return BlitARGBto565PixelAlphaSSE2;
+                    }
+#endif
                     return BlitARGBto565PixelAlpha;
                 } else if (df->Gmask == 0x3e0) {
                     return BlitARGBto555PixelAlpha;
@@ -1401,20 +1331,18 @@ SDL_CalculateBlitA(SDL_Surface *surface)
 
         case 4:
             if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
-#if defined(__MMX__) || defined(__3dNOW__)
+#if defined(HAVE_SSE2_INTRINSICS)
                 if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
-#ifdef __3dNOW__
-                    if (SDL_Has3DNow()) {
-                        return BlitRGBtoRGBPixelAlphaMMX3DNOW;
+#if defined(HAVE_AVX2_INTRINSICS)
+                    if (SDL_HasAVX2()) {
+                        return BlitRGBtoRGBPixelAlphaAVX2;
                     }
 #endif
-#ifdef __MMX__
-                    if (SDL_HasMMX()) {
-                        return BlitRGBtoRGBPixelAlphaMMX;
+                    if (SDL_HasSSE2()) {
+                        return BlitRGBtoRGBPixelAlphaSSE2;
                     }
-#endif
                 }
-#endif /* __MMX__ || __3dNOW__ */
+#endif /* HAVE_SSE2_INTRINSICS */
                 if (sf->Amask == 0xff000000) {
 #if SDL_ARM_NEON_BLITTERS
                     if (SDL_HasNEON()) {
@@ -1456,18 +1384,18 @@ SDL_CalculateBlitA(SDL_Surface *surface)
             case 2:
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
-#ifdef __MMX__
-                        if (SDL_HasMMX()) {
-                            return Blit565to565SurfaceAlphaMMX;
+#if defined(HAVE_SSE2_INTRINSICS)
+                        if (SDL_HasSSE2()) {
+                            return Blit565to565SurfaceAlphaSSE2;
                         } else
 #endif
                         {
                             return Blit565to565SurfaceAlpha;
                         }
                     } else if (df->Gmask == 0x3e0) {
-#ifdef __MMX__
-                        if (SDL_HasMMX()) {
-                            return Blit555to555SurfaceAlphaMMX;
+#if defined(HAVE_SSE2_INTRINSICS)
+                        if (SDL_HasSSE2()) {
+                            return Blit555to555SurfaceAlphaSSE2;
                         } else
 #endif
                         {
@@ -1479,9 +1407,9 @@ SDL_CalculateBlitA(SDL_Surface *surface)
 
             case 4:
                 if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
-#ifdef __MMX__
-                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasMMX()) {
-                        return BlitRGBtoRGBSurfaceAlphaMMX;
+#if defined(HAVE_SSE2_INTRINSICS)
+                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasSSE2()) {
+                        return BlitRGBtoRGBSurfaceAlphaSSE2;
                     }
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
@@ -45,7 +45,11 @@ enum blit_features
     BLIT_FEATURE_HAS_MMX = 1,
     BLIT_FEATURE_HAS_ALTIVEC = 2,
     BLIT_FEATURE_ALTIVEC_DONT_USE_PREFETCH = 4,
-    BLIT_FEATURE_HAS_ARM_SIMD = 8
+    BLIT_FEATURE_HAS_ARM_SIMD = 8,
+    BLIT_FEATURE_HAS_SSE2 = 16,
+    BLIT_FEATURE_HAS_SSSE3 = 32,
+    BLIT_FEATURE_HAS_AVX2 = 64,
+    BLIT_FEATURE_HAS_NEON = 128
 };
 
 #if SDL_ALTIVEC_BLITTERS
@@ -906,8 +910,13 @@ static enum blit_features GetBlitFeatures(void)
 #pragma altivec_model off
 #endif
 #else
-/* Feature 1 is has-MMX */
-#define GetBlitFeatures() ((SDL_HasMMX() ? BLIT_FEATURE_HAS_MMX : 0) | (SDL_HasARMSIMD() ? BLIT_FEATURE_HAS_ARM_SIMD : 0))
+/* Feature 1 is has-MMX, SSSE3 is assumed on every CPU with SSE4.1 */
+#define GetBlitFeatures() ((SDL_HasMMX() ? BLIT_FEATURE_HAS_MMX : 0) |        \
+                           (SDL_HasARMSIMD() ? BLIT_FEATURE_HAS_ARM_SIMD : 0) | \
+                           (SDL_HasSSE2() ? BLIT_FEATURE_HAS_SSE2 : 0) |       \
+                           (SDL_HasSSE41() ? BLIT_FEATURE_HAS_SSSE3 : 0) |     \
+                           (SDL_HasAVX2() ? BLIT_FEATURE_HAS_AVX2 : 0) |       \
+                           (SDL_HasNEON() ? BLIT_FEATURE_HAS_NEON : 0))
 #endif
 
 #if SDL_ARM_SIMD_BLITTERS
@@ -956,6 +965,13 @@ static void Blit_RGB444_RGB888ARMSIMD(SDL_BlitInfo *info)
                       (((src)&0x0000E000) >> 11) | \
                       (((src)&0x000000C0) >> 6));  \
     }
+/* RGB 8-8-8 --> index of the nearest palette color table */
+#define RGB888_INDEX555(dst, src)                  \
+    {                                              \
+        dst = (int)((((src)&0x00F80000) >> 9) |    \
+                    (((src)&0x0000F800) >> 6) |    \
+                    (((src)&0x000000F8) >> 3));    \
+    }
 static void Blit_RGB888_index8(SDL_BlitInfo *info)
 {
 #ifndef USE_DUFFS_LOOP
@@ -1017,7 +1033,7 @@ static void Blit_RGB888_index8(SDL_BlitInfo *info)
 #ifdef USE_DUFFS_LOOP
             /* *INDENT-OFF* */ /* clang-format off */
             DUFFS_LOOP(
-                RGB888_RGB332(Pixel, *src);
+                RGB888_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             , width);
@@ -1025,30 +1041,30 @@ static void Blit_RGB888_index8(SDL_BlitInfo *info)
 #else
             for (c = width / 4; c; --c) {
                 /* Pack RGB into 8bit pixel */
-                RGB888_RGB332(Pixel, *src);
+                RGB888_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB888_RGB332(Pixel, *src);
+                RGB888_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB888_RGB332(Pixel, *src);
+                RGB888_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB888_RGB332(Pixel, *src);
+                RGB888_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             }
             switch (width & 3) {
             case 3:
-                RGB888_RGB332(Pixel, *src);
+                RGB888_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             case 2:
-                RGB888_RGB332(Pixel, *src);
+                RGB888_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             case 1:
-                RGB888_RGB332(Pixel, *src);
+                RGB888_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             }
@@ -1066,6 +1082,13 @@ static void Blit_RGB888_index8(SDL_BlitInfo *info)
                       (((src)&0x000E0000) >> 15) | \
                       (((src)&0x00000300) >> 8));  \
     }
+/* RGB 10-10-10 --> index of the nearest palette color table */
+#define RGB101010_INDEX555(dst, src)               \
+    {                                              \
+        dst = (int)((((src)&0x3E000000) >> 15) |   \
+                    (((src)&0x000F8000) >> 10) |   \
+                    (((src)&0x000003E0) >> 5));    \
+    }
 static void Blit_RGB101010_index8(SDL_BlitInfo *info)
 {
 #ifndef USE_DUFFS_LOOP
@@ -1127,7 +1150,7 @@ static void Blit_RGB101010_index8(SDL_BlitInfo *info)
 #ifdef USE_DUFFS_LOOP
             /* *INDENT-OFF* */ /* clang-format off */
             DUFFS_LOOP(
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             , width);
@@ -1135,30 +1158,30 @@ static void Blit_RGB101010_index8(SDL_BlitInfo *info)
 #else
             for (c = width / 4; c; --c) {
                 /* Pack RGB into 8bit pixel */
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             }
             switch (width & 3) {
             case 3:
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             case 2:
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             case 1:
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_INDEX555(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             }
@@ -2140,10 +2163,8 @@ static void BlitNto1(SDL_BlitInfo *info)
                 DISEMBLE_RGB(src, srcbpp, srcfmt, Pixel,
                                 sR, sG, sB);
                 if ( 1 ) {
-                    /* Pack RGB into 8bit pixel */
-                    *dst = map[((sR>>5)<<(3+2))|
-                           ((sG>>5)<<(2))  |
-                           ((sB>>6)<<(0))  ];
+                    /* Look up the nearest palette color */
+                    *dst = map[RGB555_INDEX(sR, sG, sB)];
                 }
                 dst++;
                 src += srcbpp;
@@ -2153,9 +2174,8 @@ static void BlitNto1(SDL_BlitInfo *info)
             for (c = width; c; --c) {
                 DISEMBLE_RGB(src, srcbpp, srcfmt, Pixel, sR, sG, sB);
                 if (1) {
-                    /* Pack RGB into 8bit pixel */
-                    *dst = map[((sR >> 5) << (3 + 2)) |
-                               ((sG >> 5) << (2)) | ((sB >> 6) << (0))];
+                    /* Look up the nearest palette color */
+                    *dst = map[RGB555_INDEX(sR, sG, sB)];
                 }
                 dst++;
                 src += srcbpp;
@@ -2527,10 +2547,8 @@ static void BlitNto1Key(SDL_BlitInfo *info)
                 DISEMBLE_RGB(src, srcbpp, srcfmt, Pixel,
                                 sR, sG, sB);
                 if ( (Pixel & rgbmask) != ckey ) {
-                    /* Pack RGB into 8bit pixel */
-                    *dst = (Uint8)palmap[((sR>>5)<<(3+2))|
-                                         ((sG>>5)<<(2))  |
-                                         ((sB>>6)<<(0))  ];
+                    /* Look up the nearest palette color */
+                    *dst = palmap[RGB555_INDEX(sR, sG, sB)];
                 }
                 dst++;
                 src += srcbpp;
@@ -3187,6 +3205,409 @@ static void Blit_3or4_to_3or4__inversed_rgb(SDL_BlitInfo *info)
     }
 }
 
+/* Vectorized blitters for byte aligned 24/32-bit formats and 16-bit RGB.
+   These only handle the straight conversion case (no flags), which is what
+   SDL_ConvertPixels() and SDL_ConvertSurface() hit. */
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+
+#if defined(__ARM_NEON)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
+
+#if defined(HAVE_SSSE3_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+
+/* Byte permutation between two formats with 8 bits per channel */
+typedef struct
+{
+    int srcbpp;
+    int dstbpp;
+    int index[4]; /* source byte for each destination byte, or -1 */
+    Uint8 fill[4]; /* value for destination bytes without a source byte */
+} SDL_BlitSwizzle;
+
+static SDL_bool IsByteChannel(Uint32 mask, Uint8 shift, int bpp)
+{
+    return (mask >> shift) == 0xFF && (shift % 8) == 0 && (shift / 8) < bpp;
+}
+
+static SDL_bool GetBlitSwizzle(const SDL_PixelFormat *srcfmt, const SDL_PixelFormat *dstfmt,
+                               Uint8 alpha, SDL_BlitSwizzle *swizzle)
+{
+    int srcbpp = srcfmt->BytesPerPixel;
+    int dstbpp = dstfmt->BytesPerPixel;
+    int i;
+
+    if ((srcbpp != 3 && srcbpp != 4) || (dstbpp != 3 && dstbpp != 4) ||
+        !IsByteChannel(srcfmt->Rmask, srcfmt->Rshift, srcbpp) ||
+        !IsByteChannel(srcfmt->Gmask, srcfmt->Gshift, srcbpp) ||
+        !IsByteChannel(srcfmt->Bmask, srcfmt->Bshift, srcbpp) ||
+        (srcfmt->Amask && !IsByteChannel(srcfmt->Amask, srcfmt->Ashift, srcbpp)) ||
+        !IsByteChannel(dstfmt->Rmask, dstfmt->Rshift, dstbpp) ||
+        !IsByteChannel(dstfmt->Gmask, dstfmt->Gshift, dstbpp) ||
+        !IsByteChannel(dstfmt->Bmask, dstfmt->Bshift, dstbpp) ||
+        (dstfmt->Amask && !IsByteChannel(dstfmt->Amask, dstfmt->Ashift, dstbpp))) {
+        return SDL_FALSE;
+    }
+
+    swizzle->srcbpp = srcbpp;
+    swizzle->dstbpp = dstbpp;
+    for (i = 0; i < 4; ++i) {
+        swizzle->index[i] = -1;
+        swizzle->fill[i] = 0;
+    }
+    swizzle->index[dstfmt->Rshift / 8] = srcfmt->Rshift / 8;
+    swizzle->index[dstfmt->Gshift / 8] = srcfmt->Gshift / 8;
+    swizzle->index[dstfmt->Bshift / 8] = srcfmt->Bshift / 8;
+    if (dstfmt->Amask) {
+        if (srcfmt->Amask) {
+            swizzle->index[dstfmt->Ashift / 8] = srcfmt->Ashift / 8;
+        } else {
+            swizzle->fill[dstfmt->Ashift / 8] = alpha;
+        }
+    }
+    return SDL_TRUE;
+}
+
+/* Build the 16 byte shuffle and fill vectors, returns the number of pixels
+   converted per 16 bytes, and the smallest row remainder that can be
+   converted with a 16 byte load and store without leaving the row. */
+static int GetBlitSwizzleVectors(const SDL_BlitSwizzle *swizzle, Uint8 shuffle[16], Uint8 fill[16], int *minimum)
+{
+    const int pixels = (swizzle->srcbpp == 3 && swizzle->dstbpp == 3) ? 5 : 4;
+    int i, j;
+
+    SDL_memset(shuffle, 0x80, 16);
+    SDL_memset(fill, 0, 16);
+    for (i = 0; i < pixels; ++i) {
+        for (j = 0; j < swizzle->dstbpp; ++j) {
+            const int pos = i * swizzle->dstbpp + j;
+            if (swizzle->index[j] >= 0) {
+                shuffle[pos] = (Uint8)(i * swizzle->srcbpp + swizzle->index[j]);
+            }
+            fill[pos] = swizzle->fill[j];
+        }
+    }
+    *minimum = (swizzle->srcbpp == 3 || swizzle->dstbpp == 3) ? 6 : 4;
+    return pixels;
+}
+
+static void BlitSwizzleRow(const SDL_BlitSwizzle *swizzle, const Uint8 *src, Uint8 *dst, int width)
+{
+    while (width--) {
+        int j;
+        for (j = 0; j < swizzle->dstbpp; ++j) {
+            dst[j] = (swizzle->index[j] >= 0) ? src[swizzle->index[j]] : swizzle->fill[j];
+        }
+        src += swizzle->srcbpp;
+        dst += swizzle->dstbpp;
+    }
+}
+
+#endif /* HAVE_SSSE3_INTRINSICS || HAVE_NEON_INTRINSICS */
+
+#if defined(HAVE_SSSE3_INTRINSICS)
+SDL_TARGET_SSSE3
+static void BlitSwizzleSSSE3(SDL_BlitInfo *info)
+{
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    SDL_BlitSwizzle swizzle;
+    Uint8 shuffle[16], fill[16];
+    int pixels, minimum, srcstep, dststep;
+    __m128i shufflev, fillv;
+
+    GetBlitSwizzle(info->src_fmt, info->dst_fmt, info->a, &swizzle);
+    pixels = GetBlitSwizzleVectors(&swizzle, shuffle, fill, &minimum);
+    srcstep = pixels * swizzle.srcbpp;
+    dststep = pixels * swizzle.dstbpp;
+    shufflev = _mm_loadu_si128((const __m128i *)shuffle);
+    fillv = _mm_loadu_si128((const __m128i *)fill);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= minimum) {
+            __m128i v = _mm_loadu_si128((const __m128i *)s);
+            v = _mm_or_si128(_mm_shuffle_epi8(v, shufflev), fillv);
+            _mm_storeu_si128((__m128i *)d, v);
+            s += srcstep;
+            d += dststep;
+            n -= pixels;
+        }
+        BlitSwizzleRow(&swizzle, s, d, n);
+
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_SSSE3_INTRINSICS */
+
+#if defined(HAVE_AVX2_INTRINSICS)
+SDL_TARGET_AVX2
+static void BlitSwizzleAVX2(SDL_BlitInfo *info)
+{
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    SDL_BlitSwizzle swizzle;
+    Uint8 shuffle[16], fill[16];
+    int pixels, minimum, srcstep, dststep;
+    __m128i shufflev, fillv;
+    __m256i shufflev2, fillv2;
+
+    GetBlitSwizzle(info->src_fmt, info->dst_fmt, info->a, &swizzle);
+    pixels = GetBlitSwizzleVectors(&swizzle, shuffle, fill, &minimum);
+    srcstep = pixels * swizzle.srcbpp;
+    dststep = pixels * swizzle.dstbpp;
+    shufflev = _mm_loadu_si128((const __m128i *)shuffle);
+    fillv = _mm_loadu_si128((const __m128i *)fill);
+    shufflev2 = _mm256_broadcastsi128_si256(shufflev);
+    fillv2 = _mm256_broadcastsi128_si256(fillv);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        /* Two groups of pixels per iteration, one in each 128-bit lane */
+        while (n >= pixels + minimum) {
+            __m256i v;
+            if (srcstep == 16) {
+                v = _mm256_loadu_si256((const __m256i *)s);
+            } else {
+                v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)s)),
+                                            _mm_loadu_si128((const __m128i *)(s + srcstep)), 1);
+            }
+            v = _mm256_or_si256(_mm256_shuffle_epi8(v, shufflev2), fillv2);
+            if (dststep == 16) {
+                _mm256_storeu_si256((__m256i *)d, v);
+            } else {
+                _mm_storeu_si128((__m128i *)d, _mm256_castsi256_si128(v));
+                _mm_storeu_si128((__m128i *)(d + dststep), _mm256_extracti128_si256(v, 1));
+            }
+            s += 2 * srcstep;
+            d += 2 * dststep;
+            n -= 2 * pixels;
+        }
+        while (n >= minimum) {
+            __m128i v = _mm_loadu_si128((const __m128i *)s);
+            v = _mm_or_si128(_mm_shuffle_epi8(v, shufflev), fillv);
+            _mm_storeu_si128((__m128i *)d, v);
+            s += srcstep;
+            d += dststep;
+            n -= pixels;
+        }
+        BlitSwizzleRow(&swizzle, s, d, n);
+
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if defined(HAVE_NEON_INTRINSICS)
+static SDL_INLINE uint8x16_t SDL_Swizzle_NEON(uint8x16_t v, uint8x16_t shuffle)
+{
+#if defined(__aarch64__)
+    return vqtbl1q_u8(v, shuffle);
+#else
+    uint8x8x2_t table;
+    table.val[0] = vget_low_u8(v);
+    table.val[1] = vget_high_u8(v);
+    return vcombine_u8(vtbl2_u8(table, vget_low_u8(shuffle)), vtbl2_u8(table, vget_high_u8(shuffle)));
+#endif
+}
+
+static void BlitSwizzleNEON(SDL_BlitInfo *info)
+{
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    SDL_BlitSwizzle swizzle;
+    Uint8 shuffle[16], fill[16];
+    int pixels, minimum, srcstep, dststep;
+    uint8x16_t shufflev, fillv;
+
+    GetBlitSwizzle(info->src_fmt, info->dst_fmt, info->a, &swizzle);
+    pixels = GetBlitSwizzleVectors(&swizzle, shuffle, fill, &minimum);
+    srcstep = pixels * swizzle.srcbpp;
+    dststep = pixels * swizzle.dstbpp;
+    shufflev = vld1q_u8(shuffle);
+    fillv = vld1q_u8(fill);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = info->dst_w;
+
+        while (n >= minimum) {
+            /* Out of range indices (0x80) produce zero, like pshufb */
+            uint8x16_t v = vorrq_u8(SDL_Swizzle_NEON(vld1q_u8(s), shufflev), fillv);
+            vst1q_u8(d, v);
+            s += srcstep;
+            d += dststep;
+            n -= pixels;
+        }
+        BlitSwizzleRow(&swizzle, s, d, n);
+
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+/* Pick a vector byte shuffle for conversions between byte aligned 24/32-bit formats */
+static SDL_BlitFunc ChooseBlitSwizzle(const SDL_PixelFormat *srcfmt, const SDL_PixelFormat *dstfmt)
+{
+#if defined(HAVE_SSSE3_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+    SDL_BlitSwizzle swizzle;
+
+    if (!GetBlitSwizzle(srcfmt, dstfmt, 0, &swizzle)) {
+        return NULL;
+    }
+#if defined(HAVE_AVX2_INTRINSICS)
+    if (GetBlitFeatures() & BLIT_FEATURE_HAS_AVX2) {
+        return BlitSwizzleAVX2;
+    }
+#endif
+#if defined(HAVE_SSSE3_INTRINSICS)
+    if (GetBlitFeatures() & BLIT_FEATURE_HAS_SSSE3) {
+        return BlitSwizzleSSSE3;
+    }
+#endif
+#if defined(HAVE_NEON_INTRINSICS)
+    if (GetBlitFeatures() & BLIT_FEATURE_HAS_NEON) {
+        return BlitSwizzleNEON;
+    }
+#endif
+#endif /* HAVE_SSSE3_INTRINSICS || HAVE_NEON_INTRINSICS */
+    return NULL;
+}
+
+#if defined(HAVE_SSE2_INTRINSICS)
+/* RGB 5-6-5 --> 32-bit RGB, producing the same values as the lookup tables
+   above. Red and blue are v * 255 / 31 rounded down, green is the sum of the
+   high and low byte table entries, and alpha is opaque. */
+static void Blit_RGB565_32SSE2(SDL_BlitInfo *info)
+{
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    const SDL_PixelFormat *dstfmt = info->dst_fmt;
+    const int Ashift = 48 - dstfmt->Rshift - dstfmt->Gshift - dstfmt->Bshift;
+    const __m128i rshift = _mm_cvtsi32_si128(dstfmt->Rshift);
+    const __m128i gshift = _mm_cvtsi32_si128(dstfmt->Gshift);
+    const __m128i bshift = _mm_cvtsi32_si128(dstfmt->Bshift);
+    const __m128i alpha = _mm_set1_epi32((int)(0xFFu << Ashift));
+    const __m128i mask3 = _mm_set1_epi16(0x07);
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i expand5 = _mm_set1_epi16(1053);
+    const __m128i expand3 = _mm_set1_epi16(8290);
+    const __m128i zero = _mm_setzero_si128();
+
+    while (height--) {
+        const Uint16 *s = (const Uint16 *)src;
+        Uint32 *d = (Uint32 *)dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            const __m128i p = _mm_loadu_si128((const __m128i *)s);
+            const __m128i r = _mm_srli_epi16(_mm_mullo_epi16(_mm_srli_epi16(p, 11), expand5), 7);
+            const __m128i g = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(p, 8), mask3), expand3), 8),
+                                            _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(p, 5), mask3), 2));
+            const __m128i b = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(p, mask5), expand5), 7);
+            __m128i lo, hi;
+
+            lo = _mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(r, zero), rshift),
+                              _mm_sll_epi32(_mm_unpacklo_epi16(g, zero), gshift));
+            lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(b, zero), bshift));
+            hi = _mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(r, zero), rshift),
+                              _mm_sll_epi32(_mm_unpackhi_epi16(g, zero), gshift));
+            hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(b, zero), bshift));
+            _mm_storeu_si128((__m128i *)d, _mm_or_si128(lo, alpha));
+            _mm_storeu_si128((__m128i *)(d + 4), _mm_or_si128(hi, alpha));
+            s += 8;
+            d += 8;
+            n -= 8;
+        }
+        while (n--) {
+            const Uint16 p = *s++;
+            const Uint32 r = ((p >> 11) * 1053) >> 7;
+            const Uint32 g = ((((p >> 8) & 0x07) * 8290) >> 8) + (((p >> 5) & 0x07) << 2);
+            const Uint32 b = ((p & 0x1F) * 1053) >> 7;
+            *d++ = (r << dstfmt->Rshift) | (g << dstfmt->Gshift) | (b << dstfmt->Bshift) | (0xFFu << Ashift);
+        }
+
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+/* RGB 8-8-8 --> RGB 5-6-5 or 5-5-5, truncating like RGB888_RGB565() */
+SDL_FORCE_INLINE void Blit_RGB888_16SSE2(SDL_BlitInfo *info, int gbits)
+{
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    const __m128i rmask = _mm_set1_epi32(gbits == 6 ? 0xF800 : 0x7C00);
+    const __m128i gmask = _mm_set1_epi32(gbits == 6 ? 0x07E0 : 0x03E0);
+    const __m128i bmask = _mm_set1_epi32(0x001F);
+    const __m128i rshift = _mm_cvtsi32_si128(gbits == 6 ? 8 : 9);
+    const __m128i gshift = _mm_cvtsi32_si128(gbits == 6 ? 5 : 6);
+
+    while (height--) {
+        const Uint32 *s = (const Uint32 *)src;
+        Uint16 *d = (Uint16 *)dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            __m128i lo = _mm_loadu_si128((const __m128i *)s);
+            __m128i hi = _mm_loadu_si128((const __m128i *)(s + 4));
+
+            lo = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srl_epi32(lo, rshift), rmask),
+                                           _mm_and_si128(_mm_srl_epi32(lo, gshift), gmask)),
+                              _mm_and_si128(_mm_srli_epi32(lo, 3), bmask));
+            hi = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srl_epi32(hi, rshift), rmask),
+                                           _mm_and_si128(_mm_srl_epi32(hi, gshift), gmask)),
+                              _mm_and_si128(_mm_srli_epi32(hi, 3), bmask));
+            /* Sign extend so the signed saturating pack keeps all 16 bits */
+            lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+            hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+            _mm_storeu_si128((__m128i *)d, _mm_packs_epi32(lo, hi));
+            s += 8;
+            d += 8;
+            n -= 8;
+        }
+        while (n--) {
+            const Uint32 p = *s++;
+            if (gbits == 6) {
+                *d++ = (Uint16)(((p & 0x00F80000) >> 8) | ((p & 0x0000FC00) >> 5) | ((p & 0x000000F8) >> 3));
+            } else {
+                *d++ = (Uint16)(((p & 0x00F80000) >> 9) | ((p & 0x0000F800) >> 6) | ((p & 0x000000F8) >> 3));
+            }
+        }
+
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+static void Blit_RGB888_RGB565SSE2(SDL_BlitInfo *info)
+{
+    Blit_RGB888_16SSE2(info, 6);
+}
+
+static void Blit_RGB888_RGB555SSE2(SDL_BlitInfo *info)
+{
+    Blit_RGB888_16SSE2(info, 5);
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
 /* Normal N to N optimized blitters */
 #define NO_ALPHA   1
 #define SET_ALPHA  2
@@ -3218,6 +3639,16 @@ static const struct blit_table normal_blit_2[] = {
       BLIT_FEATURE_HAS_ARM_SIMD, Blit_RGB444_RGB888ARMSIMD, NO_ALPHA | COPY_ALPHA },
 #endif
 #if SDL_HAVE_BLIT_N_RGB565
+#if defined(HAVE_SSE2_INTRINSICS)
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x00FF0000, 0x0000FF00, 0x000000FF,
+      BLIT_FEATURE_HAS_SSE2, Blit_RGB565_32SSE2, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x000000FF, 0x0000FF00, 0x00FF0000,
+      BLIT_FEATURE_HAS_SSE2, Blit_RGB565_32SSE2, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0xFF000000, 0x00FF0000, 0x0000FF00,
+      BLIT_FEATURE_HAS_SSE2, Blit_RGB565_32SSE2, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x0000FF00, 0x00FF0000, 0xFF000000,
+      BLIT_FEATURE_HAS_SSE2, Blit_RGB565_32SSE2, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+#endif
     { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x00FF0000, 0x0000FF00, 0x000000FF,
       0, Blit_RGB565_ARGB8888, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
     { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x000000FF, 0x0000FF00, 0x00FF0000,
@@ -3312,6 +3743,12 @@ static const struct blit_table normal_blit_4[] = {
 #endif
           SET_ALPHA | COPY_ALPHA },
     /* RGB 888 and RGB 565 */
+#if defined(HAVE_SSE2_INTRINSICS)
+    { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x0000F800, 0x000007E0, 0x0000001F,
+      BLIT_FEATURE_HAS_SSE2, Blit_RGB888_RGB565SSE2, NO_ALPHA },
+    { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x00007C00, 0x000003E0, 0x0000001F,
+      BLIT_FEATURE_HAS_SSE2, Blit_RGB888_RGB555SSE2, NO_ALPHA },
+#endif
     { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x0000F800, 0x000007E0, 0x0000001F,
       0, Blit_RGB888_RGB565, NO_ALPHA },
     { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x00007C00, 0x000003E0, 0x0000001F,
@@ -3368,6 +3805,12 @@ SDL_CalculateBlitN(SDL_Surface *surface)
             if (dstfmt->Amask) {
                 a_need = srcfmt->Amask ? COPY_ALPHA : SET_ALPHA;
             }
+            /* Byte aligned 24/32-bit formats only need a byte shuffle */
+            blitfun = ChooseBlitSwizzle(srcfmt, dstfmt);
+            if (blitfun) {
+                return blitfun;
+            }
+
             table = normal_blit[srcfmt->BytesPerPixel - 1];
             for (which = 0; table[which].dstbpp; ++which) {
                 if (MASKOK(srcfmt->Rmask, table[which].srcR) &&
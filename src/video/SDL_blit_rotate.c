@@ -0,0 +1,326 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_cpuinfo.h"
+#include "SDL_blit_rotate.h"
+
+/* Right-angle rotations are done as a transpose in square tiles, so the
+ * source rows being read and the destination rows being written both stay
+ * in cache while a tile is processed.
+ */
+#define ROTATE_TILE_SIZE 32
+
+#if defined(__SSE2__)
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#if defined(__ARM_NEON)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/* Copies the 'w' x 'h' block at (x, y) of the destination, reading destination
+ * pixel (i, j) from 'origin + i * colstep + j * rowstep'.
+ */
+#define DEFINE_TRANSPOSE_BLOCK(bpp, type)                                                 \
+    static void TransposeBlock##bpp(const Uint8 *origin, int colstep, int rowstep,        \
+                                    Uint8 *dst, int dst_pitch, int x, int y, int w, int h) \
+    {                                                                                     \
+        int i, j;                                                                         \
+        for (j = y; j < y + h; ++j) {                                                     \
+            const Uint8 *s = origin + x * colstep + j * rowstep;                          \
+            type *d = (type *)(dst + j * dst_pitch) + x;                                  \
+            for (i = 0; i < w; ++i) {                                                     \
+                *d++ = *(const type *)s;                                                  \
+                s += colstep;                                                             \
+            }                                                                             \
+        }                                                                                 \
+    }
+
+DEFINE_TRANSPOSE_BLOCK(1, Uint8)
+DEFINE_TRANSPOSE_BLOCK(2, Uint16)
+DEFINE_TRANSPOSE_BLOCK(4, Uint32)
+
+/* Copies 'w' pixels into 'dst' in reverse order, 'src' points at the last one. */
+#define DEFINE_REVERSE_ROW(bpp, type)                                             \
+    static void ReverseRow##bpp(const Uint8 *src, Uint8 *dst, int w)              \
+    {                                                                             \
+        const type *s = (const type *)src;                                        \
+        type *d = (type *)dst;                                                    \
+        while (w--) {                                                             \
+            *d++ = *s--;                                                          \
+        }                                                                         \
+    }
+
+DEFINE_REVERSE_ROW(1, Uint8)
+DEFINE_REVERSE_ROW(2, Uint16)
+DEFINE_REVERSE_ROW(4, Uint32)
+
+/* A 4x4 tile of 32-bit pixels: source row 'i' ('src + i * colstep') holds the
+ * four pixels of destination column 'i', which are written to four consecutive
+ * destination rows 'dst_pitch' bytes apart.
+ */
+typedef void (*SDL_Transpose4x4Func)(const Uint8 *src, int colstep, Uint8 *dst, int dst_pitch);
+typedef void (*SDL_ReverseRowFunc)(const Uint8 *src, Uint8 *dst, int w);
+
+#if defined(HAVE_SSE2_INTRINSICS)
+static SDL_INLINE int hasSSE2()
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasSSE2();
+    return val;
+}
+
+static void Transpose4x4_SSE2(const Uint8 *src, int colstep, Uint8 *dst, int dst_pitch)
+{
+    const __m128i r0 = _mm_loadu_si128((const __m128i *)src);
+    const __m128i r1 = _mm_loadu_si128((const __m128i *)(src + colstep));
+    const __m128i r2 = _mm_loadu_si128((const __m128i *)(src + 2 * colstep));
+    const __m128i r3 = _mm_loadu_si128((const __m128i *)(src + 3 * colstep));
+    const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+    _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(dst + dst_pitch), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(dst + 2 * dst_pitch), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128((__m128i *)(dst + 3 * dst_pitch), _mm_unpackhi_epi64(t2, t3));
+}
+
+static void ReverseRow4_SSE2(const Uint8 *src, Uint8 *dst, int w)
+{
+    const Uint32 *s = (const Uint32 *)src;
+    Uint32 *d = (Uint32 *)dst;
+    while (w >= 4) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(s - 3));
+        _mm_storeu_si128((__m128i *)d, _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)));
+        s -= 4;
+        d += 4;
+        w -= 4;
+    }
+    while (w--) {
+        *d++ = *s--;
+    }
+}
+#endif
+
+#if defined(HAVE_NEON_INTRINSICS)
+static SDL_INLINE int hasNEON()
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasNEON();
+    return val;
+}
+
+static void Transpose4x4_NEON(const Uint8 *src, int colstep, Uint8 *dst, int dst_pitch)
+{
+    const uint32x4_t r0 = vld1q_u32((const uint32_t *)src);
+    const uint32x4_t r1 = vld1q_u32((const uint32_t *)(src + colstep));
+    const uint32x4_t r2 = vld1q_u32((const uint32_t *)(src + 2 * colstep));
+    const uint32x4_t r3 = vld1q_u32((const uint32_t *)(src + 3 * colstep));
+    const uint32x4x2_t t01 = vtrnq_u32(r0, r1);
+    const uint32x4x2_t t23 = vtrnq_u32(r2, r3);
+    vst1q_u32((uint32_t *)dst, vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0])));
+    vst1q_u32((uint32_t *)(dst + dst_pitch), vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1])));
+    vst1q_u32((uint32_t *)(dst + 2 * dst_pitch), vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0])));
+    vst1q_u32((uint32_t *)(dst + 3 * dst_pitch), vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1])));
+}
+
+static void ReverseRow4_NEON(const Uint8 *src, Uint8 *dst, int w)
+{
+    const Uint32 *s = (const Uint32 *)src;
+    Uint32 *d = (Uint32 *)dst;
+    while (w >= 4) {
+        const uint32x4_t v = vrev64q_u32(vld1q_u32((const uint32_t *)(s - 3)));
+        vst1q_u32((uint32_t *)d, vcombine_u32(vget_high_u32(v), vget_low_u32(v)));
+        s -= 4;
+        d += 4;
+        w -= 4;
+    }
+    while (w--) {
+        *d++ = *s--;
+    }
+}
+#endif
+
+static SDL_Transpose4x4Func GetTranspose4x4Func(void)
+{
+#if defined(HAVE_NEON_INTRINSICS)
+    if (hasNEON()) {
+        return Transpose4x4_NEON;
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (hasSSE2()) {
+        return Transpose4x4_SSE2;
+    }
+#endif
+    return NULL;
+}
+
+static SDL_ReverseRowFunc GetReverseRowFunc(int bpp)
+{
+    switch (bpp) {
+    case 1:
+        return ReverseRow1;
+    case 2:
+        return ReverseRow2;
+    default:
+#if defined(HAVE_NEON_INTRINSICS)
+        if (hasNEON()) {
+            return ReverseRow4_NEON;
+        }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+        if (hasSSE2()) {
+            return ReverseRow4_SSE2;
+        }
+#endif
+        return ReverseRow4;
+    }
+}
+
+static void Transpose(const Uint8 *origin, int colstep, int rowstep, Uint8 *dst, int dst_pitch,
+                      int dst_w, int dst_h, int bpp)
+{
+    SDL_Transpose4x4Func transpose4x4 = (bpp == 4) ? GetTranspose4x4Func() : NULL;
+    int tx, ty;
+
+    for (ty = 0; ty < dst_h; ty += ROTATE_TILE_SIZE) {
+        const int th = SDL_min(ROTATE_TILE_SIZE, dst_h - ty);
+        for (tx = 0; tx < dst_w; tx += ROTATE_TILE_SIZE) {
+            const int tw = SDL_min(ROTATE_TILE_SIZE, dst_w - tx);
+            int y = ty;
+
+            if (transpose4x4) {
+                /* Each 4x4 block reads four pixels from four source rows. When the
+                 * source is walked backwards the lowest address belongs to the
+                 * last destination row, so the block is stored bottom up.
+                 */
+                const int first = (rowstep < 0) ? 3 : 0;
+                const int pitch = (rowstep < 0) ? -dst_pitch : dst_pitch;
+                const int tw4 = tw & ~3;
+                for (; y + 4 <= ty + th; y += 4) {
+                    int x;
+                    for (x = tx; x < tx + tw4; x += 4) {
+                        transpose4x4(origin + x * colstep + (y + first) * rowstep, colstep,
+                                     dst + (y + first) * dst_pitch + x * 4, pitch);
+                    }
+                    if (tw4 < tw) {
+                        TransposeBlock4(origin, colstep, rowstep, dst, dst_pitch, tx + tw4, y, tw - tw4, 4);
+                    }
+                }
+            }
+
+            if (y < ty + th) {
+                switch (bpp) {
+                case 1:
+                    TransposeBlock1(origin, colstep, rowstep, dst, dst_pitch, tx, y, tw, ty + th - y);
+                    break;
+                case 2:
+                    TransposeBlock2(origin, colstep, rowstep, dst, dst_pitch, tx, y, tw, ty + th - y);
+                    break;
+                default:
+                    TransposeBlock4(origin, colstep, rowstep, dst, dst_pitch, tx, y, tw, ty + th - y);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void SDL_BlitRotate90(const void *src, int src_pitch, void *dst, int dst_pitch,
+                      int width, int height, int bpp, int angle, SDL_bool flipx, SDL_bool flipy)
+{
+    const int dst_w = (angle & 1) ? height : width;
+    const int dst_h = (angle & 1) ? width : height;
+    const Uint8 *origin;
+    int colstep, rowstep; /* source byte offsets per destination column / row */
+    int x0 = 0, y0 = 0;   /* source pixel that lands on the destination origin */
+
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    switch (angle & 3) { /* 0:0 deg, 1:90 deg, 2:180 deg, 3:270 deg */
+    case 0:
+        colstep = bpp;
+        rowstep = src_pitch;
+        break;
+    case 1:
+        colstep = -src_pitch;
+        rowstep = bpp;
+        y0 = height - 1;
+        break;
+    case 2:
+        colstep = -bpp;
+        rowstep = -src_pitch;
+        x0 = width - 1;
+        y0 = height - 1;
+        break;
+    case 3:
+    default:
+        colstep = src_pitch;
+        rowstep = -bpp;
+        x0 = width - 1;
+        break;
+    }
+    if (flipx) {
+        x0 = width - 1 - x0;
+        if (angle & 1) {
+            rowstep = -rowstep;
+        } else {
+            colstep = -colstep;
+        }
+    }
+    if (flipy) {
+        y0 = height - 1 - y0;
+        if (angle & 1) {
+            colstep = -colstep;
+        } else {
+            rowstep = -rowstep;
+        }
+    }
+    origin = (const Uint8 *)src + y0 * src_pitch + x0 * bpp;
+
+    if (angle & 1) {
+        Transpose(origin, colstep, rowstep, (Uint8 *)dst, dst_pitch, dst_w, dst_h, bpp);
+    } else if (colstep > 0) {
+        int y;
+        for (y = 0; y < dst_h; ++y) {
+            SDL_memcpy((Uint8 *)dst + y * dst_pitch, origin + y * rowstep, (size_t)dst_w * bpp);
+        }
+    } else {
+        SDL_ReverseRowFunc reverse = GetReverseRowFunc(bpp);
+        int y;
+        for (y = 0; y < dst_h; ++y) {
+            reverse(origin + y * rowstep, (Uint8 *)dst + y * dst_pitch, dst_w);
+        }
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,37 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_blit_rotate_h_
+#define SDL_blit_rotate_h_
+
+#include "SDL_stdinc.h"
+
+/* Copies a 'width' x 'height' block of 'bpp' byte pixels (1, 2 or 4) from 'src'
+ * to 'dst', rotated clockwise by 'angle' quarter turns (0-3). The source is
+ * mirrored horizontally and/or vertically before rotating if requested.
+ * For odd angles the destination must be 'height' x 'width' pixels.
+ */
+extern void SDL_BlitRotate90(const void *src, int src_pitch, void *dst, int dst_pitch,
+                             int width, int height, int bpp, int angle, SDL_bool flipx, SDL_bool flipy);
+
+#endif /* SDL_blit_rotate_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
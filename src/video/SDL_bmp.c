@@ -37,6 +37,14 @@
 #include "SDL_endian.h"
 #include "SDL_pixels_c.h"
 
+#if defined(HAVE_STDIO_H) && defined(HAVE_MPROTECT) && defined(HAVE_SYSCONF) && !defined(__EMSCRIPTEN__)
+#define SDL_BMP_MMAP
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #define SAVE_32BIT_BMP
 
 /* Compression encodings for BMP files */
@@ -47,6 +55,10 @@
 #define BI_BITFIELDS 3
 #endif
 
+/* Uncompressed pixel data at least this big is read through a temporary
+   mapping of the file, instead of being copied through the stdio buffer. */
+#define BMP_MAP_MIN_SIZE (64 * 1024)
+
 /* Logical color space values for BMP files */
 #ifndef LCS_WINDOWS_COLOR_SPACE
 /* 0x57696E20 == "Win " */
@@ -166,55 +178,126 @@ static SDL_bool readRlePixels(SDL_Surface *surface, SDL_RWops *src, int isRle8)
     }
 }
 
-static void CorrectAlphaChannel(SDL_Surface *surface)
+/* Check a row of 32-bit pixels in file order for alpha channel data */
+static SDL_bool HasAlphaChannel(const Uint8 *row, int width)
 {
-    /* Check to see if there is any alpha channel data */
-    SDL_bool hasAlpha = SDL_FALSE;
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-    int alphaChannelOffset = 0;
-#else
-    int alphaChannelOffset = 3;
-#endif
-    Uint8 *alpha = ((Uint8 *)surface->pixels) + alphaChannelOffset;
-    Uint8 *end = alpha + surface->h * surface->pitch;
+    int i;
 
-    while (alpha < end) {
-        if (*alpha != 0) {
-            hasAlpha = SDL_TRUE;
-            break;
+    for (i = 0; i < width; ++i) {
+        if (row[i * 4 + 3] != 0) {
+            return SDL_TRUE;
         }
-        alpha += 4;
     }
+    return SDL_FALSE;
+}
+
+static void SetOpaqueAlpha(SDL_Surface *surface)
+{
+    const Uint32 Amask = surface->format->Amask;
+    Uint8 *bits = (Uint8 *)surface->pixels;
+    int i, y;
 
-    if (!hasAlpha) {
-        alpha = ((Uint8 *)surface->pixels) + alphaChannelOffset;
-        while (alpha < end) {
-            *alpha = SDL_ALPHA_OPAQUE;
-            alpha += 4;
+    for (y = 0; y < surface->h; ++y, bits += surface->pitch) {
+        if (surface->format->BytesPerPixel == 2) {
+            Uint16 *pix = (Uint16 *)bits;
+            for (i = 0; i < surface->w; ++i) {
+                pix[i] |= (Uint16)Amask;
+            }
+        } else if (surface->format->BytesPerPixel == 4) {
+            Uint32 *pix = (Uint32 *)bits;
+            for (i = 0; i < surface->w; ++i) {
+                pix[i] |= Amask;
+            }
         }
     }
 }
 
-SDL_Surface *
-SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
+#ifdef SDL_BMP_MMAP
+typedef struct BMPMapping
+{
+    void *base;
+    size_t size;
+} BMPMapping;
+
+static void UnmapPixelData(void *pixels, void *userdata)
+{
+    BMPMapping *mapping = (BMPMapping *)userdata;
+
+    (void)pixels;
+    munmap(mapping->base, mapping->size);
+    SDL_free(mapping);
+}
+
+/* Map size bytes at offset of a stdio stream, or return NULL and let the
+   caller read them instead. The mapping is private and writable. */
+static BMPMapping *MapPixelData(SDL_RWops *src, Sint64 offset, size_t size, const Uint8 **pixels)
+{
+    BMPMapping *mapping;
+    struct stat st;
+    long pagesize;
+    Sint64 start;
+    int fd;
+
+    if (src->type != SDL_RWOPS_STDFILE || size < BMP_MAP_MIN_SIZE) {
+        return NULL;
+    }
+    fd = fileno(src->hidden.stdio.fp);
+    pagesize = sysconf(_SC_PAGESIZE);
+    if (fd < 0 || pagesize <= 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)) {
+        return NULL;
+    }
+    /* A short file is left to the reads, which report the error */
+    if (offset < 0 || offset > (Sint64)st.st_size || (Uint64)(st.st_size - offset) < (Uint64)size) {
+        return NULL;
+    }
+    start = offset - (offset % pagesize);
+    if ((Sint64)(off_t)start != start) {
+        return NULL;
+    }
+
+    mapping = (BMPMapping *)SDL_malloc(sizeof(*mapping));
+    if (mapping == NULL) {
+        return NULL;
+    }
+    mapping->size = (size_t)(offset - start) + size;
+    mapping->base = mmap(NULL, mapping->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, (off_t)start);
+    if (mapping->base == MAP_FAILED) {
+        SDL_free(mapping);
+        return NULL;
+    }
+    *pixels = (const Uint8 *)mapping->base + (offset - start);
+    return mapping;
+}
+#endif /* SDL_BMP_MMAP */
+
+static SDL_Surface *LoadBMP(SDL_RWops *src, int freesrc, Uint32 format)
 {
     SDL_bool was_error;
     Sint64 fp_offset = 0;
-    int bmpPitch;
-    int i, pad;
+    int i, y;
     SDL_Surface *surface;
+    SDL_Surface *rows = NULL;
     Uint32 Rmask = 0;
     Uint32 Gmask = 0;
     Uint32 Bmask = 0;
     Uint32 Amask = 0;
     SDL_Palette *palette;
     Uint8 *bits;
-    Uint8 *top, *end;
     SDL_bool topDown;
     int ExpandBMP;
+    int bytesPerPixel = 0;
+    Uint32 imageFormat;
+    size_t srcPitch = 0;
+    size_t imageSize = 0;
+    const Uint8 *pixelData = NULL;
+    Uint8 *rowBuffer = NULL;
+#ifdef SDL_BMP_MMAP
+    BMPMapping *mapping = NULL;
+#endif
     SDL_bool haveRGBMasks = SDL_FALSE;
     SDL_bool haveAlphaMask = SDL_FALSE;
     SDL_bool correctAlpha = SDL_FALSE;
+    SDL_bool hasAlpha = SDL_FALSE;
 
     /* The Win32 BMP file header (14 bytes) */
     char magic[2];
@@ -421,10 +504,86 @@ SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
         break;
     }
 
+    /* Find the size of the uncompressed pixel data, rows are 4-byte aligned */
+    if ((biCompression != BI_RLE4) && (biCompression != BI_RLE8)) {
+        size_t rowBits;
+        bytesPerPixel = (biBitCount + 7) / 8;
+        if (!SDL_size_mul_overflow((size_t)biWidth, ExpandBMP ? ExpandBMP : (bytesPerPixel * 8), &rowBits) &&
+            !SDL_size_add_overflow(rowBits, 31, &rowBits)) {
+            srcPitch = (rowBits / 32) * 4;
+            if (srcPitch > SDL_MAX_SINT32 || SDL_size_mul_overflow(srcPitch, (size_t)biHeight, &imageSize)) {
+                srcPitch = 0;
+            }
+        }
+    }
+
+    /* Uncompressed images with 16 bits per pixel or more can be converted
+       to the requested format a row at a time while they're read */
+    imageFormat = SDL_MasksToPixelFormatEnum(biBitCount, Rmask, Gmask, Bmask, Amask);
+    if (format == imageFormat) {
+        format = SDL_PIXELFORMAT_UNKNOWN;
+    }
+    if (format != SDL_PIXELFORMAT_UNKNOWN && srcPitch && !ExpandBMP && bytesPerPixel >= 2 &&
+        !SDL_ISPIXELFORMAT_INDEXED(format) && !SDL_ISPIXELFORMAT_FOURCC(format)) {
+        rows = SDL_CreateRGBSurfaceFrom(NULL, biWidth, 1, biBitCount, (int)srcPitch,
+                                        Rmask, Gmask, Bmask, Amask);
+        if (rows == NULL) {
+            was_error = SDL_TRUE;
+            goto done;
+        }
+        SDL_SetSurfaceBlendMode(rows, SDL_BLENDMODE_NONE);
+    }
+
+    /* Read the pixel data in place if it's in memory, or can be mapped */
+    if (srcPitch) {
+        const Sint64 offset = fp_offset + bfOffBits;
+        if (src->type == SDL_RWOPS_MEMORY || src->type == SDL_RWOPS_MEMORY_RO) {
+            const Sint64 size = (Sint64)(src->hidden.mem.stop - src->hidden.mem.base);
+            if (offset <= size && (Uint64)(size - offset) >= (Uint64)imageSize) {
+                pixelData = src->hidden.mem.base + offset;
+            }
+        }
+#ifdef SDL_BMP_MMAP
+        mapping = MapPixelData(src, offset, imageSize, &pixelData);
+
+        /* A top-down 32-bit image can use the mapping as its pixels */
+        if (mapping && format == SDL_PIXELFORMAT_UNKNOWN && imageFormat != SDL_PIXELFORMAT_UNKNOWN &&
+            biBitCount == 32 && topDown && ((uintptr_t)pixelData % 4) == 0 &&
+            SDL_BYTEORDER == SDL_LIL_ENDIAN && SDL_GetHintBoolean(SDL_HINT_BMP_LOAD_MAPPED, SDL_FALSE)) {
+            surface = SDL_CreateSurfaceFromOwnedPixels((void *)pixelData, biWidth, biHeight, (int)srcPitch,
+                                                       imageFormat, UnmapPixelData, mapping);
+            mapping = NULL;
+            if (surface == NULL) {
+                was_error = SDL_TRUE;
+                goto done;
+            }
+            if (correctAlpha) {
+                for (y = 0; y < biHeight && !hasAlpha; ++y) {
+                    hasAlpha = HasAlphaChannel(pixelData + y * srcPitch, biWidth);
+                }
+                if (!hasAlpha) {
+                    SetOpaqueAlpha(surface);
+                }
+            }
+            SDL_RWseek(src, offset + imageSize, RW_SEEK_SET);
+            goto done;
+        }
+#endif
+    }
+
     /* Create a compatible surface, note that the colors are RGB ordered */
-    surface =
-        SDL_CreateRGBSurface(0, biWidth, biHeight, biBitCount, Rmask, Gmask,
-                             Bmask, Amask);
+    if (rows) {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, biWidth, biHeight, 0, format);
+
+        /* Blend like SDL_ConvertSurface() would set it up */
+        if (surface && !rows->format->Amask) {
+            SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+        }
+    } else {
+        surface =
+            SDL_CreateRGBSurface(0, biWidth, biHeight, biBitCount, Rmask, Gmask,
+                                 Bmask, Amask);
+    }
     if (surface == NULL) {
         was_error = SDL_TRUE;
         goto done;
@@ -495,45 +654,47 @@ SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
         }
         goto done;
     }
-    top = (Uint8 *)surface->pixels;
-    end = (Uint8 *)surface->pixels + (surface->h * surface->pitch);
-    switch (ExpandBMP) {
-    case 1:
-        bmpPitch = (biWidth + 7) >> 3;
-        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
-        break;
-    case 2:
-        bmpPitch = (biWidth + 3) >> 2;
-        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
-        break;
-    case 4:
-        bmpPitch = (biWidth + 1) >> 1;
-        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
-        break;
-    default:
-        pad = ((surface->pitch % 4) ? (4 - (surface->pitch % 4)) : 0);
-        break;
+    if (ExpandBMP || rows) {
+        rowBuffer = (Uint8 *)SDL_malloc(srcPitch);
+        if (rowBuffer == NULL) {
+            SDL_OutOfMemory();
+            was_error = SDL_TRUE;
+            goto done;
+        }
     }
-    if (topDown) {
-        bits = top;
-    } else {
-        bits = end - surface->pitch;
-    }
-    while (bits >= top && bits < end) {
-        switch (ExpandBMP) {
-        case 1:
-        case 2:
-        case 4:
-        {
+    for (y = 0; y < biHeight; ++y) {
+        const Uint8 *row = NULL;
+        const int dsty = topDown ? y : (biHeight - 1 - y);
+
+        bits = (Uint8 *)surface->pixels + (size_t)dsty * surface->pitch;
+
+        /* Get the row from memory, or read it; rows in the format of the
+           surface are read straight into it */
+        if (pixelData) {
+            row = pixelData + y * srcPitch;
+            if (!ExpandBMP && !rows) {
+                SDL_memcpy(bits, row, srcPitch);
+            }
+        } else {
+            /* The padding after packed pixels is optional */
+            const size_t needed = ExpandBMP ? ((size_t)biWidth * ExpandBMP + 7) / 8 : srcPitch;
+            if (SDL_RWread(src, (ExpandBMP || rows) ? rowBuffer : bits, 1, srcPitch) < needed) {
+                SDL_Error(SDL_EFREAD);
+                was_error = SDL_TRUE;
+                goto done;
+            }
+            row = rowBuffer;
+        }
+        if (correctAlpha && !hasAlpha) {
+            hasAlpha = HasAlphaChannel(rows ? row : bits, biWidth);
+        }
+
+        if (ExpandBMP) {
             Uint8 pixel = 0;
             int shift = (8 - ExpandBMP);
             for (i = 0; i < surface->w; ++i) {
                 if (i % (8 / ExpandBMP) == 0) {
-                    if (!SDL_RWread(src, &pixel, 1, 1)) {
-                        SDL_Error(SDL_EFREAD);
-                        was_error = SDL_TRUE;
-                        goto done;
-                    }
+                    pixel = *row++;
                 }
                 bits[i] = (pixel >> shift);
                 if (bits[i] >= biClrUsed) {
@@ -543,14 +704,43 @@ SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
                 }
                 pixel <<= ExpandBMP;
             }
-        } break;
+        } else if (rows) {
+            SDL_Rect srcrect, dstrect;
 
-        default:
-            if (SDL_RWread(src, bits, 1, surface->pitch) != surface->pitch) {
-                SDL_Error(SDL_EFREAD);
+            /* The blitters expect aligned pixels */
+            if (((uintptr_t)row % bytesPerPixel) != 0 && bytesPerPixel != 3) {
+                SDL_memcpy(rowBuffer, row, srcPitch);
+                row = rowBuffer;
+            }
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+            if (row != rowBuffer) {
+                SDL_memcpy(rowBuffer, row, srcPitch);
+                row = rowBuffer;
+            }
+            if (bytesPerPixel == 2) {
+                Uint16 *pix = (Uint16 *)rowBuffer;
+                for (i = 0; i < biWidth; i++) {
+                    pix[i] = SDL_Swap16(pix[i]);
+                }
+            } else if (bytesPerPixel == 4) {
+                Uint32 *pix = (Uint32 *)rowBuffer;
+                for (i = 0; i < biWidth; i++) {
+                    pix[i] = SDL_Swap32(pix[i]);
+                }
+            }
+#endif
+            rows->pixels = (void *)row;
+            srcrect.x = 0;
+            srcrect.y = 0;
+            srcrect.w = biWidth;
+            srcrect.h = 1;
+            dstrect = srcrect;
+            dstrect.y = dsty;
+            if (SDL_LowerBlit(rows, &srcrect, surface, &dstrect) < 0) {
                 was_error = SDL_TRUE;
                 goto done;
             }
+        } else {
             if (biBitCount == 8 && palette && biClrUsed < (1u << biBitCount)) {
                 for (i = 0; i < surface->w; ++i) {
                     if (bits[i] >= biClrUsed) {
@@ -584,25 +774,31 @@ SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
             }
             }
 #endif
-            break;
-        }
-        /* Skip padding bytes, ugh */
-        if (pad) {
-            Uint8 padbyte;
-            for (i = 0; i < pad; ++i) {
-                SDL_RWread(src, &padbyte, 1, 1);
-            }
-        }
-        if (topDown) {
-            bits += surface->pitch;
-        } else {
-            bits -= surface->pitch;
         }
     }
-    if (correctAlpha) {
-        CorrectAlphaChannel(surface);
+    if (pixelData) {
+        /* Leave the stream after the pixel data, as if it was read */
+        SDL_RWseek(src, fp_offset + bfOffBits + imageSize, RW_SEEK_SET);
+    }
+    if (correctAlpha && !hasAlpha) {
+        SetOpaqueAlpha(surface);
     }
 done:
+#ifdef SDL_BMP_MMAP
+    if (mapping) {
+        UnmapPixelData(NULL, mapping);
+    }
+#endif
+    SDL_free(rowBuffer);
+    SDL_FreeSurface(rows);
+    if (!was_error && format != SDL_PIXELFORMAT_UNKNOWN && surface->format->format != format) {
+        SDL_Surface *converted = SDL_ConvertSurfaceFormat(surface, format, 0);
+        SDL_FreeSurface(surface);
+        surface = converted;
+        if (surface == NULL) {
+            was_error = SDL_TRUE;
+        }
+    }
     if (was_error) {
         if (src) {
             SDL_RWseek(src, fp_offset, RW_SEEK_SET);
@@ -616,6 +812,18 @@ done:
     return surface;
 }
 
+SDL_Surface *
+SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
+{
+    return LoadBMP(src, freesrc, SDL_PIXELFORMAT_UNKNOWN);
+}
+
+SDL_Surface *
+SDL_LoadBMPFormat_RW(SDL_RWops *src, int freesrc, Uint32 format)
+{
+    return LoadBMP(src, freesrc, format);
+}
+
 int SDL_SaveBMP_RW(SDL_Surface *surface, SDL_RWops *dst, int freedst)
 {
     Sint64 fp_offset;
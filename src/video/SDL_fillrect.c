@@ -23,65 +23,49 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_cpuinfo.h"
+#include "SDL_pixels_c.h"
 
-#ifdef __SSE__
-/* *INDENT-OFF* */ /* clang-format off */
+/* Fills of at least this many bytes use non-temporal stores, which write
+   around the cache. A fill bigger than the last level cache would flush out
+   everything else on the way, while a smaller one is usually drawn or
+   blended over right away and is better off staying in the cache. */
+#define SDL_FILLRECT_STREAM_THRESHOLD (16 * 1024 * 1024)
 
-#if defined(_MSC_VER) && !defined(__clang__)
-#define SSE_BEGIN \
-    __m128 c128; \
-    c128.m128_u32[0] = color; \
-    c128.m128_u32[1] = color; \
-    c128.m128_u32[2] = color; \
-    c128.m128_u32[3] = color;
-#else
-#define SSE_BEGIN \
-    __m128 c128; \
-    DECLARE_ALIGNED(Uint32, cccc[4], 16); \
-    cccc[0] = color; \
-    cccc[1] = color; \
-    cccc[2] = color; \
-    cccc[3] = color; \
-    c128 = *(__m128 *)cccc;
+#if defined(__ARM_NEON)
+#define HAVE_NEON_INTRINSICS 1
 #endif
 
-#define SSE_WORK \
-    for (i = n / 64; i--;) { \
-        _mm_stream_ps((float *)(p+0), c128); \
-        _mm_stream_ps((float *)(p+16), c128); \
-        _mm_stream_ps((float *)(p+32), c128); \
-        _mm_stream_ps((float *)(p+48), c128); \
-        p += 64; \
-    }
-
-#define SSE_END
+/* *INDENT-OFF* */ /* clang-format off */
 
-#define DEFINE_SSE_FILLRECT(bpp, type) \
-static void SDL_FillRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
+/* Each row is filled with single pixels until it's aligned for the vector
+   stores, then in blocks of vector stores, then with single pixels again. */
+#define DEFINE_SIMD_FILLRECT(name, target, bpp, type, align, block, BEGIN, WORK, END) \
+target static void SDL_FillRect##bpp##name(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
 { \
     int i, n; \
     Uint8 *p = NULL; \
  \
-    SSE_BEGIN; \
+    BEGIN; \
  \
     while (h--) { \
         n = w * bpp; \
         p = pixels; \
  \
-        if (n > 63) { \
-            int adjust = 16 - ((uintptr_t)p & 15); \
-            if (adjust < 16) { \
-                n -= adjust; \
-                adjust /= bpp; \
-                while (adjust--) { \
-                    *((type *)p) = (type)color; \
-                    p += bpp; \
-                } \
+        if (n >= block) { \
+            int adjust = (int)((align - ((uintptr_t)p & (align - 1))) & (align - 1)); \
+            n -= adjust; \
+            adjust /= bpp; \
+            while (adjust--) { \
+                *((type *)p) = (type)color; \
+                p += bpp; \
+            } \
+            for (i = n / block; i--;) { \
+                WORK; \
+                p += block; \
             } \
-            SSE_WORK; \
         } \
-        if (n & 63) { \
-            int remainder = (n & 63); \
+        if (n % block) { \
+            int remainder = (n % block); \
             remainder /= bpp; \
             while (remainder--) { \
                 *((type *)p) = (type)color; \
@@ -91,42 +75,80 @@ static void SDL_FillRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w
         pixels += pitch; \
     } \
  \
-    SSE_END; \
+    END; \
 }
 
-static void SDL_FillRect1SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
-{
-    int i, n;
+#define DEFINE_SIMD_FILLRECTS(name, target, align, block, BEGIN, WORK, END) \
+    DEFINE_SIMD_FILLRECT(name, target, 1, Uint8, align, block, BEGIN, WORK, END) \
+    DEFINE_SIMD_FILLRECT(name, target, 2, Uint16, align, block, BEGIN, WORK, END) \
+    DEFINE_SIMD_FILLRECT(name, target, 4, Uint32, align, block, BEGIN, WORK, END)
 
-    SSE_BEGIN;
-    while (h--) {
-        Uint8 *p = pixels;
-        n = w;
+#ifdef __SSE__
+#if defined(_MSC_VER) && !defined(__clang__)
+#define SSE_BEGIN \
+    __m128 c128; \
+    c128.m128_u32[0] = color; \
+    c128.m128_u32[1] = color; \
+    c128.m128_u32[2] = color; \
+    c128.m128_u32[3] = color;
+#else
+#define SSE_BEGIN \
+    __m128 c128; \
+    DECLARE_ALIGNED(Uint32, cccc[4], 16); \
+    cccc[0] = color; \
+    cccc[1] = color; \
+    cccc[2] = color; \
+    cccc[3] = color; \
+    c128 = *(__m128 *)cccc;
+#endif
 
-        if (n > 63) {
-            int adjust = 16 - ((uintptr_t)p & 15);
-            if (adjust) {
-                n -= adjust;
-                SDL_memset(p, color, adjust);
-                p += adjust;
-            }
-            SSE_WORK;
-        }
-        if (n & 63) {
-            int remainder = (n & 63);
-            SDL_memset(p, color, remainder);
-        }
-        pixels += pitch;
-    }
+#define SSE_WORK(store) \
+    store((float *)(p+0), c128); \
+    store((float *)(p+16), c128); \
+    store((float *)(p+32), c128); \
+    store((float *)(p+48), c128);
 
-    SSE_END;
-}
-/* DEFINE_SSE_FILLRECT(1, Uint8) */
-DEFINE_SSE_FILLRECT(2, Uint16)
-DEFINE_SSE_FILLRECT(4, Uint32)
+#define SSE_END
+#define SSE_STREAM_END _mm_sfence()
+
+DEFINE_SIMD_FILLRECTS(SSE, , 16, 64, SSE_BEGIN, SSE_WORK(_mm_store_ps), SSE_END)
+DEFINE_SIMD_FILLRECTS(SSEStream, , 16, 64, SSE_BEGIN, SSE_WORK(_mm_stream_ps), SSE_STREAM_END)
+#endif /* __SSE__ */
+
+#if defined(HAVE_AVX2_INTRINSICS)
+#define AVX2_BEGIN \
+    const __m256i c256 = _mm256_set1_epi32((int)color);
+
+#define AVX2_WORK(store) \
+    store((__m256i *)(p+0), c256); \
+    store((__m256i *)(p+32), c256); \
+    store((__m256i *)(p+64), c256); \
+    store((__m256i *)(p+96), c256);
+
+#define AVX2_END
+
+/* Large fills still go through the SSE streaming stores, which were much
+   faster than 256-bit streaming stores in testing */
+DEFINE_SIMD_FILLRECTS(AVX2, SDL_TARGET_AVX2, 32, 128, AVX2_BEGIN, AVX2_WORK(_mm256_store_si256), AVX2_END)
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if defined(HAVE_NEON_INTRINSICS)
+/* NEON has no non-temporal store intrinsics, so there's no streaming version */
+#define NEON_BEGIN \
+    const uint32x4_t c128 = vdupq_n_u32(color);
+
+#define NEON_WORK \
+    vst1q_u32((uint32_t *)(p+0), c128); \
+    vst1q_u32((uint32_t *)(p+16), c128); \
+    vst1q_u32((uint32_t *)(p+32), c128); \
+    vst1q_u32((uint32_t *)(p+48), c128);
+
+#define NEON_END
+
+DEFINE_SIMD_FILLRECTS(NEON, , 16, 64, NEON_BEGIN, NEON_WORK, NEON_END)
+#endif /* HAVE_NEON_INTRINSICS */
 
 /* *INDENT-ON* */ /* clang-format on */
-#endif            /* __SSE__ */
 
 static void SDL_FillRect1(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
 {
@@ -304,6 +326,7 @@ int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
     Uint8 *pixels;
     const SDL_Rect *rect;
     void (*fill_function)(Uint8 * pixels, int pitch, Uint32 color, int w, int h) = NULL;
+    void (*stream_function)(Uint8 * pixels, int pitch, Uint32 color, int w, int h) = NULL;
     int i;
 
     if (dst == NULL) {
@@ -324,6 +347,10 @@ int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
         return SDL_InvalidParamError("SDL_FillRects(): rects");
     }
 
+    if (SDL_UnshareSurfacePixels(dst) < 0) {
+        return -1;
+    }
+
     /* This function doesn't usually work on surfaces < 8 bpp
      * Except: support for 4bits, when filling full size.
      */
@@ -378,11 +405,28 @@ int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
         {
             color |= (color << 8);
             color |= (color << 16);
+#ifdef __SSE__
+            if (SDL_HasSSE()) {
+                stream_function = SDL_FillRect1SSEStream;
+            }
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+            if (SDL_HasAVX2()) {
+                fill_function = SDL_FillRect1AVX2;
+                break;
+            }
+#endif
 #ifdef __SSE__
             if (SDL_HasSSE()) {
                 fill_function = SDL_FillRect1SSE;
                 break;
             }
+#endif
+#if defined(HAVE_NEON_INTRINSICS)
+            if (SDL_HasNEON()) {
+                fill_function = SDL_FillRect1NEON;
+                break;
+            }
 #endif
             fill_function = SDL_FillRect1;
             break;
@@ -391,11 +435,28 @@ int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
         case 2:
         {
             color |= (color << 16);
+#ifdef __SSE__
+            if (SDL_HasSSE()) {
+                stream_function = SDL_FillRect2SSEStream;
+            }
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+            if (SDL_HasAVX2()) {
+                fill_function = SDL_FillRect2AVX2;
+                break;
+            }
+#endif
 #ifdef __SSE__
             if (SDL_HasSSE()) {
                 fill_function = SDL_FillRect2SSE;
                 break;
             }
+#endif
+#if defined(HAVE_NEON_INTRINSICS)
+            if (SDL_HasNEON()) {
+                fill_function = SDL_FillRect2NEON;
+                break;
+            }
 #endif
             fill_function = SDL_FillRect2;
             break;
@@ -410,11 +471,28 @@ int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
 
         case 4:
         {
+#ifdef __SSE__
+            if (SDL_HasSSE()) {
+                stream_function = SDL_FillRect4SSEStream;
+            }
+#endif
+#if defined(HAVE_AVX2_INTRINSICS)
+            if (SDL_HasAVX2()) {
+                fill_function = SDL_FillRect4AVX2;
+                break;
+            }
+#endif
 #ifdef __SSE__
             if (SDL_HasSSE()) {
                 fill_function = SDL_FillRect4SSE;
                 break;
             }
+#endif
+#if defined(HAVE_NEON_INTRINSICS)
+            if (SDL_HasNEON()) {
+                fill_function = SDL_FillRect4NEON;
+                break;
+            }
 #endif
             fill_function = SDL_FillRect4;
             break;
@@ -436,7 +514,12 @@ int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
         pixels = (Uint8 *)dst->pixels + rect->y * dst->pitch +
                  rect->x * dst->format->BytesPerPixel;
 
-        fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+        if (stream_function &&
+            (size_t)rect->w * rect->h * dst->format->BytesPerPixel >= SDL_FILLRECT_STREAM_THRESHOLD) {
+            stream_function(pixels, dst->pitch, color, rect->w, rect->h);
+        } else {
+            fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+        }
     }
 
     /* We're done! */
@@ -653,9 +653,293 @@ void SDL_FreeFormat(SDL_PixelFormat *format)
     SDL_free(format);
 }
 
+/* Inverse palettes, for finding the nearest palette color quickly.
+
+   Palettes allocated by SDL_AllocPalette() are kept in a hash table so the
+   lookup data can be attached to them. It's reset whenever SDL_SetPaletteColors()
+   changes the palette version. Palettes that SDL didn't allocate are searched
+   linearly.
+
+   The RGB cube is split into 8x8x8 boxes, and each box keeps the list of
+   colors that can be the nearest one to some point inside it. A color is left
+   out when its distance to the nearest corner of the box is more than the
+   distance to the farthest corner of another color, so searching the list
+   gives the same answer as searching the whole palette. */
+#define PALETTE_HASH_SIZE 256
+
+#define INVERSE_BOX_SHIFT 5
+#define INVERSE_BOX_SIZE  (1 << INVERSE_BOX_SHIFT)
+#define INVERSE_BOXES     (1 << (3 * (8 - INVERSE_BOX_SHIFT)))
+#define INVERSE_BOX_INDEX(r, g, b) ((((r) >> INVERSE_BOX_SHIFT) << 6) | (((g) >> INVERSE_BOX_SHIFT) << 3) | ((b) >> INVERSE_BOX_SHIFT))
+
+/* Nearest opaque colors for every RGB 5-5-5 value */
+#define INVERSE_CUBE_SIZE (1 << 15)
+
+typedef struct SDL_InversePalette
+{
+    Uint32 version;
+    int ncolors;
+    void *boxes[INVERSE_BOXES]; /* built on first use, see CreateInverseBox() */
+    void *cube;                 /* built on first use by MapNto1() */
+} SDL_InversePalette;
+
+typedef struct SDL_PaletteData
+{
+    SDL_Palette palette; /* must be first */
+    SDL_InversePalette *inverse;
+    struct SDL_PaletteData *next;
+} SDL_PaletteData;
+
+static SDL_PaletteData *palette_hash[PALETTE_HASH_SIZE];
+static SDL_SpinLock palette_hash_lock = 0;
+
+static SDL_PaletteData **GetPaletteHashBucket(const SDL_Palette *palette)
+{
+    return &palette_hash[((uintptr_t)palette / sizeof(void *)) % PALETTE_HASH_SIZE];
+}
+
+static void FreeInversePalette(SDL_InversePalette *inverse)
+{
+    if (inverse) {
+        int i;
+        for (i = 0; i < INVERSE_BOXES; ++i) {
+            SDL_free(inverse->boxes[i]);
+        }
+        SDL_free(inverse->cube);
+        SDL_free(inverse);
+    }
+}
+
+/* Get the up to date inverse palette, or NULL if SDL didn't allocate the palette */
+static SDL_InversePalette *GetInversePalette(const SDL_Palette *palette)
+{
+    SDL_PaletteData *data;
+    SDL_InversePalette *inverse = NULL;
+    SDL_InversePalette *stale = NULL;
+
+    if (palette->ncolors > 256) {
+        return NULL;
+    }
+
+    SDL_AtomicLock(&palette_hash_lock);
+    for (data = *GetPaletteHashBucket(palette); data; data = data->next) {
+        if (&data->palette == palette) {
+            break;
+        }
+    }
+    if (data) {
+        inverse = data->inverse;
+        if (inverse == NULL || inverse->version != palette->version || inverse->ncolors != palette->ncolors) {
+            stale = inverse;
+            inverse = (SDL_InversePalette *)SDL_calloc(1, sizeof(*inverse));
+            if (inverse) {
+                inverse->version = palette->version;
+                inverse->ncolors = palette->ncolors;
+            }
+            data->inverse = inverse;
+        }
+    }
+    SDL_AtomicUnlock(&palette_hash_lock);
+    FreeInversePalette(stale);
+
+    return inverse;
+}
+
+/* Keep the colors of a list that can be the nearest opaque color to some
+   point between lo and hi, in the same order. The list can be NULL for all
+   of the palette. */
+static int FindCandidates(const SDL_Palette *pal, const Uint8 *list, int count,
+                          const int lo[3], const int hi[3], Uint8 *candidates)
+{
+    unsigned int nearest[256];
+    unsigned int limit = ~0U;
+    int i, n;
+
+    for (i = 0; i < count; ++i) {
+        const SDL_Color *color = &pal->colors[list ? list[i] : i];
+        const int ad = color->a - SDL_ALPHA_OPAQUE;
+        const int rn = SDL_max(lo[0] - color->r, 0) + SDL_max(color->r - hi[0], 0);
+        const int gn = SDL_max(lo[1] - color->g, 0) + SDL_max(color->g - hi[1], 0);
+        const int bn = SDL_max(lo[2] - color->b, 0) + SDL_max(color->b - hi[2], 0);
+        const int rf = SDL_max(color->r - lo[0], hi[0] - color->r);
+        const int gf = SDL_max(color->g - lo[1], hi[1] - color->g);
+        const int bf = SDL_max(color->b - lo[2], hi[2] - color->b);
+        const unsigned int farthest = (rf * rf) + (gf * gf) + (bf * bf) + (ad * ad);
+
+        nearest[i] = (rn * rn) + (gn * gn) + (bn * bn) + (ad * ad);
+        limit = SDL_min(limit, farthest);
+    }
+
+    for (i = 0, n = 0; i < count; ++i) {
+        if (nearest[i] <= limit) {
+            candidates[n++] = list ? list[i] : (Uint8)i;
+        }
+    }
+    return n;
+}
+
+/* The candidates for a box are stored as the count minus one, followed by
+   the palette indices in increasing order. There's always at least one.
+   They're picked from the colors in the list, or all of them if it's NULL. */
+static Uint8 *CreateInverseBox(const SDL_Palette *pal, const Uint8 *colors, int ncolors, int box)
+{
+    Uint8 candidates[256];
+    Uint8 *list;
+    int lo[3], hi[3];
+    int i, count;
+
+    lo[0] = (box >> 6) << INVERSE_BOX_SHIFT;
+    lo[1] = ((box >> 3) & 7) << INVERSE_BOX_SHIFT;
+    lo[2] = (box & 7) << INVERSE_BOX_SHIFT;
+    for (i = 0; i < 3; ++i) {
+        hi[i] = lo[i] + INVERSE_BOX_SIZE - 1;
+    }
+    count = FindCandidates(pal, colors, ncolors, lo, hi, candidates);
+
+    list = (Uint8 *)SDL_malloc(1 + count);
+    if (list == NULL) {
+        return NULL;
+    }
+    list[0] = (Uint8)(count - 1);
+    SDL_memcpy(&list[1], candidates, count);
+    return list;
+}
+
+static const Uint8 *GetInverseBox(const SDL_Palette *pal, SDL_InversePalette *inverse,
+                                  const Uint8 *colors, int ncolors, int box)
+{
+    Uint8 *list = (Uint8 *)SDL_AtomicGetPtr(&inverse->boxes[box]);
+
+    if (list == NULL) {
+        list = CreateInverseBox(pal, colors, ncolors, box);
+        if (list && !SDL_AtomicCASPtr(&inverse->boxes[box], NULL, list)) {
+            /* Another thread got there first */
+            SDL_free(list);
+            list = (Uint8 *)SDL_AtomicGetPtr(&inverse->boxes[box]);
+        }
+    }
+    return list;
+}
+
+/* Find the nearest opaque color in a list of candidates */
+static SDL_INLINE Uint8 FindColorInList(const SDL_Palette *pal, const Uint8 *list, int count, int r, int g, int b)
+{
+    unsigned int smallest = ~0U;
+    Uint8 pixel = 0;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const SDL_Color *color = &pal->colors[list[i]];
+        const int rd = color->r - r;
+        const int gd = color->g - g;
+        const int bd = color->b - b;
+        const int ad = color->a - SDL_ALPHA_OPAQUE;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            smallest = distance;
+            pixel = list[i];
+        }
+    }
+    return pixel;
+}
+
+/* Fill in the nearest opaque colors for 2x2x2 entries of the RGB 5-5-5 table,
+   comparing all of them with one candidate at a time */
+static void FillInverseCubeCell(const SDL_Palette *pal, const Uint8 *list, int count, int r, int g, int b, Uint8 *cube)
+{
+    const int r0 = (r << 3) | (r >> 2), r1 = ((r + 1) << 3) | ((r + 1) >> 2);
+    const int g0 = (g << 3) | (g >> 2), g1 = ((g + 1) << 3) | ((g + 1) >> 2);
+    const int b0 = (b << 3) | (b >> 2), b1 = ((b + 1) << 3) | ((b + 1) >> 2);
+    unsigned int smallest[8];
+    Uint8 nearest[8];
+    int i, j;
+
+    SDL_memset(smallest, 0xFF, sizeof(smallest));
+    SDL_zeroa(nearest);
+    for (i = 0; i < count; ++i) {
+        const SDL_Color *color = &pal->colors[list[i]];
+        const int ad = color->a - SDL_ALPHA_OPAQUE;
+        const int rl = color->r - r0, rh = color->r - r1;
+        const int gl = color->g - g0, gh = color->g - g1;
+        const int bl = color->b - b0, bh = color->b - b1;
+        unsigned int rd2[2], gd2[2], bd2[2];
+
+        rd2[0] = (rl * rl) + (ad * ad);
+        rd2[1] = (rh * rh) + (ad * ad);
+        gd2[0] = gl * gl;
+        gd2[1] = gh * gh;
+        bd2[0] = bl * bl;
+        bd2[1] = bh * bh;
+        for (j = 0; j < 8; ++j) {
+            const unsigned int distance = rd2[j >> 2] + gd2[(j >> 1) & 1] + bd2[j & 1];
+            if (distance < smallest[j]) {
+                smallest[j] = distance;
+                nearest[j] = list[i];
+            }
+        }
+    }
+    for (j = 0; j < 8; ++j) {
+        cube[((r + (j >> 2)) << 10) | ((g + ((j >> 1) & 1)) << 5) | (b + (j & 1))] = nearest[j];
+    }
+}
+
+/* Fill a table of the nearest opaque color for every RGB 5-5-5 value.
+   The candidates are narrowed down for 2x2x2 boxes at a time, and then for
+   each box, which covers 4x4x4 entries of the table. */
+static int FillInverseCube(const SDL_Palette *pal, SDL_InversePalette *inverse, Uint8 *cube)
+{
+    int group;
+
+    if (pal->ncolors == 0) {
+        /* There are no candidates, map everything to 0 like SDL_FindColor() */
+        SDL_memset(cube, 0, INVERSE_CUBE_SIZE);
+        return 0;
+    }
+
+    for (group = 0; group < INVERSE_BOXES / 8; ++group) {
+        Uint8 colors[256];
+        int lo[3], hi[3];
+        int i, ncolors;
+
+        lo[0] = (group >> 4) << (INVERSE_BOX_SHIFT + 1);
+        lo[1] = ((group >> 2) & 3) << (INVERSE_BOX_SHIFT + 1);
+        lo[2] = (group & 3) << (INVERSE_BOX_SHIFT + 1);
+        for (i = 0; i < 3; ++i) {
+            hi[i] = lo[i] + 2 * INVERSE_BOX_SIZE - 1;
+        }
+        ncolors = FindCandidates(pal, NULL, pal->ncolors, lo, hi, colors);
+
+        for (i = 0; i < 8; ++i) {
+            const int box = INVERSE_BOX_INDEX(lo[0] + ((i >> 2) & 1) * INVERSE_BOX_SIZE,
+                                              lo[1] + ((i >> 1) & 1) * INVERSE_BOX_SIZE,
+                                              lo[2] + (i & 1) * INVERSE_BOX_SIZE);
+            const int r = (box >> 6) << 2, g = ((box >> 3) & 7) << 2, b = (box & 7) << 2;
+            Uint8 *temp = NULL;
+            const Uint8 *list;
+            int j;
+
+            if (inverse) {
+                list = GetInverseBox(pal, inverse, colors, ncolors, box);
+            } else {
+                list = temp = CreateInverseBox(pal, colors, ncolors, box);
+            }
+            if (list == NULL) {
+                return SDL_OutOfMemory();
+            }
+            for (j = 0; j < 8; ++j) {
+                FillInverseCubeCell(pal, &list[1], list[0] + 1, r + (j & 4) / 2, g + (j & 2), b + (j & 1) * 2, cube);
+            }
+            SDL_free(temp);
+        }
+    }
+    return 0;
+}
+
 SDL_Palette *
 SDL_AllocPalette(int ncolors)
 {
+    SDL_PaletteData *data;
+    SDL_PaletteData **bucket;
     SDL_Palette *palette;
 
     /* Input validation */
@@ -664,15 +948,16 @@ SDL_AllocPalette(int ncolors)
         return NULL;
     }
 
-    palette = (SDL_Palette *)SDL_malloc(sizeof(*palette));
-    if (palette == NULL) {
+    data = (SDL_PaletteData *)SDL_calloc(1, sizeof(*data));
+    if (data == NULL) {
         SDL_OutOfMemory();
         return NULL;
     }
+    palette = &data->palette;
     palette->colors =
         (SDL_Color *)SDL_malloc(ncolors * sizeof(*palette->colors));
     if (!palette->colors) {
-        SDL_free(palette);
+        SDL_free(data);
         SDL_OutOfMemory();
         return NULL;
     }
@@ -682,6 +967,12 @@ SDL_AllocPalette(int ncolors)
 
     SDL_memset(palette->colors, 0xFF, ncolors * sizeof(*palette->colors));
 
+    SDL_AtomicLock(&palette_hash_lock);
+    bucket = GetPaletteHashBucket(palette);
+    data->next = *bucket;
+    *bucket = data;
+    SDL_AtomicUnlock(&palette_hash_lock);
+
     return palette;
 }
 
@@ -740,6 +1031,9 @@ int SDL_SetPaletteColors(SDL_Palette *palette, const SDL_Color *colors,
 
 void SDL_FreePalette(SDL_Palette *palette)
 {
+    SDL_PaletteData **prev;
+    SDL_PaletteData *data = NULL;
+
     if (palette == NULL) {
         SDL_InvalidParamError("palette");
         return;
@@ -747,8 +1041,24 @@ void SDL_FreePalette(SDL_Palette *palette)
     if (--palette->refcount > 0) {
         return;
     }
+
+    SDL_AtomicLock(&palette_hash_lock);
+    for (prev = GetPaletteHashBucket(palette); *prev; prev = &(*prev)->next) {
+        if (&(*prev)->palette == palette) {
+            data = *prev;
+            *prev = data->next;
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&palette_hash_lock);
+
     SDL_free(palette->colors);
-    SDL_free(palette);
+    if (data) {
+        FreeInversePalette(data->inverse);
+        SDL_free(data);
+    } else {
+        SDL_free(palette);
+    }
 }
 
 /*
@@ -785,12 +1095,24 @@ void SDL_DitherColors(SDL_Color *colors, int bpp)
 Uint8 SDL_FindColor(SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
     /* Do colorspace distance matching */
+    SDL_InversePalette *inverse;
     unsigned int smallest;
     unsigned int distance;
     int rd, gd, bd, ad;
     int i;
     Uint8 pixel = 0;
 
+    /* Searching a few colors is quicker than looking up the candidates */
+    if (pal->ncolors > 16 && a == SDL_ALPHA_OPAQUE) {
+        inverse = GetInversePalette(pal);
+        if (inverse) {
+            const Uint8 *list = GetInverseBox(pal, inverse, NULL, pal->ncolors, INVERSE_BOX_INDEX(r, g, b));
+            if (list) {
+                return FindColorInList(pal, &list[1], list[0] + 1, r, g, b);
+            }
+        }
+    }
+
     smallest = ~0;
     for (i = 0; i < pal->ncolors; ++i) {
         rd = pal->colors[i].r - r;
@@ -925,11 +1247,66 @@ void SDL_GetRGBA(Uint32 pixel, const SDL_PixelFormat *format,
     }
 }
 
+/* Palette to palette maps need a SDL_FindColor() search for every color,
+   so the last few are kept around, keyed by the palette contents. */
+#define PALETTE_MAP_CACHE_SIZE 4
+
+typedef struct
+{
+    int src_ncolors;
+    int dst_ncolors;
+    SDL_Color src_colors[256];
+    SDL_Color dst_colors[256];
+    Uint8 map[256];
+} SDL_PaletteMapCacheEntry;
+
+static SDL_PaletteMapCacheEntry palette_map_cache[PALETTE_MAP_CACHE_SIZE];
+static int palette_map_cache_next = 0;
+static SDL_SpinLock palette_map_cache_lock = 0;
+
+static SDL_bool GetCachedPaletteMap(SDL_Palette *src, SDL_Palette *dst, Uint8 *map)
+{
+    SDL_bool found = SDL_FALSE;
+    int i;
+
+    SDL_AtomicLock(&palette_map_cache_lock);
+    for (i = 0; i < PALETTE_MAP_CACHE_SIZE; ++i) {
+        SDL_PaletteMapCacheEntry *entry = &palette_map_cache[i];
+        if (entry->src_ncolors == src->ncolors &&
+            entry->dst_ncolors == dst->ncolors &&
+            SDL_memcmp(entry->src_colors, src->colors, src->ncolors * sizeof(SDL_Color)) == 0 &&
+            SDL_memcmp(entry->dst_colors, dst->colors, dst->ncolors * sizeof(SDL_Color)) == 0) {
+            SDL_memcpy(map, entry->map, sizeof(entry->map));
+            found = SDL_TRUE;
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&palette_map_cache_lock);
+
+    return found;
+}
+
+static void CachePaletteMap(SDL_Palette *src, SDL_Palette *dst, const Uint8 *map)
+{
+    SDL_PaletteMapCacheEntry *entry;
+
+    SDL_AtomicLock(&palette_map_cache_lock);
+    entry = &palette_map_cache[palette_map_cache_next];
+    palette_map_cache_next = (palette_map_cache_next + 1) % PALETTE_MAP_CACHE_SIZE;
+    entry->src_ncolors = src->ncolors;
+    entry->dst_ncolors = dst->ncolors;
+    SDL_memcpy(entry->src_colors, src->colors, src->ncolors * sizeof(SDL_Color));
+    SDL_memcpy(entry->dst_colors, dst->colors, dst->ncolors * sizeof(SDL_Color));
+    SDL_memcpy(entry->map, map, sizeof(entry->map));
+    SDL_AtomicUnlock(&palette_map_cache_lock);
+}
+
 /* Map from Palette to Palette */
 static Uint8 *Map1to1(SDL_Palette *src, SDL_Palette *dst, int *identical)
 {
     Uint8 *map;
     int i;
+    const SDL_bool cacheable = (src->ncolors <= 256 && dst->ncolors <= 256);
 
     if (identical) {
         if (src->ncolors <= dst->ncolors) {
@@ -948,11 +1325,17 @@ static Uint8 *Map1to1(SDL_Palette *src, SDL_Palette *dst, int *identical)
         SDL_OutOfMemory();
         return NULL;
     }
+    if (cacheable && GetCachedPaletteMap(src, dst, map)) {
+        return map;
+    }
     for (i = 0; i < src->ncolors; ++i) {
         map[i] = SDL_FindColor(dst,
                                src->colors[i].r, src->colors[i].g,
                                src->colors[i].b, src->colors[i].a);
     }
+    if (cacheable) {
+        CachePaletteMap(src, dst, map);
+    }
     return map;
 }
 
@@ -983,18 +1366,60 @@ static Uint8 *Map1toN(SDL_PixelFormat *src, Uint8 Rmod, Uint8 Gmod, Uint8 Bmod,
     return map;
 }
 
-/* Map from BitField to Dithered-Palette to Palette */
+/* Map from BitField to Palette, through the nearest color of each RGB 5-5-5 value */
 static Uint8 *MapNto1(SDL_PixelFormat *src, SDL_PixelFormat *dst, int *identical)
 {
-    /* Generate a 256 color dither palette */
-    SDL_Palette dithered;
-    SDL_Color colors[256];
     SDL_Palette *pal = dst->palette;
+    SDL_Color colors[256];
+    SDL_InversePalette *inverse;
+    Uint8 *cube;
+    Uint8 *map;
 
-    dithered.ncolors = 256;
+    /* The blitters pack 3-3-2 pixels directly for the dither palette */
     SDL_DitherColors(colors, 8);
-    dithered.colors = colors;
-    return Map1to1(&dithered, pal, identical);
+    if (pal->ncolors >= 256 && SDL_memcmp(pal->colors, colors, sizeof(colors)) == 0) {
+        *identical = 1;
+        return NULL;
+    }
+    *identical = 0;
+
+    map = (Uint8 *)SDL_malloc(INVERSE_CUBE_SIZE);
+    if (map == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    inverse = GetInversePalette(pal);
+    if (inverse == NULL && pal->ncolors > 256) {
+        int i;
+        for (i = 0; i < INVERSE_CUBE_SIZE; ++i) {
+            const int r = (i >> 10) & 0x1F, g = (i >> 5) & 0x1F, b = i & 0x1F;
+            map[i] = SDL_FindColor(pal, (Uint8)((r << 3) | (r >> 2)), (Uint8)((g << 3) | (g >> 2)), (Uint8)((b << 3) | (b >> 2)), SDL_ALPHA_OPAQUE);
+        }
+        return map;
+    }
+
+    cube = inverse ? (Uint8 *)SDL_AtomicGetPtr(&inverse->cube) : NULL;
+    if (cube) {
+        SDL_memcpy(map, cube, INVERSE_CUBE_SIZE);
+    } else {
+        if (FillInverseCube(pal, inverse, map) < 0) {
+            SDL_free(map);
+            return NULL;
+        }
+        if (inverse) {
+            /* Keep a copy with the palette for the next map */
+            cube = (Uint8 *)SDL_malloc(INVERSE_CUBE_SIZE);
+            if (cube) {
+                SDL_memcpy(cube, map, INVERSE_CUBE_SIZE);
+                if (!SDL_AtomicCASPtr(&inverse->cube, NULL, cube)) {
+                    SDL_free(cube);
+                }
+            }
+        }
+    }
+
+    return map;
 }
 
 SDL_BlitMap *
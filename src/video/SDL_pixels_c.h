@@ -44,6 +44,39 @@ extern void SDL_DitherColors(SDL_Color *colors, int bpp);
 extern Uint8 SDL_FindColor(SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 extern void SDL_DetectPalette(SDL_Palette *pal, SDL_bool *is_opaque, SDL_bool *has_alpha_channel);
 
+/* Pixel conversion functions, from SDL_surface.c */
+typedef int (*SDL_ConvertRowsFunc)(void *data, int y, int rows);
+
+/* Convert the rows of a width x height image in bands of rows, spread across
+   threads if SDL_HINT_CONVERT_THREADS allows it. Bands start on multiples of
+   row_align. Returns 0, or -1 if any band failed. */
+extern int SDL_ConvertInBands(int width, int height, int row_align, SDL_ConvertRowsFunc convert, void *data);
+
+/* Surface functions, from SDL_surface.c */
+typedef void (*SDL_FreePixelsFunc)(void *pixels, void *userdata);
+
+/* Allocate SIMD aligned pixels of surface->h * pitch bytes that the surface
+   owns, reusing freed pixels of a similar size if SDL_HINT_SURFACE_POOL_SIZE
+   allows it. Returns 0, or -1 if out of memory. */
+extern int SDL_AllocOwnedSurfacePixels(SDL_Surface *surface);
+/* Free the pixels that a surface owns and set them to NULL. Only pixels from
+   SDL_AllocOwnedSurfacePixels() go into the pool. */
+extern void SDL_FreeOwnedSurfacePixels(SDL_Surface *surface);
+/* Start and stop watching SDL_HINT_SURFACE_POOL_SIZE, from SDL_InitSubSystem() and SDL_Quit() */
+extern void SDL_InitSurfacePool(void);
+extern void SDL_QuitSurfacePool(void);
+
+/* Create a surface like SDL_CreateRGBSurfaceWithFormatFrom(), which calls
+   free_pixels(pixels, userdata) when it's freed. If the surface can't be
+   created, free_pixels is called before returning NULL. */
+extern SDL_Surface *SDL_CreateSurfaceFromOwnedPixels(void *pixels, int width, int height, int pitch, Uint32 format,
+                                                     SDL_FreePixelsFunc free_pixels, void *userdata);
+
+/* Give a surface its own copy of pixels it shares with other surfaces, see
+   SDL_HINT_SURFACE_COPY_ON_WRITE. Call this before writing to the pixels
+   without locking the surface. Returns 0, or -1 if out of memory. */
+extern int SDL_UnshareSurfacePixels(SDL_Surface *surface);
+
 #endif /* SDL_pixels_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -80,6 +80,65 @@ SDL_GetSpanEnclosingRect(int width, int height,
     return SDL_FALSE;
 }
 
+int SDL_GetClusteredRects(int width, int height, int numrects, const SDL_Rect *rects,
+                          int cost, SDL_Rect *clusters, int maxclusters)
+{
+    SDL_Rect bounds;
+    int i, j, count = 0;
+
+    if (maxclusters < 1) {
+        return SDL_InvalidParamError("maxclusters");
+    }
+
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = width;
+    bounds.h = height;
+
+    for (i = 0; i < numrects; ++i) {
+        SDL_Rect rect, merged;
+
+        if (!SDL_IntersectRect(&rects[i], &bounds, &rect)) {
+            continue;
+        }
+
+        /* Merge with every cluster where the union adds fewer pixels than
+           a separate update costs, including clusters that only become
+           close enough after an earlier merge */
+        j = 0;
+        while (j < count) {
+            SDL_UnionRect(&clusters[j], &rect, &merged);
+            if (merged.w * merged.h <= clusters[j].w * clusters[j].h + rect.w * rect.h + cost) {
+                rect = merged;
+                clusters[j] = clusters[--count];
+                j = 0;
+            } else {
+                ++j;
+            }
+        }
+
+        if (count == maxclusters) {
+            /* Out of room, merge into the cluster that grows the least */
+            int best = 0, best_growth = 0;
+
+            for (j = 0; j < count; ++j) {
+                int growth;
+
+                SDL_UnionRect(&clusters[j], &rect, &merged);
+                growth = merged.w * merged.h - clusters[j].w * clusters[j].h;
+                if (j == 0 || growth < best_growth) {
+                    best = j;
+                    best_growth = growth;
+                }
+            }
+            SDL_UnionRect(&clusters[best], &rect, &rect);
+            clusters[best] = clusters[--count];
+        }
+        clusters[count++] = rect;
+    }
+    return count;
+}
+
 /* For use with the Cohen-Sutherland algorithm for line clipping, in SDL_rect_impl.h */
 #define CODE_BOTTOM 1
 #define CODE_TOP    2
@@ -26,6 +26,11 @@
 
 extern SDL_bool SDL_GetSpanEnclosingRect(int width, int height, int numrects, const SDL_Rect *rects, SDL_Rect *span);
 
+/* Clips rects to a width x height area and gathers them into at most
+   maxclusters rects, merging rects whose union adds at most cost pixels.
+   Returns the number of clusters, or -1 on error. */
+extern int SDL_GetClusteredRects(int width, int height, int numrects, const SDL_Rect *rects, int cost, SDL_Rect *clusters, int maxclusters);
+
 #endif /* SDL_rect_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,717 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_region_c.h"
+
+/* The region operations walk the bands of both regions from top to bottom,
+   the same way as the X11 and pixman region code. */
+
+/* The box storage starts with this many boxes and doubles when it's full */
+#define SDL_REGION_MIN_BOXES 8
+
+typedef SDL_bool (*SDL_RegionBandOp)(SDL_Region *dst,
+                                     const SDL_RegionBox *r1, const SDL_RegionBox *r1_end,
+                                     const SDL_RegionBox *r2, const SDL_RegionBox *r2_end,
+                                     int y1, int y2);
+
+void SDL_InitRegion(SDL_Region *region)
+{
+    SDL_zerop(region);
+}
+
+void SDL_FreeRegion(SDL_Region *region)
+{
+    SDL_free(region->boxes);
+    SDL_zerop(region);
+}
+
+void SDL_ClearRegion(SDL_Region *region)
+{
+    SDL_zero(region->extents);
+    region->numboxes = 0;
+}
+
+static SDL_bool SDL_ReserveRegionBoxes(SDL_Region *region, int count)
+{
+    if (count > region->maxboxes) {
+        const int maxboxes = SDL_max(SDL_max(region->maxboxes * 2, count), SDL_REGION_MIN_BOXES);
+        SDL_RegionBox *boxes = (SDL_RegionBox *)SDL_realloc(region->boxes, maxboxes * sizeof(*boxes));
+        if (boxes == NULL) {
+            SDL_OutOfMemory();
+            return SDL_FALSE;
+        }
+        region->boxes = boxes;
+        region->maxboxes = maxboxes;
+    }
+    return SDL_TRUE;
+}
+
+SDL_FORCE_INLINE SDL_bool SDL_AppendRegionBox(SDL_Region *region, int x1, int y1, int x2, int y2)
+{
+    SDL_RegionBox *box;
+
+    if (region->numboxes == region->maxboxes &&
+        !SDL_ReserveRegionBoxes(region, region->numboxes + 1)) {
+        return SDL_FALSE;
+    }
+    box = &region->boxes[region->numboxes++];
+    box->x1 = x1;
+    box->y1 = y1;
+    box->x2 = x2;
+    box->y2 = y2;
+    return SDL_TRUE;
+}
+
+static void SDL_UpdateRegionExtents(SDL_Region *region)
+{
+    const SDL_RegionBox *box = region->boxes;
+    int i, x1, x2;
+
+    if (region->numboxes == 0) {
+        SDL_zero(region->extents);
+        return;
+    }
+
+    x1 = box[0].x1;
+    x2 = box[0].x2;
+    for (i = 1; i < region->numboxes; ++i) {
+        x1 = SDL_min(x1, box[i].x1);
+        x2 = SDL_max(x2, box[i].x2);
+    }
+    region->extents.x1 = x1;
+    region->extents.y1 = box[0].y1;
+    region->extents.x2 = x2;
+    region->extents.y2 = box[region->numboxes - 1].y2;
+}
+
+int SDL_SetRegionRect(SDL_Region *region, const SDL_Rect *rect)
+{
+    SDL_ClearRegion(region);
+    if (rect->w > 0 && rect->h > 0) {
+        if (!SDL_AppendRegionBox(region, rect->x, rect->y, rect->x + rect->w, rect->y + rect->h)) {
+            return -1;
+        }
+        region->extents = region->boxes[0];
+    }
+    return 0;
+}
+
+int SDL_CopyRegion(SDL_Region *dst, const SDL_Region *src)
+{
+    if (dst == src) {
+        return 0;
+    }
+    if (!SDL_ReserveRegionBoxes(dst, src->numboxes)) {
+        return -1;
+    }
+    if (src->numboxes > 0) {
+        SDL_memcpy(dst->boxes, src->boxes, src->numboxes * sizeof(*src->boxes));
+    }
+    dst->numboxes = src->numboxes;
+    dst->extents = src->extents;
+    return 0;
+}
+
+/* If the band starting at cur_band has the same boxes as the band before it
+   and starts where it ends, extend the previous band over it. Returns the
+   start of the last band. */
+static int SDL_CoalesceRegionBands(SDL_Region *region, int prev_band, int cur_band)
+{
+    SDL_RegionBox *prev = &region->boxes[prev_band];
+    SDL_RegionBox *cur = &region->boxes[cur_band];
+    const int numboxes = region->numboxes - cur_band;
+    int i;
+
+    if (numboxes == 0) {
+        return prev_band;
+    }
+    if (numboxes != cur_band - prev_band || prev->y2 != cur->y1) {
+        return cur_band;
+    }
+    for (i = 0; i < numboxes; ++i) {
+        if (prev[i].x1 != cur[i].x1 || prev[i].x2 != cur[i].x2) {
+            return cur_band;
+        }
+    }
+    for (i = 0; i < numboxes; ++i) {
+        prev[i].y2 = cur[i].y2;
+    }
+    region->numboxes = cur_band;
+    return prev_band;
+}
+
+static SDL_bool SDL_AppendRegionBand(SDL_Region *dst, const SDL_RegionBox *r, const SDL_RegionBox *r_end, int y1, int y2)
+{
+    for (; r != r_end; ++r) {
+        if (!SDL_AppendRegionBox(dst, r->x1, y1, r->x2, y2)) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+SDL_FORCE_INLINE const SDL_RegionBox *SDL_FindRegionBandEnd(const SDL_RegionBox *r, const SDL_RegionBox *r_end)
+{
+    const int y1 = r->y1;
+
+    while (r != r_end && r->y1 == y1) {
+        ++r;
+    }
+    return r;
+}
+
+static int SDL_RegionOp(SDL_Region *dst, const SDL_Region *a, const SDL_Region *b,
+                        SDL_RegionBandOp band_op, SDL_bool append_a, SDL_bool append_b)
+{
+    const SDL_RegionBox *r1 = a->boxes, *r1_end = a->boxes + a->numboxes, *r1_band_end;
+    const SDL_RegionBox *r2 = b->boxes, *r2_end = b->boxes + b->numboxes, *r2_band_end;
+    SDL_Region temp, *result = dst;
+    int ytop, ybot, prev_band = 0, cur_band;
+
+    /* Build the result separately if the sources are needed while writing it */
+    if (dst == a || dst == b) {
+        SDL_InitRegion(&temp);
+        result = &temp;
+    }
+    result->numboxes = 0;
+    if (!SDL_ReserveRegionBoxes(result, a->numboxes + b->numboxes)) {
+        goto failed;
+    }
+
+    ybot = SDL_min(r1->y1, r2->y1);
+    do {
+        /* First the part of the top band that the other region doesn't overlap */
+        r1_band_end = SDL_FindRegionBandEnd(r1, r1_end);
+        r2_band_end = SDL_FindRegionBandEnd(r2, r2_end);
+        if (r1->y1 < r2->y1) {
+            if (append_a) {
+                const int top = SDL_max(r1->y1, ybot);
+                const int bot = SDL_min(r1->y2, r2->y1);
+                if (top != bot) {
+                    cur_band = result->numboxes;
+                    if (!SDL_AppendRegionBand(result, r1, r1_band_end, top, bot)) {
+                        goto failed;
+                    }
+                    prev_band = SDL_CoalesceRegionBands(result, prev_band, cur_band);
+                }
+            }
+            ytop = r2->y1;
+        } else if (r2->y1 < r1->y1) {
+            if (append_b) {
+                const int top = SDL_max(r2->y1, ybot);
+                const int bot = SDL_min(r2->y2, r1->y1);
+                if (top != bot) {
+                    cur_band = result->numboxes;
+                    if (!SDL_AppendRegionBand(result, r2, r2_band_end, top, bot)) {
+                        goto failed;
+                    }
+                    prev_band = SDL_CoalesceRegionBands(result, prev_band, cur_band);
+                }
+            }
+            ytop = r1->y1;
+        } else {
+            ytop = r1->y1;
+        }
+
+        /* Then the part where both bands overlap */
+        ybot = SDL_min(r1->y2, r2->y2);
+        if (ybot > ytop) {
+            cur_band = result->numboxes;
+            if (!band_op(result, r1, r1_band_end, r2, r2_band_end, ytop, ybot)) {
+                goto failed;
+            }
+            prev_band = SDL_CoalesceRegionBands(result, prev_band, cur_band);
+        }
+
+        if (r1->y2 == ybot) {
+            r1 = r1_band_end;
+        }
+        if (r2->y2 == ybot) {
+            r2 = r2_band_end;
+        }
+    } while (r1 != r1_end && r2 != r2_end);
+
+    /* Finally whatever is left of one of the regions */
+    if (r1 != r1_end && append_a) {
+        r1_band_end = SDL_FindRegionBandEnd(r1, r1_end);
+        cur_band = result->numboxes;
+        if (!SDL_AppendRegionBand(result, r1, r1_band_end, SDL_max(r1->y1, ybot), r1->y2)) {
+            goto failed;
+        }
+        SDL_CoalesceRegionBands(result, prev_band, cur_band);
+        for (r1 = r1_band_end; r1 != r1_end; ++r1) {
+            if (!SDL_AppendRegionBox(result, r1->x1, r1->y1, r1->x2, r1->y2)) {
+                goto failed;
+            }
+        }
+    } else if (r2 != r2_end && append_b) {
+        r2_band_end = SDL_FindRegionBandEnd(r2, r2_end);
+        cur_band = result->numboxes;
+        if (!SDL_AppendRegionBand(result, r2, r2_band_end, SDL_max(r2->y1, ybot), r2->y2)) {
+            goto failed;
+        }
+        SDL_CoalesceRegionBands(result, prev_band, cur_band);
+        for (r2 = r2_band_end; r2 != r2_end; ++r2) {
+            if (!SDL_AppendRegionBox(result, r2->x1, r2->y1, r2->x2, r2->y2)) {
+                goto failed;
+            }
+        }
+    }
+
+    SDL_UpdateRegionExtents(result);
+    if (result != dst) {
+        SDL_FreeRegion(dst);
+        *dst = temp;
+    }
+    return 0;
+
+failed:
+    if (result != dst) {
+        SDL_FreeRegion(result);
+    } else {
+        SDL_ClearRegion(dst);
+    }
+    return -1;
+}
+
+/* Appends a span to the band being built from the first box at band,
+   merging it with the last box if they overlap or touch */
+SDL_FORCE_INLINE SDL_bool SDL_AppendRegionSpan(SDL_Region *dst, int band, int x1, int y1, int x2, int y2)
+{
+    if (dst->numboxes > band) {
+        SDL_RegionBox *last = &dst->boxes[dst->numboxes - 1];
+        if (last->x2 >= x1) {
+            last->x2 = SDL_max(last->x2, x2);
+            return SDL_TRUE;
+        }
+    }
+    return SDL_AppendRegionBox(dst, x1, y1, x2, y2);
+}
+
+static SDL_bool SDL_UnionRegionBands(SDL_Region *dst,
+                                     const SDL_RegionBox *r1, const SDL_RegionBox *r1_end,
+                                     const SDL_RegionBox *r2, const SDL_RegionBox *r2_end,
+                                     int y1, int y2)
+{
+    const int band = dst->numboxes;
+
+    while (r1 != r1_end || r2 != r2_end) {
+        const SDL_RegionBox *r;
+
+        if (r2 == r2_end || (r1 != r1_end && r1->x1 < r2->x1)) {
+            r = r1++;
+        } else {
+            r = r2++;
+        }
+        if (!SDL_AppendRegionSpan(dst, band, r->x1, y1, r->x2, y2)) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static SDL_bool SDL_IntersectRegionBands(SDL_Region *dst,
+                                         const SDL_RegionBox *r1, const SDL_RegionBox *r1_end,
+                                         const SDL_RegionBox *r2, const SDL_RegionBox *r2_end,
+                                         int y1, int y2)
+{
+    while (r1 != r1_end && r2 != r2_end) {
+        const int x1 = SDL_max(r1->x1, r2->x1);
+        const int x2 = SDL_min(r1->x2, r2->x2);
+
+        if (x1 < x2 && !SDL_AppendRegionBox(dst, x1, y1, x2, y2)) {
+            return SDL_FALSE;
+        }
+        if (r1->x2 < r2->x2) {
+            ++r1;
+        } else if (r2->x2 < r1->x2) {
+            ++r2;
+        } else {
+            ++r1;
+            ++r2;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static SDL_bool SDL_SubtractRegionBands(SDL_Region *dst,
+                                        const SDL_RegionBox *r1, const SDL_RegionBox *r1_end,
+                                        const SDL_RegionBox *r2, const SDL_RegionBox *r2_end,
+                                        int y1, int y2)
+{
+    int x1 = r1->x1;
+
+    while (r1 != r1_end && r2 != r2_end) {
+        if (r2->x2 <= x1) {
+            /* The subtrahend is left of what's left of the minuend */
+            ++r2;
+        } else if (r2->x1 < r1->x2) {
+            /* The subtrahend cuts the minuend, keep the part left of it */
+            if (r2->x1 > x1 && !SDL_AppendRegionBox(dst, x1, y1, r2->x1, y2)) {
+                return SDL_FALSE;
+            }
+            x1 = r2->x2;
+            if (x1 >= r1->x2) {
+                if (++r1 != r1_end) {
+                    x1 = r1->x1;
+                }
+            } else {
+                ++r2;
+            }
+        } else {
+            /* The subtrahend is right of the minuend */
+            if (!SDL_AppendRegionBox(dst, x1, y1, r1->x2, y2)) {
+                return SDL_FALSE;
+            }
+            if (++r1 != r1_end) {
+                x1 = r1->x1;
+            }
+        }
+    }
+    while (r1 != r1_end) {
+        if (!SDL_AppendRegionBox(dst, x1, y1, r1->x2, y2)) {
+            return SDL_FALSE;
+        }
+        if (++r1 != r1_end) {
+            x1 = r1->x1;
+        }
+    }
+    return SDL_TRUE;
+}
+
+SDL_FORCE_INLINE SDL_bool SDL_RegionBoxesOverlap(const SDL_RegionBox *a, const SDL_RegionBox *b)
+{
+    return (a->x1 < b->x2 && b->x1 < a->x2 && a->y1 < b->y2 && b->y1 < a->y2) ? SDL_TRUE : SDL_FALSE;
+}
+
+SDL_FORCE_INLINE SDL_bool SDL_RegionBoxContains(const SDL_RegionBox *a, const SDL_RegionBox *b)
+{
+    return (a->x1 <= b->x1 && a->x2 >= b->x2 && a->y1 <= b->y1 && a->y2 >= b->y2) ? SDL_TRUE : SDL_FALSE;
+}
+
+int SDL_UnionRegion(SDL_Region *dst, const SDL_Region *a, const SDL_Region *b)
+{
+    if (a == b || SDL_RegionEmpty(b) ||
+        (a->numboxes == 1 && SDL_RegionBoxContains(&a->extents, &b->extents))) {
+        return SDL_CopyRegion(dst, a);
+    }
+    if (SDL_RegionEmpty(a) ||
+        (b->numboxes == 1 && SDL_RegionBoxContains(&b->extents, &a->extents))) {
+        return SDL_CopyRegion(dst, b);
+    }
+    return SDL_RegionOp(dst, a, b, SDL_UnionRegionBands, SDL_TRUE, SDL_TRUE);
+}
+
+int SDL_IntersectRegion(SDL_Region *dst, const SDL_Region *a, const SDL_Region *b)
+{
+    if (a == b) {
+        return SDL_CopyRegion(dst, a);
+    }
+    if (SDL_RegionEmpty(a) || SDL_RegionEmpty(b) ||
+        !SDL_RegionBoxesOverlap(&a->extents, &b->extents)) {
+        SDL_ClearRegion(dst);
+        return 0;
+    }
+    if (b->numboxes == 1 && SDL_RegionBoxContains(&b->extents, &a->extents)) {
+        return SDL_CopyRegion(dst, a);
+    }
+    if (a->numboxes == 1 && SDL_RegionBoxContains(&a->extents, &b->extents)) {
+        return SDL_CopyRegion(dst, b);
+    }
+    return SDL_RegionOp(dst, a, b, SDL_IntersectRegionBands, SDL_FALSE, SDL_FALSE);
+}
+
+int SDL_SubtractRegion(SDL_Region *dst, const SDL_Region *a, const SDL_Region *b)
+{
+    if (a == b) {
+        SDL_ClearRegion(dst);
+        return 0;
+    }
+    if (SDL_RegionEmpty(a) || SDL_RegionEmpty(b) ||
+        !SDL_RegionBoxesOverlap(&a->extents, &b->extents)) {
+        return SDL_CopyRegion(dst, a);
+    }
+    return SDL_RegionOp(dst, a, b, SDL_SubtractRegionBands, SDL_TRUE, SDL_FALSE);
+}
+
+int SDL_UnionRegionRect(SDL_Region *region, const SDL_Rect *rect)
+{
+    SDL_Region other;
+
+    if (rect->w <= 0 || rect->h <= 0) {
+        return 0;
+    }
+    if (SDL_RegionEmpty(region)) {
+        return SDL_SetRegionRect(region, rect);
+    }
+
+    /* A rect below everything else is a new band */
+    if (rect->y >= region->extents.y2) {
+        const int cur_band = region->numboxes;
+        int prev_band = cur_band - 1;
+
+        while (prev_band > 0 && region->boxes[prev_band - 1].y1 == region->boxes[cur_band - 1].y1) {
+            --prev_band;
+        }
+        if (!SDL_AppendRegionBox(region, rect->x, rect->y, rect->x + rect->w, rect->y + rect->h)) {
+            return -1;
+        }
+        SDL_CoalesceRegionBands(region, prev_band, cur_band);
+        region->extents.x1 = SDL_min(region->extents.x1, rect->x);
+        region->extents.x2 = SDL_max(region->extents.x2, rect->x + rect->w);
+        region->extents.y2 = rect->y + rect->h;
+        return 0;
+    }
+
+    other.extents.x1 = rect->x;
+    other.extents.y1 = rect->y;
+    other.extents.x2 = rect->x + rect->w;
+    other.extents.y2 = rect->y + rect->h;
+    other.boxes = &other.extents;
+    other.numboxes = 1;
+    other.maxboxes = 1;
+    return SDL_UnionRegion(region, region, &other);
+}
+
+/* Unions the two halves of the list separately, so every box is only
+   swept through about log2(count) times */
+static int SDL_UnionRegionRectList(SDL_Region *dst, const SDL_Rect *rects, int count)
+{
+    SDL_Region other;
+    const int half = count / 2;
+    int retval;
+
+    if (count == 1) {
+        if (rects->w <= 0 || rects->h <= 0) {
+            SDL_ClearRegion(dst);
+            return 0;
+        }
+        return SDL_SetRegionRect(dst, rects);
+    }
+
+    SDL_InitRegion(&other);
+    if (SDL_UnionRegionRectList(dst, rects, half) < 0 ||
+        SDL_UnionRegionRectList(&other, rects + half, count - half) < 0) {
+        retval = -1;
+    } else {
+        retval = SDL_UnionRegion(dst, dst, &other);
+    }
+    SDL_FreeRegion(&other);
+    return retval;
+}
+
+int SDL_UnionRegionRects(SDL_Region *region, const SDL_Rect *rects, int count)
+{
+    SDL_Region other;
+    int retval;
+
+    if (count <= 0) {
+        return 0;
+    }
+    if (count == 1) {
+        return SDL_UnionRegionRect(region, rects);
+    }
+
+    SDL_InitRegion(&other);
+    retval = SDL_UnionRegionRectList(&other, rects, count);
+    if (retval == 0) {
+        retval = SDL_UnionRegion(region, region, &other);
+    }
+    SDL_FreeRegion(&other);
+    return retval;
+}
+
+int SDL_IntersectRegionRect(SDL_Region *region, const SDL_Rect *rect)
+{
+    SDL_Region other;
+
+    if (rect->w <= 0 || rect->h <= 0) {
+        SDL_ClearRegion(region);
+        return 0;
+    }
+
+    other.extents.x1 = rect->x;
+    other.extents.y1 = rect->y;
+    other.extents.x2 = rect->x + rect->w;
+    other.extents.y2 = rect->y + rect->h;
+    other.boxes = &other.extents;
+    other.numboxes = 1;
+    other.maxboxes = 1;
+    return SDL_IntersectRegion(region, region, &other);
+}
+
+void SDL_TranslateRegion(SDL_Region *region, int dx, int dy)
+{
+    SDL_RegionBox *box = region->boxes;
+    int i;
+
+    if (region->numboxes == 0) {
+        return;
+    }
+    for (i = 0; i < region->numboxes; ++i) {
+        box[i].x1 += dx;
+        box[i].y1 += dy;
+        box[i].x2 += dx;
+        box[i].y2 += dy;
+    }
+    region->extents.x1 += dx;
+    region->extents.y1 += dy;
+    region->extents.x2 += dx;
+    region->extents.y2 += dy;
+}
+
+typedef struct
+{
+    Sint64 area;
+    int index;
+} SDL_RegionGap;
+
+static int SDLCALL SDL_CompareRegionGaps(const void *a, const void *b)
+{
+    const SDL_RegionGap *A = (const SDL_RegionGap *)a;
+    const SDL_RegionGap *B = (const SDL_RegionGap *)b;
+
+    if (A->area != B->area) {
+        return (A->area < B->area) ? -1 : 1;
+    }
+    return A->index - B->index;
+}
+
+SDL_FORCE_INLINE Sint64 SDL_RegionBoxArea(const SDL_RegionBox *box)
+{
+    return (Sint64)(box->x2 - box->x1) * (box->y2 - box->y1);
+}
+
+/* The pixels added by merging the single box bands at i - 1 and i */
+static Sint64 SDL_RegionBandMergeCost(const SDL_RegionBox *box, int i)
+{
+    SDL_RegionBox merged;
+
+    merged.x1 = SDL_min(box[i - 1].x1, box[i].x1);
+    merged.y1 = box[i - 1].y1;
+    merged.x2 = SDL_max(box[i - 1].x2, box[i].x2);
+    merged.y2 = box[i].y2;
+    return SDL_RegionBoxArea(&merged) - SDL_RegionBoxArea(&box[i - 1]) - SDL_RegionBoxArea(&box[i]);
+}
+
+int SDL_SimplifyRegion(SDL_Region *region, int maxboxes)
+{
+    SDL_RegionBox *box = region->boxes;
+    SDL_RegionGap *gaps;
+    int i, count, numgaps, numfill, band_end, prev_band, cur_band;
+
+    if (maxboxes < 1) {
+        return SDL_InvalidParamError("maxboxes");
+    }
+    if (region->numboxes <= maxboxes) {
+        return 0;
+    }
+
+    gaps = (SDL_RegionGap *)SDL_malloc(region->numboxes * sizeof(*gaps));
+    if (gaps == NULL) {
+        return SDL_OutOfMemory();
+    }
+
+    /* Fill the smallest gaps between boxes in the same band. Filling a gap
+       doesn't change any other gap, so they can all be picked at once. */
+    numgaps = 0;
+    for (i = 1; i < region->numboxes; ++i) {
+        if (box[i].y1 == box[i - 1].y1) {
+            gaps[numgaps].area = (Sint64)(box[i].x1 - box[i - 1].x2) * (box[i].y2 - box[i].y1);
+            gaps[numgaps].index = i;
+            ++numgaps;
+        }
+    }
+    numfill = SDL_min(numgaps, region->numboxes - maxboxes);
+    if (numfill < numgaps) {
+        SDL_qsort(gaps, numgaps, sizeof(*gaps), SDL_CompareRegionGaps);
+    }
+    for (i = 0; i < numfill; ++i) {
+        /* Mark the box as merged into the one on its left */
+        box[gaps[i].index].y2 = box[gaps[i].index].y1;
+    }
+
+    /* Remove the merged boxes and coalesce the bands that became equal */
+    count = region->numboxes;
+    region->numboxes = 0;
+    prev_band = 0;
+    for (i = 0; i < count; i = band_end) {
+        cur_band = region->numboxes;
+        for (band_end = i; band_end < count && box[band_end].y1 == box[i].y1; ++band_end) {
+            if (box[band_end].y2 == box[band_end].y1) {
+                box[region->numboxes - 1].x2 = box[band_end].x2;
+            } else {
+                box[region->numboxes++] = box[band_end];
+            }
+        }
+        prev_band = SDL_CoalesceRegionBands(region, prev_band, cur_band);
+    }
+
+    /* If that's not enough, every band is a single box now. Merge the
+       neighbouring bands that add the fewest pixels, one pair at a time. */
+    if (region->numboxes > maxboxes) {
+        for (i = 1; i < region->numboxes; ++i) {
+            gaps[i].area = SDL_RegionBandMergeCost(box, i);
+        }
+        while (region->numboxes > maxboxes) {
+            int best = 1;
+
+            for (i = 2; i < region->numboxes; ++i) {
+                if (gaps[i].area < gaps[best].area) {
+                    best = i;
+                }
+            }
+            box[best - 1].x1 = SDL_min(box[best - 1].x1, box[best].x1);
+            box[best - 1].x2 = SDL_max(box[best - 1].x2, box[best].x2);
+            box[best - 1].y2 = box[best].y2;
+            --region->numboxes;
+            SDL_memmove(&box[best], &box[best + 1], (region->numboxes - best) * sizeof(*box));
+            SDL_memmove(&gaps[best], &gaps[best + 1], (region->numboxes - best) * sizeof(*gaps));
+            if (best > 1) {
+                gaps[best - 1].area = SDL_RegionBandMergeCost(box, best - 1);
+            }
+            if (best < region->numboxes) {
+                gaps[best].area = SDL_RegionBandMergeCost(box, best);
+            }
+        }
+    }
+
+    SDL_free(gaps);
+    return 0;
+}
+
+int SDL_GetRegionRects(const SDL_Region *region, SDL_Rect *rects, int maxrects)
+{
+    const int count = SDL_min(region->numboxes, maxrects);
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const SDL_RegionBox *box = &region->boxes[i];
+        rects[i].x = box->x1;
+        rects[i].y = box->y1;
+        rects[i].w = box->x2 - box->x1;
+        rects[i].h = box->y2 - box->y1;
+    }
+    return region->numboxes;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,83 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_region_c_h_
+#define SDL_region_c_h_
+
+#include "../SDL_internal.h"
+
+#include "SDL_rect.h"
+
+/* A box covers x1 <= x < x2, y1 <= y < y2 */
+typedef struct SDL_RegionBox
+{
+    int x1, y1, x2, y2;
+} SDL_RegionBox;
+
+/* A region is a set of pixels, stored as boxes sorted into bands from top
+   to bottom, like X11 and pixman regions:
+   - all boxes in a band have the same y1 and y2, and bands don't overlap
+   - boxes in a band are sorted from left to right, and don't touch
+   - adjacent bands with the same boxes are merged where possible
+
+   Regions are usually embedded in other structures, initialized with
+   SDL_InitRegion() and released with SDL_FreeRegion(). The functions
+   returning int return 0 on success or -1 if they ran out of memory, and
+   the destination region may be one of the source regions.
+ */
+typedef struct SDL_Region
+{
+    SDL_RegionBox extents;
+    SDL_RegionBox *boxes;
+    int numboxes;
+    int maxboxes;
+} SDL_Region;
+
+SDL_FORCE_INLINE SDL_bool SDL_RegionEmpty(const SDL_Region *region)
+{
+    return (region->numboxes == 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+extern void SDL_InitRegion(SDL_Region *region);
+extern void SDL_FreeRegion(SDL_Region *region);
+extern void SDL_ClearRegion(SDL_Region *region);
+extern int SDL_SetRegionRect(SDL_Region *region, const SDL_Rect *rect);
+extern int SDL_CopyRegion(SDL_Region *dst, const SDL_Region *src);
+
+extern int SDL_UnionRegion(SDL_Region *dst, const SDL_Region *a, const SDL_Region *b);
+extern int SDL_IntersectRegion(SDL_Region *dst, const SDL_Region *a, const SDL_Region *b);
+extern int SDL_SubtractRegion(SDL_Region *dst, const SDL_Region *a, const SDL_Region *b);
+extern int SDL_UnionRegionRect(SDL_Region *region, const SDL_Rect *rect);
+extern int SDL_UnionRegionRects(SDL_Region *region, const SDL_Rect *rects, int count);
+extern int SDL_IntersectRegionRect(SDL_Region *region, const SDL_Rect *rect);
+extern void SDL_TranslateRegion(SDL_Region *region, int dx, int dy);
+
+/* Grows the region until it has at most maxboxes boxes, first by filling
+   the smallest gaps between boxes in the same band, then by merging the
+   neighbouring bands that add the fewest pixels. */
+extern int SDL_SimplifyRegion(SDL_Region *region, int maxboxes);
+
+/* Copies up to maxrects boxes and returns the number of boxes in the region */
+extern int SDL_GetRegionRects(const SDL_Region *region, SDL_Rect *rects, int maxrects);
+
+#endif /* SDL_region_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -20,6 +20,8 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -27,6 +29,7 @@
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
 #include "../render/SDL_sysrender.h"
+#include "../thread/SDL_workerpool_c.h"
 
 /* Check to make sure we can safely check multiplication of surface w and pitch and it won't overflow size_t */
 SDL_COMPILE_TIME_ASSERT(surface_size_assumptions,
@@ -34,6 +37,228 @@ SDL_COMPILE_TIME_ASSERT(surface_size_assumptions,
 
 SDL_COMPILE_TIME_ASSERT(can_indicate_overflow, SDL_SIZE_MAX > SDL_MAX_SINT32);
 
+/* Surfaces are allocated with private data following the public structure */
+typedef struct SDL_SurfaceData
+{
+    SDL_Surface surface; /* must be first */
+    SDL_FreePixelsFunc free_pixels;
+    void *free_pixels_userdata;
+    SDL_bool pooled_pixels; /* the pixels came from SDL_AllocSurfacePixels() */
+} SDL_SurfaceData;
+
+/* Only surfaces from SDL_CreateRGBSurfaceWithFormat() have SDL_SurfaceData,
+   and their blit map points back at them. Surfaces made by
+   SDL_CreateSurfaceOnStack(), by the application, or copied from another
+   surface by value don't. */
+static SDL_SurfaceData *SDL_GetSurfaceData(SDL_Surface *surface)
+{
+    if (surface->map && surface->map->owner == surface) {
+        return (SDL_SurfaceData *)surface;
+    }
+    return NULL;
+}
+
+/* Freed pixel buffers are kept in size classes for reuse, see SDL_HINT_SURFACE_POOL_SIZE */
+#define SURFACE_POOL_MIN_SHIFT   12 /* Smaller buffers are cheap to allocate */
+#define SURFACE_POOL_MAX_SHIFT   30 /* Larger buffers aren't worth keeping */
+#define SURFACE_POOL_STEPS_SHIFT 3  /* 8 classes from one power of two to the next */
+#define SURFACE_POOL_CLASSES     (((SURFACE_POOL_MAX_SHIFT - SURFACE_POOL_MIN_SHIFT) << SURFACE_POOL_STEPS_SHIFT) + 1)
+
+typedef struct SDL_PooledPixels
+{
+    struct SDL_PooledPixels *next;
+} SDL_PooledPixels;
+
+static SDL_PooledPixels *surface_pool[SURFACE_POOL_CLASSES];
+static size_t surface_pool_bytes = 0;
+static size_t surface_pool_limit = 0;
+static SDL_SpinLock surface_pool_lock = 0;
+static SDL_bool surface_pool_watching = SDL_FALSE;
+
+/*
+ * Get the size class of a pixel buffer and its rounded up size.
+ * Returns -1 if buffers of this size aren't pooled.
+ */
+static int SDL_GetSurfacePoolClass(size_t size, size_t *class_size)
+{
+    int shift = SURFACE_POOL_MIN_SHIFT;
+    int step_shift;
+
+    if (size < ((size_t)1 << SURFACE_POOL_MIN_SHIFT) || size >= ((size_t)1 << SURFACE_POOL_MAX_SHIFT)) {
+        *class_size = size;
+        return -1;
+    }
+    while ((size >> shift) > 1) {
+        ++shift;
+    }
+    step_shift = shift - SURFACE_POOL_STEPS_SHIFT;
+    *class_size = ((size + ((size_t)1 << step_shift) - 1) >> step_shift) << step_shift;
+
+    /* A size that rounds up to the next power of two is the first class of that one */
+    return ((shift - SURFACE_POOL_MIN_SHIFT) << SURFACE_POOL_STEPS_SHIFT) +
+           (int)(*class_size >> step_shift) - (1 << SURFACE_POOL_STEPS_SHIFT);
+}
+
+static size_t SDL_GetSurfacePoolClassSize(int index)
+{
+    const int shift = SURFACE_POOL_MIN_SHIFT + (index >> SURFACE_POOL_STEPS_SHIFT);
+    const size_t steps = (size_t)(index & ((1 << SURFACE_POOL_STEPS_SHIFT) - 1)) + (1 << SURFACE_POOL_STEPS_SHIFT);
+
+    return steps << (shift - SURFACE_POOL_STEPS_SHIFT);
+}
+
+/*
+ * Take buffers out of the pool until it holds at most limit bytes, largest first.
+ * This is called with the pool locked, the buffers are returned to be freed after unlocking.
+ */
+static SDL_PooledPixels *SDL_TrimSurfacePool(size_t limit)
+{
+    SDL_PooledPixels *trimmed = NULL;
+    int i;
+
+    for (i = SURFACE_POOL_CLASSES - 1; i >= 0 && surface_pool_bytes > limit; --i) {
+        while (surface_pool[i] && surface_pool_bytes > limit) {
+            SDL_PooledPixels *pixels = surface_pool[i];
+
+            surface_pool[i] = pixels->next;
+            surface_pool_bytes -= SDL_GetSurfacePoolClassSize(i);
+            pixels->next = trimmed;
+            trimmed = pixels;
+        }
+    }
+    return trimmed;
+}
+
+static void SDL_FreePooledPixels(SDL_PooledPixels *pixels)
+{
+    while (pixels) {
+        SDL_PooledPixels *next = pixels->next;
+        SDL_SIMDFree(pixels);
+        pixels = next;
+    }
+}
+
+static void SDLCALL SDL_SurfacePoolSizeChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_PooledPixels *trimmed;
+
+    SDL_AtomicLock(&surface_pool_lock);
+    surface_pool_limit = (hint && *hint) ? (size_t)SDL_strtoull(hint, NULL, 10) : 0;
+    trimmed = SDL_TrimSurfacePool(surface_pool_limit);
+    SDL_AtomicUnlock(&surface_pool_lock);
+
+    SDL_FreePooledPixels(trimmed);
+}
+
+/* Allocate SIMD aligned pixels at the size of their class, reusing pooled ones if possible */
+static void *SDL_AllocSurfacePixels(size_t size)
+{
+    size_t class_size;
+    int index;
+    void *pixels = NULL;
+
+    /* Pooled buffers are always allocated at the class size, so any of them can be reused */
+    index = SDL_GetSurfacePoolClass(size, &class_size);
+    if (index >= 0) {
+        SDL_AtomicLock(&surface_pool_lock);
+        if (surface_pool[index]) {
+            pixels = surface_pool[index];
+            surface_pool[index] = surface_pool[index]->next;
+            surface_pool_bytes -= class_size;
+        }
+        SDL_AtomicUnlock(&surface_pool_lock);
+    }
+    if (pixels == NULL) {
+        pixels = SDL_SIMDAlloc(class_size);
+    }
+    return pixels;
+}
+
+/* Free pixels from SDL_AllocSurfacePixels(), into the pool if there's room */
+static void SDL_FreeSurfacePixels(void *pixels, size_t size)
+{
+    size_t class_size;
+    const int index = SDL_GetSurfacePoolClass(size, &class_size);
+
+    if (pixels == NULL) {
+        return;
+    }
+    if (index >= 0) {
+        SDL_AtomicLock(&surface_pool_lock);
+        if (surface_pool_bytes + class_size <= surface_pool_limit) {
+            ((SDL_PooledPixels *)pixels)->next = surface_pool[index];
+            surface_pool[index] = (SDL_PooledPixels *)pixels;
+            surface_pool_bytes += class_size;
+            pixels = NULL;
+        }
+        SDL_AtomicUnlock(&surface_pool_lock);
+    }
+    SDL_SIMDFree(pixels);
+}
+
+int SDL_AllocOwnedSurfacePixels(SDL_Surface *surface)
+{
+    SDL_SurfaceData *data = SDL_GetSurfaceData(surface);
+    const size_t size = (size_t)surface->h * surface->pitch;
+
+    surface->pixels = data ? SDL_AllocSurfacePixels(size) : SDL_SIMDAlloc(size);
+    if (!surface->pixels) {
+        return SDL_OutOfMemory();
+    }
+    surface->flags |= SDL_SIMD_ALIGNED;
+    if (data) {
+        data->pooled_pixels = SDL_TRUE;
+    }
+    return 0;
+}
+
+void SDL_FreeOwnedSurfacePixels(SDL_Surface *surface)
+{
+    SDL_SurfaceData *data = SDL_GetSurfaceData(surface);
+
+    if (surface->flags & SDL_SIMD_ALIGNED) {
+        if (data && data->pooled_pixels) {
+            SDL_FreeSurfacePixels(surface->pixels, (size_t)surface->h * surface->pitch);
+        } else {
+            /* The application allocated these with SDL_SIMDAlloc() */
+            SDL_SIMDFree(surface->pixels);
+        }
+        surface->flags &= ~SDL_SIMD_ALIGNED;
+    } else {
+        SDL_free(surface->pixels);
+    }
+    if (data) {
+        data->pooled_pixels = SDL_FALSE;
+    }
+    surface->pixels = NULL;
+}
+
+void SDL_InitSurfacePool(void)
+{
+    if (surface_pool_watching) {
+        return;
+    }
+    surface_pool_watching = SDL_TRUE;
+    SDL_AddHintCallback(SDL_HINT_SURFACE_POOL_SIZE, SDL_SurfacePoolSizeChanged, NULL);
+}
+
+void SDL_QuitSurfacePool(void)
+{
+    SDL_PooledPixels *trimmed;
+
+    if (surface_pool_watching) {
+        SDL_DelHintCallback(SDL_HINT_SURFACE_POOL_SIZE, SDL_SurfacePoolSizeChanged, NULL);
+        surface_pool_watching = SDL_FALSE;
+    }
+
+    SDL_AtomicLock(&surface_pool_lock);
+    surface_pool_limit = 0;
+    trimmed = SDL_TrimSurfacePool(0);
+    SDL_AtomicUnlock(&surface_pool_lock);
+
+    SDL_FreePooledPixels(trimmed);
+}
+
 /* Public routines */
 
 /*
@@ -64,6 +289,16 @@ SDL_CalculatePitch(Uint32 format, size_t width, SDL_bool minimal)
             return SDL_SIZE_MAX;
         }
         pitch &= ~3;
+
+        /* Start every row on a SIMD boundary, if the application asked for that */
+        if (!SDL_ISPIXELFORMAT_FOURCC(format) && SDL_GetHintBoolean(SDL_HINT_SURFACE_ALIGNED_PITCH, SDL_FALSE)) {
+            const size_t alignment = SDL_SIMDGetAlignment();
+
+            if (SDL_size_add_overflow(pitch, alignment - 1, &pitch)) {
+                return SDL_SIZE_MAX;
+            }
+            pitch -= pitch % alignment;
+        }
     }
     return pitch;
 }
@@ -101,12 +336,20 @@ SDL_CreateRGBSurfaceWithFormat(Uint32 flags, int width, int height, int depth,
     }
 
     /* Allocate the surface */
-    surface = (SDL_Surface *)SDL_calloc(1, sizeof(*surface));
+    surface = (SDL_Surface *)SDL_calloc(1, sizeof(SDL_SurfaceData));
     if (surface == NULL) {
         SDL_OutOfMemory();
         return NULL;
     }
 
+    /* Allocate an empty mapping, owning it marks the surface as having SDL_SurfaceData */
+    surface->map = SDL_AllocBlitMap();
+    if (!surface->map) {
+        SDL_FreeSurface(surface);
+        return NULL;
+    }
+    surface->map->owner = surface;
+
     surface->format = SDL_AllocFormat(format);
     if (!surface->format) {
         SDL_FreeSurface(surface);
@@ -148,24 +391,14 @@ SDL_CreateRGBSurfaceWithFormat(Uint32 flags, int width, int height, int depth,
             return NULL;
         }
 
-        surface->pixels = SDL_SIMDAlloc(size);
-        if (!surface->pixels) {
+        if (SDL_AllocOwnedSurfacePixels(surface) < 0) {
             SDL_FreeSurface(surface);
-            SDL_OutOfMemory();
             return NULL;
         }
-        surface->flags |= SDL_SIMD_ALIGNED;
         /* This is important for bitmaps */
         SDL_memset(surface->pixels, 0, size);
     }
 
-    /* Allocate an empty mapping */
-    surface->map = SDL_AllocBlitMap();
-    if (!surface->map) {
-        SDL_FreeSurface(surface);
-        return NULL;
-    }
-
     /* By default surface with an alpha mask are set up for blending */
     if (surface->format->Amask) {
         SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
@@ -288,6 +521,133 @@ SDL_CreateRGBSurfaceWithFormatFrom(void *pixels,
     return surface;
 }
 
+SDL_Surface *
+SDL_CreateSurfaceFromOwnedPixels(void *pixels, int width, int height, int pitch, Uint32 format,
+                                 SDL_FreePixelsFunc free_pixels, void *userdata)
+{
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels, width, height, 0, pitch, format);
+    SDL_SurfaceData *data;
+
+    if (surface == NULL) {
+        free_pixels(pixels, userdata);
+        return NULL;
+    }
+    data = SDL_GetSurfaceData(surface);
+    SDL_assert(data != NULL);
+    data->free_pixels = free_pixels;
+    data->free_pixels_userdata = userdata;
+    return surface;
+}
+
+/* Pixels shared between copies of a surface, see SDL_HINT_SURFACE_COPY_ON_WRITE */
+typedef struct SDL_SharedPixels
+{
+    SDL_atomic_t refcount;
+    void *pixels;
+    size_t size;
+    SDL_FreePixelsFunc free_pixels; /* NULL if the surface owned the pixels */
+    void *free_pixels_userdata;
+    SDL_bool pooled; /* the pixels came from SDL_AllocSurfacePixels() */
+} SDL_SharedPixels;
+
+static void SDL_ReleaseSharedPixels(void *pixels, void *userdata)
+{
+    SDL_SharedPixels *shared = (SDL_SharedPixels *)userdata;
+
+    (void)pixels;
+    if (SDL_AtomicDecRef(&shared->refcount)) {
+        if (shared->free_pixels) {
+            shared->free_pixels(shared->pixels, shared->free_pixels_userdata);
+        } else if (shared->pooled) {
+            SDL_FreeSurfacePixels(shared->pixels, shared->size);
+        } else {
+            SDL_SIMDFree(shared->pixels);
+        }
+        SDL_free(shared);
+    }
+}
+
+/*
+ * Get the shared pixels of a surface, so a copy of it can use them too.
+ * Returns NULL if the surface doesn't own pixels that it can share.
+ */
+static SDL_SharedPixels *SDL_GetSharedPixels(SDL_Surface *surface)
+{
+    SDL_SurfaceData *data = SDL_GetSurfaceData(surface);
+    SDL_SharedPixels *shared;
+
+    if (!data || !surface->pixels || surface->locked ||
+        (surface->flags & (SDL_RLEACCEL | SDL_DONTFREE))) {
+        return NULL;
+    }
+    if (data->free_pixels == SDL_ReleaseSharedPixels) {
+        return (SDL_SharedPixels *)data->free_pixels_userdata;
+    }
+    if (!data->free_pixels && (surface->flags & (SDL_PREALLOC | SDL_SIMD_ALIGNED)) != SDL_SIMD_ALIGNED) {
+        /* The pixels belong to the application */
+        return NULL;
+    }
+
+    shared = (SDL_SharedPixels *)SDL_malloc(sizeof(*shared));
+    if (shared == NULL) {
+        return NULL;
+    }
+    SDL_AtomicSet(&shared->refcount, 1);
+    shared->pixels = surface->pixels;
+    shared->size = (size_t)surface->h * surface->pitch;
+    shared->free_pixels = data->free_pixels;
+    shared->free_pixels_userdata = data->free_pixels_userdata;
+    shared->pooled = data->pooled_pixels;
+
+    /* SDL_PREALLOC keeps RLE encoding from freeing the pixels */
+    data->free_pixels = SDL_ReleaseSharedPixels;
+    data->free_pixels_userdata = shared;
+    data->pooled_pixels = SDL_FALSE;
+    surface->flags |= SDL_PREALLOC;
+    return shared;
+}
+
+int SDL_UnshareSurfacePixels(SDL_Surface *surface)
+{
+    SDL_SurfaceData *data = SDL_GetSurfaceData(surface);
+    SDL_SharedPixels *shared;
+
+    if (!data || data->free_pixels != SDL_ReleaseSharedPixels) {
+        return 0;
+    }
+    shared = (SDL_SharedPixels *)data->free_pixels_userdata;
+
+    if (SDL_AtomicGet(&shared->refcount) > 1) {
+        /* Other surfaces use these pixels, take a private copy */
+        const size_t size = (size_t)surface->h * surface->pitch;
+        void *pixels = SDL_AllocSurfacePixels(size);
+
+        if (!pixels) {
+            return SDL_OutOfMemory();
+        }
+        SDL_memcpy(pixels, surface->pixels, size);
+        SDL_ReleaseSharedPixels(surface->pixels, shared);
+
+        surface->pixels = pixels;
+        surface->flags &= ~SDL_PREALLOC;
+        surface->flags |= SDL_SIMD_ALIGNED;
+        data->free_pixels = NULL;
+        data->free_pixels_userdata = NULL;
+        data->pooled_pixels = SDL_TRUE;
+    } else {
+        /* This is the last user, give it back the original pixels */
+        data->free_pixels = shared->free_pixels;
+        data->free_pixels_userdata = shared->free_pixels_userdata;
+        if (!data->free_pixels) {
+            surface->flags &= ~SDL_PREALLOC;
+            surface->flags |= SDL_SIMD_ALIGNED;
+            data->pooled_pixels = shared->pooled;
+        }
+        SDL_free(shared);
+    }
+    return 0;
+}
+
 int SDL_SetSurfacePalette(SDL_Surface *surface, SDL_Palette *palette)
 {
     if (surface == NULL) {
@@ -412,7 +772,9 @@ static void SDL_ConvertColorkeyToAlpha(SDL_Surface *surface, SDL_bool ignore_alp
 
     bpp = surface->format->BytesPerPixel;
 
-    SDL_LockSurface(surface);
+    if (SDL_LockSurface(surface) < 0) {
+        return;
+    }
 
     if (bpp == 2) {
         Uint16 *row, *spot;
@@ -691,6 +1053,9 @@ int SDL_LowerBlit(SDL_Surface *src, SDL_Rect *srcrect,
         /*              src, dst->flags, src->map->info.flags, dst, dst->flags, */
         /*              dst->map->info.flags, src->map->blit); */
     }
+    if (SDL_UnshareSurfacePixels(dst) < 0) {
+        return -1;
+    }
     return src->map->blit(src, srcrect, dst, dstrect);
 }
 
@@ -1089,6 +1454,10 @@ int SDL_LockSurface(SDL_Surface *surface)
             surface->flags |= SDL_RLEACCEL; /* save accel'd state */
         }
 #endif
+        /* The pixels may be written, so they can't be shared any more */
+        if (SDL_UnshareSurfacePixels(surface) < 0) {
+            return -1;
+        }
     }
 
     /* Increment the surface lock count, for recursive locks */
@@ -1117,6 +1486,85 @@ void SDL_UnlockSurface(SDL_Surface *surface)
 #endif
 }
 
+/*
+ * How many threads a width x height conversion should be split across
+ */
+static int SDL_GetConvertThreadCount(int width, int height)
+{
+    const char *hint;
+    int num_threads;
+    Sint64 min_pixels = 1024 * 1024;
+
+    hint = SDL_GetHint(SDL_HINT_CONVERT_THREADS);
+    if (hint == NULL || !*hint) {
+        return 1;
+    }
+    num_threads = SDL_atoi(hint);
+    if (num_threads <= 0) {
+        num_threads = SDL_GetCPUCount();
+    }
+    if (num_threads <= 1) {
+        return 1;
+    }
+
+    hint = SDL_GetHint(SDL_HINT_CONVERT_THREADS_MIN_PIXELS);
+    if (hint && *hint) {
+        min_pixels = SDL_strtoll(hint, NULL, 10);
+    }
+    if ((Sint64)width * height < min_pixels) {
+        return 1;
+    }
+    return num_threads;
+}
+
+typedef struct
+{
+    SDL_ConvertRowsFunc convert;
+    void *data;
+    int height;
+    int rows;
+    SDL_atomic_t failed;
+} SDL_ConvertBands;
+
+static void SDLCALL SDL_ConvertBand(void *data, int index)
+{
+    SDL_ConvertBands *bands = (SDL_ConvertBands *)data;
+    const int y = index * bands->rows;
+
+    if (bands->convert(bands->data, y, SDL_min(bands->rows, bands->height - y)) < 0) {
+        SDL_AtomicSet(&bands->failed, 1);
+    }
+}
+
+int SDL_ConvertInBands(int width, int height, int row_align, SDL_ConvertRowsFunc convert, void *data)
+{
+    SDL_ConvertBands bands;
+    const int num_threads = SDL_GetConvertThreadCount(width, height);
+    int count;
+
+    if (num_threads <= 1 || height < 2 * row_align) {
+        return convert(data, 0, height);
+    }
+
+    /* A few bands per thread, so threads that start late still get a share */
+    count = SDL_min(num_threads * 4, height / row_align);
+    bands.convert = convert;
+    bands.data = data;
+    bands.height = height;
+    bands.rows = (height + count - 1) / count;
+    bands.rows = (bands.rows + row_align - 1) / row_align * row_align;
+    SDL_AtomicSet(&bands.failed, 0);
+
+    count = (height + bands.rows - 1) / bands.rows;
+    SDL_RunOnWorkers(SDL_ConvertBand, &bands, count, num_threads);
+
+    if (SDL_AtomicGet(&bands.failed)) {
+        /* The error may have been set on another thread, so run it again here to report it */
+        return convert(data, 0, height);
+    }
+    return 0;
+}
+
 /*
  * Creates a new surface identical to the existing surface
  */
@@ -1134,6 +1582,7 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
                    Uint32 flags)
 {
     SDL_Surface *convert;
+    SDL_SharedPixels *shared = NULL;
     Uint32 copy_flags;
     SDL_Color copy_color;
     SDL_Rect bounds;
@@ -1167,11 +1616,25 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
         }
     }
 
+    /* A copy in the same format can share the pixels until one of them is written */
+    if (surface->format->format == format->format &&
+        format->format != SDL_PIXELFORMAT_UNKNOWN &&
+        !surface->format->palette && !format->palette &&
+        SDL_GetHintBoolean(SDL_HINT_SURFACE_COPY_ON_WRITE, SDL_FALSE)) {
+        shared = SDL_GetSharedPixels(surface);
+    }
+
     /* Create a new surface with the desired format */
-    convert = SDL_CreateRGBSurface(flags, surface->w, surface->h,
-                                   format->BitsPerPixel, format->Rmask,
-                                   format->Gmask, format->Bmask,
-                                   format->Amask);
+    if (shared) {
+        SDL_AtomicIncRef(&shared->refcount);
+        convert = SDL_CreateSurfaceFromOwnedPixels(shared->pixels, surface->w, surface->h, surface->pitch,
+                                                   format->format, SDL_ReleaseSharedPixels, shared);
+    } else {
+        convert = SDL_CreateRGBSurface(flags, surface->w, surface->h,
+                                       format->BitsPerPixel, format->Rmask,
+                                       format->Gmask, format->Bmask,
+                                       format->Amask);
+    }
     if (convert == NULL) {
         return NULL;
     }
@@ -1242,7 +1705,21 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
         }
     }
 
-    ret = SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    if (shared) {
+        /* The pixels are already there */
+        ret = 0;
+    } else if (!(surface->flags & SDL_RLEACCEL) &&
+        !surface->format->palette && !convert->format->palette &&
+        surface->format->format != SDL_PIXELFORMAT_UNKNOWN &&
+        convert->format->format != SDL_PIXELFORMAT_UNKNOWN &&
+        SDL_GetConvertThreadCount(surface->w, surface->h) > 1) {
+        /* This is a plain copy, which SDL_ConvertPixels() can split across threads */
+        ret = SDL_ConvertPixels(surface->w, surface->h,
+                                surface->format->format, surface->pixels, surface->pitch,
+                                convert->format->format, convert->pixels, convert->pitch);
+    } else {
+        ret = SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    }
 
     /* Restore colorkey alpha value */
     if (palette_ck_transform) {
@@ -1377,7 +1854,9 @@ SDL_ConvertSurfaceFormat(SDL_Surface * surface, Uint32 pixel_format,
 }
 
 /*
- * Create a surface on the stack for quick blit operations
+ * Create a surface on the stack for quick blit operations.
+ * It's a plain SDL_Surface without SDL_SurfaceData, its blit map has no owner,
+ * so it never owns its pixels.
  */
 static SDL_INLINE SDL_bool SDL_CreateSurfaceOnStack(int width, int height, Uint32 pixel_format,
                                                     void *pixels, int pitch, SDL_Surface *surface,
@@ -1415,11 +1894,11 @@ static SDL_INLINE SDL_bool SDL_CreateSurfaceOnStack(int width, int height, Uint3
 }
 
 /*
- * Copy a block of pixels of one format to another format
+ * Copy a block of pixels of one non-YUV format to another
  */
-int SDL_ConvertPixels(int width, int height,
-                      Uint32 src_format, const void *src, int src_pitch,
-                      Uint32 dst_format, void *dst, int dst_pitch)
+static int SDL_ConvertPixels_RGB_to_RGB(int width, int height,
+                                        Uint32 src_format, const void *src, int src_pitch,
+                                        Uint32 dst_format, void *dst, int dst_pitch)
 {
     SDL_Surface src_surface, dst_surface;
     SDL_PixelFormat src_fmt, dst_fmt;
@@ -1428,33 +1907,6 @@ int SDL_ConvertPixels(int width, int height,
     void *nonconst_src = (void *)src;
     int ret;
 
-    if (src == NULL) {
-        return SDL_InvalidParamError("src");
-    }
-    if (!src_pitch) {
-        return SDL_InvalidParamError("src_pitch");
-    }
-    if (dst == NULL) {
-        return SDL_InvalidParamError("dst");
-    }
-    if (!dst_pitch) {
-        return SDL_InvalidParamError("dst_pitch");
-    }
-
-#if SDL_HAVE_YUV
-    if (SDL_ISPIXELFORMAT_FOURCC(src_format) && SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
-        return SDL_ConvertPixels_YUV_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
-    } else if (SDL_ISPIXELFORMAT_FOURCC(src_format)) {
-        return SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
-    } else if (SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
-        return SDL_ConvertPixels_RGB_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
-    }
-#else
-    if (SDL_ISPIXELFORMAT_FOURCC(src_format) || SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
-        return SDL_SetError("SDL not built with YUV support");
-    }
-#endif
-
     /* Fast path for same format copy */
     if (src_format == dst_format) {
         int i;
@@ -1491,6 +1943,72 @@ int SDL_ConvertPixels(int width, int height,
     return ret;
 }
 
+typedef struct
+{
+    int width;
+    Uint32 src_format;
+    const Uint8 *src;
+    int src_pitch;
+    Uint32 dst_format;
+    Uint8 *dst;
+    int dst_pitch;
+} SDL_ConvertPixelsData;
+
+static int SDL_ConvertPixelsRows(void *data, int y, int rows)
+{
+    const SDL_ConvertPixelsData *cvt = (const SDL_ConvertPixelsData *)data;
+
+    return SDL_ConvertPixels_RGB_to_RGB(cvt->width, rows,
+                                        cvt->src_format, cvt->src + (size_t)y * cvt->src_pitch, cvt->src_pitch,
+                                        cvt->dst_format, cvt->dst + (size_t)y * cvt->dst_pitch, cvt->dst_pitch);
+}
+
+/*
+ * Copy a block of pixels of one format to another format
+ */
+int SDL_ConvertPixels(int width, int height,
+                      Uint32 src_format, const void *src, int src_pitch,
+                      Uint32 dst_format, void *dst, int dst_pitch)
+{
+    SDL_ConvertPixelsData cvt;
+
+    if (src == NULL) {
+        return SDL_InvalidParamError("src");
+    }
+    if (!src_pitch) {
+        return SDL_InvalidParamError("src_pitch");
+    }
+    if (dst == NULL) {
+        return SDL_InvalidParamError("dst");
+    }
+    if (!dst_pitch) {
+        return SDL_InvalidParamError("dst_pitch");
+    }
+
+#if SDL_HAVE_YUV
+    if (SDL_ISPIXELFORMAT_FOURCC(src_format) && SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
+        return SDL_ConvertPixels_YUV_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    } else if (SDL_ISPIXELFORMAT_FOURCC(src_format)) {
+        return SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    } else if (SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
+        return SDL_ConvertPixels_RGB_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    }
+#else
+    if (SDL_ISPIXELFORMAT_FOURCC(src_format) || SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
+        return SDL_SetError("SDL not built with YUV support");
+    }
+#endif
+
+    cvt.width = width;
+    cvt.src_format = src_format;
+    cvt.src = (const Uint8 *)src;
+    cvt.src_pitch = src_pitch;
+    cvt.dst_format = dst_format;
+    cvt.dst = (Uint8 *)dst;
+    cvt.dst_pitch = dst_pitch;
+    return SDL_ConvertInBands(width, height, 1, SDL_ConvertPixelsRows, &cvt);
+}
+
 /*
  * Premultiply the alpha on a block of pixels
  *
@@ -1558,6 +2076,8 @@ int SDL_PremultiplyAlpha(int width, int height,
  */
 void SDL_FreeSurface(SDL_Surface *surface)
 {
+    SDL_SurfaceData *data;
+
     if (surface == NULL) {
         return;
     }
@@ -1584,14 +2104,15 @@ void SDL_FreeSurface(SDL_Surface *surface)
         SDL_FreeFormat(surface->format);
         surface->format = NULL;
     }
-    if (surface->flags & SDL_PREALLOC) {
+    data = SDL_GetSurfaceData(surface);
+    if (data && data->free_pixels) {
+        /* Give the pixels back to their owner */
+        data->free_pixels(surface->pixels, data->free_pixels_userdata);
+    } else if (surface->flags & SDL_PREALLOC) {
         /* Don't free */
-    } else if (surface->flags & SDL_SIMD_ALIGNED) {
-        /* Free aligned */
-        SDL_SIMDFree(surface->pixels);
     } else {
-        /* Normal */
-        SDL_free(surface->pixels);
+        /* Free aligned, possibly into the pool */
+        SDL_FreeOwnedSurfacePixels(surface);
     }
     if (surface->map) {
         SDL_FreeBlitMap(surface->map);
@@ -190,6 +190,12 @@ static SDL_bool DisableUnsetFullscreenOnMinimize(_THIS)
 
 #define SDL_WINDOWTEXTUREDATA "_SDL_WindowTextureData"
 
+/* The most rects uploaded separately in one window update */
+#define SDL_WINDOWTEXTURE_MAX_RECTS 16
+
+/* The fixed cost of uploading a rect, in pixels */
+#define SDL_WINDOWTEXTURE_RECT_COST (64 * 64)
+
 typedef struct
 {
     SDL_Renderer *renderer;
@@ -197,6 +203,8 @@ typedef struct
     void *pixels;
     int pitch;
     int bytes_per_pixel;
+    Uint32 num_updates;
+    Uint64 bytes_uploaded; /* by all window updates, logged on destroy */
 } SDL_WindowTextureData;
 
 static Uint32 SDL_DefaultGraphicsBackends(SDL_VideoDevice *_this)
@@ -336,6 +344,9 @@ static int SDL_UpdateWindowTexture(SDL_VideoDevice *unused, SDL_Window *window,
 {
     SDL_WindowTextureData *data;
     SDL_Rect rect;
+    SDL_Rect clusters[SDL_WINDOWTEXTURE_MAX_RECTS];
+    Sint64 area;
+    int i, count;
     void *src;
 
     data = SDL_GetWindowData(window, SDL_WINDOWTEXTUREDATA);
@@ -345,11 +356,28 @@ static int SDL_UpdateWindowTexture(SDL_VideoDevice *unused, SDL_Window *window,
 
     /* Update a single rect that contains subrects for best DMA performance */
     if (SDL_GetSpanEnclosingRect(window->w, window->h, numrects, rects, &rect)) {
-        src = (void *)((Uint8 *)data->pixels +
-                       rect.y * data->pitch +
-                       rect.x * data->bytes_per_pixel);
-        if (SDL_UpdateTexture(data->texture, &rect, src, data->pitch) < 0) {
-            return -1;
+        /* ... unless the subrects are so much smaller than the span that
+           uploading them separately is worth the extra calls */
+        count = SDL_GetClusteredRects(window->w, window->h, numrects, rects,
+                                      SDL_WINDOWTEXTURE_RECT_COST,
+                                      clusters, SDL_arraysize(clusters));
+        area = 0;
+        for (i = 0; i < count; ++i) {
+            area += (Sint64)clusters[i].w * clusters[i].h + SDL_WINDOWTEXTURE_RECT_COST;
+        }
+        if (count <= 0 || area * 2 > (Sint64)rect.w * rect.h) {
+            clusters[0] = rect;
+            count = 1;
+        }
+
+        for (i = 0; i < count; ++i) {
+            src = (void *)((Uint8 *)data->pixels +
+                           clusters[i].y * data->pitch +
+                           clusters[i].x * data->bytes_per_pixel);
+            if (SDL_UpdateTexture(data->texture, &clusters[i], src, data->pitch) < 0) {
+                return -1;
+            }
+            data->bytes_uploaded += (Uint64)clusters[i].w * clusters[i].h * data->bytes_per_pixel;
         }
 
         if (SDL_RenderCopy(data->renderer, data->texture, NULL, NULL) < 0) {
@@ -357,6 +385,7 @@ static int SDL_UpdateWindowTexture(SDL_VideoDevice *unused, SDL_Window *window,
         }
 
         SDL_RenderPresent(data->renderer);
+        ++data->num_updates;
     }
     return 0;
 }
@@ -369,6 +398,8 @@ static void SDL_DestroyWindowTexture(SDL_VideoDevice *unused, SDL_Window *window
     if (data == NULL) {
         return;
     }
+    SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Window texture updates: %u, %" SDL_PRIu64 " bytes uploaded",
+                 (unsigned int)data->num_updates, data->bytes_uploaded);
     if (data->texture) {
         SDL_DestroyTexture(data->texture);
     }
@@ -20,10 +20,14 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_atomic.h"
 #include "SDL_endian.h"
+#include "SDL_hints.h"
 #include "SDL_video.h"
+#include "SDL_blit.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "../SDL_hints_c.h"
 
 #include "yuv2rgb/yuv_rgb.h"
 
@@ -174,6 +178,38 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
     return 0;
 }
 
+/* SIMD conversions can be turned off to compare them with the C code */
+static SDL_bool yuv_intrinsics_enabled = SDL_TRUE;
+static SDL_bool yuv_intrinsics_watching = SDL_FALSE;
+
+static void SDLCALL SDL_YUVIntrinsicsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    yuv_intrinsics_enabled = SDL_GetStringBoolean(hint, SDL_TRUE);
+}
+
+static SDL_bool UseYUVIntrinsics(void)
+{
+    return yuv_intrinsics_enabled;
+}
+
+void SDL_InitYUVIntrinsics(void)
+{
+    if (yuv_intrinsics_watching) {
+        return;
+    }
+    yuv_intrinsics_watching = SDL_TRUE;
+    SDL_AddHintCallback(SDL_HINT_YUV_INTRINSICS, SDL_YUVIntrinsicsChanged, NULL);
+}
+
+void SDL_QuitYUVIntrinsics(void)
+{
+    if (yuv_intrinsics_watching) {
+        SDL_DelHintCallback(SDL_HINT_YUV_INTRINSICS, SDL_YUVIntrinsicsChanged, NULL);
+        yuv_intrinsics_watching = SDL_FALSE;
+    }
+    yuv_intrinsics_enabled = SDL_TRUE;
+}
+
 static SDL_bool yuv_rgb_sse(
     Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height,
@@ -325,6 +361,115 @@ static SDL_bool yuv_rgb_lsx(
     return SDL_FALSE;
 }
 
+static SDL_bool yuv_rgb_neon(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+#ifdef __ARM_NEON
+    if (!SDL_HasNEON()) {
+        return SDL_FALSE;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+#endif
+    return SDL_FALSE;
+}
+
 static SDL_bool yuv_rgb_std(
     Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height,
@@ -428,6 +573,62 @@ static SDL_bool yuv_rgb_std(
     return SDL_FALSE;
 }
 
+static SDL_bool yuv_rgb(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (UseYUVIntrinsics()) {
+        if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+            return SDL_TRUE;
+        }
+
+        if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+            return SDL_TRUE;
+        }
+
+        if (yuv_rgb_neon(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+            return SDL_TRUE;
+        }
+    }
+
+    return yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+}
+
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    int width;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+} YUVToRGBData;
+
+/* Convert a band of rows starting on an even row, so 4:2:0 chroma rows aren't split */
+static int yuv_rgb_rows(void *data, int row, int rows)
+{
+    const YUVToRGBData *cvt = (const YUVToRGBData *)data;
+    const int uv_row = IsPlanar2x2Format(cvt->src_format) ? (row / 2) : row;
+
+    if (!yuv_rgb(cvt->src_format, cvt->dst_format, cvt->width, rows,
+                 cvt->y + (size_t)row * cvt->y_stride,
+                 cvt->u + (size_t)uv_row * cvt->uv_stride,
+                 cvt->v + (size_t)uv_row * cvt->uv_stride,
+                 cvt->y_stride, cvt->uv_stride,
+                 cvt->rgb + (size_t)row * cvt->rgb_stride, cvt->rgb_stride, cvt->yuv_type)) {
+        return -1;
+    }
+    return 0;
+}
+
 int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
                                  Uint32 src_format, const void *src, int src_pitch,
                                  Uint32 dst_format, void *dst, int dst_pitch)
@@ -438,6 +639,7 @@ int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
     Uint32 y_stride = 0;
     Uint32 uv_stride = 0;
     YCbCrType yuv_type = YCBCR_601;
+    YUVToRGBData cvt;
 
     if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
         return -1;
@@ -447,15 +649,18 @@ int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return -1;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-        return 0;
-    }
-
-    if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-        return 0;
-    }
-
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+    cvt.src_format = src_format;
+    cvt.dst_format = dst_format;
+    cvt.width = width;
+    cvt.y = y;
+    cvt.u = u;
+    cvt.v = v;
+    cvt.y_stride = y_stride;
+    cvt.uv_stride = uv_stride;
+    cvt.rgb = (Uint8 *)dst;
+    cvt.rgb_stride = dst_pitch;
+    cvt.yuv_type = yuv_type;
+    if (SDL_ConvertInBands(width, height, 2, yuv_rgb_rows, &cvt) == 0) {
         return 0;
     }
 
@@ -486,6 +691,355 @@ int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
     return SDL_SetError("Unsupported YUV conversion");
 }
 
+/* The RGB formats the YUV conversions above write directly */
+static SDL_bool IsDirectYUVToRGBFormat(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB565:
+    case SDL_PIXELFORMAT_RGB24:
+    case SDL_PIXELFORMAT_RGBX8888:
+    case SDL_PIXELFORMAT_RGBA8888:
+    case SDL_PIXELFORMAT_BGRX8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+    case SDL_PIXELFORMAT_RGB888:
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_BGR888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+/* Move the plane pointers from GetYUVPlanes() to pixel (x, y), which must be
+   the first pixel of a chroma sample */
+static void OffsetYUVPlanes(Uint32 format, int x, int y, Uint32 y_stride, Uint32 uv_stride,
+                            const Uint8 **py, const Uint8 **pu, const Uint8 **pv)
+{
+    if (IsPacked4Format(format)) {
+        const size_t offset = (size_t)y * y_stride + (size_t)x * 2;
+        *py += offset;
+        *pu += offset;
+        *pv += offset;
+    } else {
+        const int uv_pixel_stride = (format == SDL_PIXELFORMAT_NV12 || format == SDL_PIXELFORMAT_NV21) ? 2 : 1;
+        const size_t uv_offset = (size_t)(y / 2) * uv_stride + (size_t)(x / 2) * uv_pixel_stride;
+        *py += (size_t)y * y_stride + x;
+        *pu += uv_offset;
+        *pv += uv_offset;
+    }
+}
+
+/* Source lines converted to RGB on demand, two at a time so the 4:2:0
+   conversions can share the chroma line. Two pairs are kept so linear
+   filtering can read neighbouring lines from different pairs. */
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 row_format;
+    const Uint8 *y, *u, *v;
+    Uint32 y_stride, uv_stride;
+    YCbCrType yuv_type;
+    int src_h;
+    int width;
+    int pitch;
+    Uint8 *pixels[2];
+    int pair[2];
+} YUVLineCache;
+
+static const Uint8 *GetYUVLine(YUVLineCache *cache, int line)
+{
+    const int pair = line / 2;
+    const int slot = pair & 1;
+
+    if (cache->pair[slot] != pair) {
+        const Uint8 *y = cache->y;
+        const Uint8 *u = cache->u;
+        const Uint8 *v = cache->v;
+
+        OffsetYUVPlanes(cache->src_format, 0, pair * 2, cache->y_stride, cache->uv_stride, &y, &u, &v);
+        yuv_rgb(cache->src_format, cache->row_format, cache->width, SDL_min(2, cache->src_h - pair * 2),
+                y, u, v, cache->y_stride, cache->uv_stride, cache->pixels[slot], cache->pitch, cache->yuv_type);
+        cache->pair[slot] = pair;
+    }
+    return cache->pixels[slot] + (line & 1) * cache->pitch;
+}
+
+/* Same sampling positions as SDL_SoftStretch() */
+static void ScaleYUVLineNearest(const Uint8 *src, Uint8 *dst, int bpp, int dst_w, Uint32 incx)
+{
+    Uint32 posx = incx / 2;
+    int i;
+
+    if (incx == 0x10000) {
+        SDL_memcpy(dst, src, (size_t)dst_w * bpp);
+        return;
+    }
+
+    switch (bpp) {
+    case 4:
+        for (i = 0; i < dst_w; ++i) {
+            ((Uint32 *)dst)[i] = ((const Uint32 *)src)[posx >> 16];
+            posx += incx;
+        }
+        break;
+    case 2:
+        for (i = 0; i < dst_w; ++i) {
+            ((Uint16 *)dst)[i] = ((const Uint16 *)src)[posx >> 16];
+            posx += incx;
+        }
+        break;
+    default:
+        for (i = 0; i < dst_w; ++i) {
+            const Uint8 *p = src + (posx >> 16) * 3;
+            dst[0] = p[0];
+            dst[1] = p[1];
+            dst[2] = p[2];
+            dst += 3;
+            posx += incx;
+        }
+        break;
+    }
+}
+
+/* Linear sampling in 16.16 fixed point with pixel centers at .5, and 7 bit
+   weights like SDL_SoftStretchLinear(). Samples past the edges are clamped. */
+#define YUV_LINEAR_FRAC_BITS 7
+#define YUV_LINEAR_FRAC_ONE  (1 << YUV_LINEAR_FRAC_BITS)
+
+static void GetLinearSample(Sint32 pos, int count, int *i0, int *i1, int *frac)
+{
+    if (pos <= 0) {
+        *i0 = *i1 = 0;
+        *frac = 0;
+    } else if ((pos >> 16) >= count - 1) {
+        *i0 = *i1 = count - 1;
+        *frac = 0;
+    } else {
+        *i0 = pos >> 16;
+        *i1 = *i0 + 1;
+        *frac = (pos >> (16 - YUV_LINEAR_FRAC_BITS)) & (YUV_LINEAR_FRAC_ONE - 1);
+    }
+}
+
+/* Blend two 32-bit pixels with a 7 bit weight, two channels at a time */
+SDL_FORCE_INLINE Uint32 LerpPixel(Uint32 p0, Uint32 p1, Uint32 frac)
+{
+    const Uint32 inv = YUV_LINEAR_FRAC_ONE - frac;
+    const Uint32 rb = (((p0 & 0x00FF00FF) * inv + (p1 & 0x00FF00FF) * frac) >> YUV_LINEAR_FRAC_BITS) & 0x00FF00FF;
+    const Uint32 ag = ((((p0 >> 8) & 0x00FF00FF) * inv + ((p1 >> 8) & 0x00FF00FF) * frac) >> YUV_LINEAR_FRAC_BITS) & 0x00FF00FF;
+    return rb | (ag << 8);
+}
+
+#ifdef __SSE2__
+static int BlendYUVLines_SSE2(const Uint32 *src0, const Uint32 *src1, Uint32 frac, Uint32 *dst, int width)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i w0 = _mm_set1_epi16((short)(YUV_LINEAR_FRAC_ONE - frac));
+    const __m128i w1 = _mm_set1_epi16((short)frac);
+    int i;
+
+    for (i = 0; i + 4 <= width; i += 4) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src0 + i));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src1 + i));
+        const __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), w0), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), w1));
+        const __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), w0), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), w1));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_srli_epi16(lo, YUV_LINEAR_FRAC_BITS), _mm_srli_epi16(hi, YUV_LINEAR_FRAC_BITS)));
+    }
+    return i;
+}
+
+/* Two destination pixels per step, each from a pair of neighbouring source pixels */
+static int ScaleYUVLine_SSE2(const Uint32 *line, Uint32 *dst, int dst_w, const int *x0, const Uint8 *frac_x)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int i;
+
+    for (i = 0; i + 2 <= dst_w; i += 2) {
+        const __m128i p0 = _mm_loadl_epi64((const __m128i *)(line + x0[i]));
+        const __m128i p1 = _mm_loadl_epi64((const __m128i *)(line + x0[i + 1]));
+        const __m128i w0 = _mm_unpacklo_epi64(_mm_set1_epi16((short)(YUV_LINEAR_FRAC_ONE - frac_x[i])), _mm_set1_epi16((short)frac_x[i]));
+        const __m128i w1 = _mm_unpacklo_epi64(_mm_set1_epi16((short)(YUV_LINEAR_FRAC_ONE - frac_x[i + 1])), _mm_set1_epi16((short)frac_x[i + 1]));
+        __m128i a = _mm_mullo_epi16(_mm_unpacklo_epi8(p0, zero), w0);
+        __m128i b = _mm_mullo_epi16(_mm_unpacklo_epi8(p1, zero), w1);
+
+        /* Add the weighted left and right pixels, which sit in the two halves */
+        a = _mm_add_epi16(a, _mm_srli_si128(a, 8));
+        b = _mm_add_epi16(b, _mm_srli_si128(b, 8));
+        a = _mm_srli_epi16(_mm_unpacklo_epi64(a, b), YUV_LINEAR_FRAC_BITS);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(a, zero));
+    }
+    return i;
+}
+#endif /* __SSE2__ */
+
+/* Vertical pass first, then horizontal, rounding after each like SDL_SoftStretchLinear() */
+static void ScaleYUVLineLinear(const Uint32 *src0, const Uint32 *src1, Uint32 frac_y, Uint32 *blend, int src_w,
+                               Uint32 *dst, int dst_w, const int *x0, const Uint8 *frac_x, SDL_bool use_SSE2)
+{
+    const Uint32 *line = src0;
+    int i;
+
+    if (frac_y) {
+        i = 0;
+#ifdef __SSE2__
+        if (use_SSE2) {
+            i = BlendYUVLines_SSE2(src0, src1, frac_y, blend, src_w);
+        }
+#endif
+        for (; i < src_w; ++i) {
+            blend[i] = LerpPixel(src0[i], src1[i], frac_y);
+        }
+        line = blend;
+    }
+
+    i = 0;
+#ifdef __SSE2__
+    if (use_SSE2) {
+        i = ScaleYUVLine_SSE2(line, dst, dst_w, x0, frac_x);
+    }
+#endif
+    for (; i < dst_w; ++i) {
+        const Uint32 *p = line + x0[i];
+        dst[i] = frac_x[i] ? LerpPixel(p[0], p[1], frac_x[i]) : p[0];
+    }
+}
+
+int SDL_ConvertPixels_YUV_to_RGB_Scaled(int src_w, int src_h, Uint32 src_format,
+                                        const void *src, int src_pitch, const SDL_Rect *srcrect,
+                                        Uint32 dst_format, void *dst, int dst_w, int dst_h, int dst_pitch,
+                                        SDL_ScaleMode scaleMode)
+{
+    const Uint8 *y = NULL;
+    const Uint8 *u = NULL;
+    const Uint8 *v = NULL;
+    Uint32 y_stride = 0;
+    Uint32 uv_stride = 0;
+    YCbCrType yuv_type = YCBCR_601;
+    SDL_bool linear;
+    YUVLineCache cache;
+    Uint8 *buffer;
+    Uint8 *tmp_line = NULL;
+    int line_bpp, span_x, skip, i;
+
+    if (srcrect->w <= 0 || srcrect->h <= 0 || dst_w <= 0 || dst_h <= 0) {
+        return 0;
+    }
+
+    if (GetYUVPlanes(src_w, src_h, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
+        return -1;
+    }
+
+    if (GetYUVConversionType(src_w, src_h, &yuv_type) < 0) {
+        return -1;
+    }
+
+    /* Unscaled copies starting on a chroma sample convert the planes in place */
+    if (srcrect->w == dst_w && srcrect->h == dst_h &&
+        !(srcrect->x & 1) && !(srcrect->y & 1) && IsDirectYUVToRGBFormat(dst_format)) {
+        OffsetYUVPlanes(src_format, srcrect->x, srcrect->y, y_stride, uv_stride, &y, &u, &v);
+        if (yuv_rgb(src_format, dst_format, dst_w, dst_h, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+            return 0;
+        }
+    }
+
+    /* Otherwise convert the source lines each destination line samples and
+       scale them straight into the destination. Linear filtering works on
+       32-bit pixels, anything else goes through ARGB8888 a line at a time. */
+    linear = (scaleMode != SDL_ScaleModeNearest && (srcrect->w != dst_w || srcrect->h != dst_h));
+    cache.row_format = dst_format;
+    if (!IsDirectYUVToRGBFormat(dst_format) || (linear && SDL_BYTESPERPIXEL(dst_format) != 4)) {
+        cache.row_format = SDL_PIXELFORMAT_ARGB8888;
+    }
+    line_bpp = SDL_BYTESPERPIXEL(cache.row_format);
+
+    span_x = srcrect->x & ~1;
+    skip = (srcrect->x - span_x) * line_bpp;
+    OffsetYUVPlanes(src_format, span_x, 0, y_stride, uv_stride, &y, &u, &v);
+
+    cache.src_format = src_format;
+    cache.y = y;
+    cache.u = u;
+    cache.v = v;
+    cache.y_stride = y_stride;
+    cache.uv_stride = uv_stride;
+    cache.yuv_type = yuv_type;
+    cache.src_h = src_h;
+    cache.width = srcrect->x + srcrect->w - span_x;
+    cache.pitch = cache.width * line_bpp;
+    cache.pair[0] = cache.pair[1] = -1;
+
+    /* Two pairs of lines, an output line if it needs converting, and for
+       linear filtering a blended line plus the horizontal sample positions */
+    buffer = (Uint8 *)SDL_malloc((size_t)cache.pitch * 4 + (size_t)dst_w * line_bpp +
+                                 (linear ? (size_t)cache.pitch + (size_t)dst_w * (sizeof(int) + 1) : 0));
+    if (buffer == NULL) {
+        return SDL_OutOfMemory();
+    }
+    cache.pixels[0] = buffer;
+    cache.pixels[1] = buffer + cache.pitch * 2;
+    if (cache.row_format != dst_format) {
+        tmp_line = buffer + cache.pitch * 4;
+    }
+
+    if (linear) {
+        const Sint32 incx = (Sint32)(((Sint64)srcrect->w << 16) / dst_w);
+        const Sint32 incy = (Sint32)(((Sint64)srcrect->h << 16) / dst_h);
+        Uint32 *blend = (Uint32 *)(buffer + cache.pitch * 4 + dst_w * line_bpp);
+        int *x0 = (int *)((Uint8 *)blend + cache.pitch);
+        Uint8 *frac_x = (Uint8 *)(x0 + dst_w);
+        Sint32 posx = incx / 2 - 0x8000;
+        Sint32 posy = incy / 2 - 0x8000;
+        const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics() && srcrect->w > 1;
+
+        for (i = 0; i < dst_w; ++i) {
+            int x1, frac;
+
+            GetLinearSample(posx, srcrect->w, &x0[i], &x1, &frac);
+            if (x0[i] == srcrect->w - 1 && x0[i] > 0) {
+                /* Take all of the right pixel so the pair stays inside the line */
+                x0[i] -= 1;
+                frac = YUV_LINEAR_FRAC_ONE;
+            }
+            frac_x[i] = (Uint8)frac;
+            posx += incx;
+        }
+
+        for (i = 0; i < dst_h; ++i) {
+            Uint8 *out = tmp_line ? tmp_line : (Uint8 *)dst + (size_t)i * dst_pitch;
+            const Uint8 *src0, *src1;
+            int y0, y1, frac_y;
+
+            GetLinearSample(posy, srcrect->h, &y0, &y1, &frac_y);
+            src0 = GetYUVLine(&cache, srcrect->y + y0) + skip;
+            src1 = GetYUVLine(&cache, srcrect->y + y1) + skip;
+            ScaleYUVLineLinear((const Uint32 *)src0, (const Uint32 *)src1, frac_y, blend, srcrect->w,
+                               (Uint32 *)out, dst_w, x0, frac_x, use_SSE2);
+            if (tmp_line) {
+                SDL_ConvertPixels(dst_w, 1, cache.row_format, tmp_line, dst_w * line_bpp, dst_format, (Uint8 *)dst + (size_t)i * dst_pitch, dst_pitch);
+            }
+            posy += incy;
+        }
+    } else {
+        const Uint32 incx = ((Uint32)srcrect->w << 16) / dst_w;
+        const Uint32 incy = ((Uint32)srcrect->h << 16) / dst_h;
+        Uint32 posy = incy / 2;
+
+        for (i = 0; i < dst_h; ++i) {
+            Uint8 *out = tmp_line ? tmp_line : (Uint8 *)dst + (size_t)i * dst_pitch;
+
+            ScaleYUVLineNearest(GetYUVLine(&cache, srcrect->y + (posy >> 16)) + skip, out, line_bpp, dst_w, incx);
+            if (tmp_line) {
+                SDL_ConvertPixels(dst_w, 1, cache.row_format, tmp_line, dst_w * line_bpp, dst_format, (Uint8 *)dst + (size_t)i * dst_pitch, dst_pitch);
+            }
+            posy += incy;
+        }
+    }
+
+    SDL_free(buffer);
+    return 0;
+}
+
 struct RGB2YUVFactors
 {
     int y_offset;
@@ -494,39 +1048,459 @@ struct RGB2YUVFactors
     float v[3]; /* Rfactor, Gfactor, Bfactor */
 };
 
-static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+/* Vectorized row converters for SDL_ConvertPixels_ARGB8888_to_YUV().
+   They do the same float arithmetic as MAKE_Y/MAKE_U/MAKE_V below, in the
+   same order, so the results are identical to the C code, including the
+   wraparound of the Uint8 cast. Each returns how many items it converted,
+   the C code finishes the rest of the row. */
+typedef int (*RGB2YUVRowYFunc)(const Uint32 *src, Uint8 *y, int width, const struct RGB2YUVFactors *cvt);
+typedef int (*RGB2YUVRowUVFunc)(const Uint32 *curr, const Uint32 *next, Uint8 *u, Uint8 *v, int uv_step, int width_half, const struct RGB2YUVFactors *cvt);
+typedef int (*RGB2YUVRowPackedFunc)(const Uint32 *src, Uint8 *dst, int width_half, Uint32 dst_format, const struct RGB2YUVFactors *cvt);
+
+#ifdef __SSE2__
+SDL_FORCE_INLINE void RGB2YUV_Split_SSE2(__m128i p, __m128i *r, __m128i *g, __m128i *b)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    *r = _mm_and_si128(_mm_srli_epi32(p, 16), mask);
+    *g = _mm_and_si128(_mm_srli_epi32(p, 8), mask);
+    *b = _mm_and_si128(p, mask);
+}
+
+SDL_FORCE_INLINE __m128i RGB2YUV_Dot_SSE2(__m128i r, __m128i g, __m128i b, const float *factors, int offset)
+{
+    __m128 sum = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(factors[0]), _mm_cvtepi32_ps(r)),
+                            _mm_mul_ps(_mm_set1_ps(factors[1]), _mm_cvtepi32_ps(g)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(factors[2]), _mm_cvtepi32_ps(b)));
+    sum = _mm_add_ps(sum, _mm_set1_ps(0.5f));
+    return _mm_and_si128(_mm_add_epi32(_mm_cvttps_epi32(sum), _mm_set1_epi32(offset)), _mm_set1_epi32(0xFF));
+}
+
+/* Sums of horizontally adjacent pixels, a holds pixels 0-3 and b pixels 4-7 */
+SDL_FORCE_INLINE __m128i RGB2YUV_PairSum_SSE2(__m128i a, __m128i b)
+{
+    const __m128 fa = _mm_castsi128_ps(a);
+    const __m128 fb = _mm_castsi128_ps(b);
+    return _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))),
+                         _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1))));
+}
+
+/* Store 4 U and 4 V values, packed as U0-3 V0-3 in the low 8 bytes of uv */
+SDL_FORCE_INLINE void RGB2YUV_StoreUV_SSE2(__m128i uv, Uint8 *u, Uint8 *v, int uv_step)
+{
+    if (uv_step == 1) {
+        const int u32 = _mm_cvtsi128_si32(uv);
+        const int v32 = _mm_cvtsi128_si32(_mm_srli_si128(uv, 4));
+        SDL_memcpy(u, &u32, 4);
+        SDL_memcpy(v, &v32, 4);
+    } else if (u < v) {
+        _mm_storel_epi64((__m128i *)u, _mm_unpacklo_epi8(uv, _mm_srli_si128(uv, 4)));
+    } else {
+        _mm_storel_epi64((__m128i *)v, _mm_unpacklo_epi8(_mm_srli_si128(uv, 4), uv));
+    }
+}
+
+static int RGB2YUV_RowY_SSE2(const Uint32 *src, Uint8 *y, int width, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        __m128i r, g, b, y0, y1, y2, y3;
+
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(src + i)), &r, &g, &b);
+        y0 = RGB2YUV_Dot_SSE2(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(src + i + 4)), &r, &g, &b);
+        y1 = RGB2YUV_Dot_SSE2(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(src + i + 8)), &r, &g, &b);
+        y2 = RGB2YUV_Dot_SSE2(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(src + i + 12)), &r, &g, &b);
+        y3 = RGB2YUV_Dot_SSE2(r, g, b, cvt->y, cvt->y_offset);
+        _mm_storeu_si128((__m128i *)(y + i), _mm_packus_epi16(_mm_packs_epi32(y0, y1), _mm_packs_epi32(y2, y3)));
+    }
+    return i;
+}
+
+static int RGB2YUV_RowUV_SSE2(const Uint32 *curr, const Uint32 *next, Uint8 *u, Uint8 *v, int uv_step, int width_half, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i + 4 <= width_half; i += 4) {
+        __m128i r0, g0, b0, r1, g1, b1, r2, g2, b2, r3, g3, b3, r, g, b, U, V, uv;
+
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(curr + 2 * i)), &r0, &g0, &b0);
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(curr + 2 * i + 4)), &r1, &g1, &b1);
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(next + 2 * i)), &r2, &g2, &b2);
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(next + 2 * i + 4)), &r3, &g3, &b3);
+        r = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(_mm_add_epi32(r0, r2), _mm_add_epi32(r1, r3)), 2);
+        g = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(_mm_add_epi32(g0, g2), _mm_add_epi32(g1, g3)), 2);
+        b = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(_mm_add_epi32(b0, b2), _mm_add_epi32(b1, b3)), 2);
+        U = RGB2YUV_Dot_SSE2(r, g, b, cvt->u, 128);
+        V = RGB2YUV_Dot_SSE2(r, g, b, cvt->v, 128);
+        uv = _mm_packs_epi32(U, V);
+        RGB2YUV_StoreUV_SSE2(_mm_packus_epi16(uv, uv), u + i * uv_step, v + i * uv_step, uv_step);
+    }
+    return i;
+}
+
+static int RGB2YUV_RowPacked_SSE2(const Uint32 *src, Uint8 *dst, int width_half, Uint32 dst_format, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i + 4 <= width_half; i += 4) {
+        __m128i r0, g0, b0, r1, g1, b1, R, G, B, Y, U, V, uv, out;
+
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(src + 2 * i)), &r0, &g0, &b0);
+        RGB2YUV_Split_SSE2(_mm_loadu_si128((const __m128i *)(src + 2 * i + 4)), &r1, &g1, &b1);
+        Y = _mm_packs_epi32(RGB2YUV_Dot_SSE2(r0, g0, b0, cvt->y, cvt->y_offset),
+                            RGB2YUV_Dot_SSE2(r1, g1, b1, cvt->y, cvt->y_offset));
+        Y = _mm_packus_epi16(Y, Y);
+        R = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(r0, r1), 1);
+        G = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(g0, g1), 1);
+        B = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(b0, b1), 1);
+        U = RGB2YUV_Dot_SSE2(R, G, B, cvt->u, 128);
+        V = RGB2YUV_Dot_SSE2(R, G, B, cvt->v, 128);
+        uv = _mm_packs_epi32(U, V);
+        uv = _mm_packus_epi16(uv, uv);
+        if (dst_format == SDL_PIXELFORMAT_YUY2) {
+            out = _mm_unpacklo_epi8(Y, _mm_unpacklo_epi8(uv, _mm_srli_si128(uv, 4)));
+        } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            out = _mm_unpacklo_epi8(_mm_unpacklo_epi8(uv, _mm_srli_si128(uv, 4)), Y);
+        } else /* dst_format == SDL_PIXELFORMAT_YVYU */ {
+            out = _mm_unpacklo_epi8(Y, _mm_unpacklo_epi8(_mm_srli_si128(uv, 4), uv));
+        }
+        _mm_storeu_si128((__m128i *)(dst + 4 * i), out);
+    }
+    return i;
+}
+#endif /* __SSE2__ */
+
+#if defined(HAVE_AVX2_INTRINSICS)
+/* The AVX2 row functions finish with the SSE2 ones, so they clear the upper
+   halves of the YMM registers explicitly before handing over. */
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE void RGB2YUV_Split_AVX2(__m256i p, __m256i *r, __m256i *g, __m256i *b)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    *r = _mm256_and_si256(_mm256_srli_epi32(p, 16), mask);
+    *g = _mm256_and_si256(_mm256_srli_epi32(p, 8), mask);
+    *b = _mm256_and_si256(p, mask);
+}
+
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i RGB2YUV_Dot_AVX2(__m256i r, __m256i g, __m256i b, const float *factors, int offset)
+{
+    __m256 sum = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(factors[0]), _mm256_cvtepi32_ps(r)),
+                               _mm256_mul_ps(_mm256_set1_ps(factors[1]), _mm256_cvtepi32_ps(g)));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(factors[2]), _mm256_cvtepi32_ps(b)));
+    sum = _mm256_add_ps(sum, _mm256_set1_ps(0.5f));
+    return _mm256_and_si256(_mm256_add_epi32(_mm256_cvttps_epi32(sum), _mm256_set1_epi32(offset)), _mm256_set1_epi32(0xFF));
+}
+
+/* Sums of horizontally adjacent pixels, a holds pixels 0-7 and b pixels 8-15 */
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i RGB2YUV_PairSum_AVX2(__m256i a, __m256i b)
+{
+    const __m256 fa = _mm256_castsi256_ps(a);
+    const __m256 fb = _mm256_castsi256_ps(b);
+    const __m256i sum = _mm256_add_epi32(_mm256_castps_si256(_mm256_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))),
+                                         _mm256_castps_si256(_mm256_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1))));
+    return _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+/* Pack 8 U and 8 V values to bytes, returning U0-7 in *u and V0-7 in *v */
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE void RGB2YUV_PackUV_AVX2(__m256i U, __m256i V, __m128i *u, __m128i *v)
+{
+    const __m256i uv16 = _mm256_packs_epi32(U, V);
+    const __m256i uv8 = _mm256_packus_epi16(uv16, uv16);
+    const __m128i lo = _mm256_castsi256_si128(uv8);
+    const __m128i hi = _mm256_extracti128_si256(uv8, 1);
+    *u = _mm_unpacklo_epi32(lo, hi);
+    *v = _mm_unpacklo_epi32(_mm_srli_si128(lo, 4), _mm_srli_si128(hi, 4));
+}
+
+SDL_TARGET_AVX2
+static int RGB2YUV_RowY_AVX2(const Uint32 *src, Uint8 *y, int width, const struct RGB2YUVFactors *cvt)
+{
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int i;
+
+    for (i = 0; i + 32 <= width; i += 32) {
+        __m256i r, g, b, y0, y1, y2, y3, out;
+
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(src + i)), &r, &g, &b);
+        y0 = RGB2YUV_Dot_AVX2(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(src + i + 8)), &r, &g, &b);
+        y1 = RGB2YUV_Dot_AVX2(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(src + i + 16)), &r, &g, &b);
+        y2 = RGB2YUV_Dot_AVX2(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(src + i + 24)), &r, &g, &b);
+        y3 = RGB2YUV_Dot_AVX2(r, g, b, cvt->y, cvt->y_offset);
+        out = _mm256_packus_epi16(_mm256_packs_epi32(y0, y1), _mm256_packs_epi32(y2, y3));
+        _mm256_storeu_si256((__m256i *)(y + i), _mm256_permutevar8x32_epi32(out, order));
+    }
+    _mm256_zeroupper();
+    return i + RGB2YUV_RowY_SSE2(src + i, y + i, width - i, cvt);
+}
+
+SDL_TARGET_AVX2
+static int RGB2YUV_RowUV_AVX2(const Uint32 *curr, const Uint32 *next, Uint8 *u, Uint8 *v, int uv_step, int width_half, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i + 8 <= width_half; i += 8) {
+        __m256i r0, g0, b0, r1, g1, b1, r2, g2, b2, r3, g3, b3, r, g, b;
+        __m128i U, V;
+        Uint8 *ui = u + i * uv_step;
+        Uint8 *vi = v + i * uv_step;
+
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(curr + 2 * i)), &r0, &g0, &b0);
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(curr + 2 * i + 8)), &r1, &g1, &b1);
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(next + 2 * i)), &r2, &g2, &b2);
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(next + 2 * i + 8)), &r3, &g3, &b3);
+        r = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(_mm256_add_epi32(r0, r2), _mm256_add_epi32(r1, r3)), 2);
+        g = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(_mm256_add_epi32(g0, g2), _mm256_add_epi32(g1, g3)), 2);
+        b = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(_mm256_add_epi32(b0, b2), _mm256_add_epi32(b1, b3)), 2);
+        RGB2YUV_PackUV_AVX2(RGB2YUV_Dot_AVX2(r, g, b, cvt->u, 128), RGB2YUV_Dot_AVX2(r, g, b, cvt->v, 128), &U, &V);
+        if (uv_step == 1) {
+            _mm_storel_epi64((__m128i *)ui, U);
+            _mm_storel_epi64((__m128i *)vi, V);
+        } else if (ui < vi) {
+            _mm_storeu_si128((__m128i *)ui, _mm_unpacklo_epi8(U, V));
+        } else {
+            _mm_storeu_si128((__m128i *)vi, _mm_unpacklo_epi8(V, U));
+        }
+    }
+    _mm256_zeroupper();
+    return i + RGB2YUV_RowUV_SSE2(curr + 2 * i, next + 2 * i, u + i * uv_step, v + i * uv_step, uv_step, width_half - i, cvt);
+}
+
+SDL_TARGET_AVX2
+static int RGB2YUV_RowPacked_AVX2(const Uint32 *src, Uint8 *dst, int width_half, Uint32 dst_format, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i + 8 <= width_half; i += 8) {
+        __m256i r0, g0, b0, r1, g1, b1, R, G, B, Y16, Y8;
+        __m128i Y, U, V, uv;
+
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(src + 2 * i)), &r0, &g0, &b0);
+        RGB2YUV_Split_AVX2(_mm256_loadu_si256((const __m256i *)(src + 2 * i + 8)), &r1, &g1, &b1);
+        Y16 = _mm256_packs_epi32(RGB2YUV_Dot_AVX2(r0, g0, b0, cvt->y, cvt->y_offset),
+                                 RGB2YUV_Dot_AVX2(r1, g1, b1, cvt->y, cvt->y_offset));
+        Y16 = _mm256_permute4x64_epi64(Y16, _MM_SHUFFLE(3, 1, 2, 0));
+        Y8 = _mm256_packus_epi16(Y16, Y16);
+        Y = _mm_unpacklo_epi64(_mm256_castsi256_si128(Y8), _mm256_extracti128_si256(Y8, 1));
+        R = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(r0, r1), 1);
+        G = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(g0, g1), 1);
+        B = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(b0, b1), 1);
+        RGB2YUV_PackUV_AVX2(RGB2YUV_Dot_AVX2(R, G, B, cvt->u, 128), RGB2YUV_Dot_AVX2(R, G, B, cvt->v, 128), &U, &V);
+        if (dst_format == SDL_PIXELFORMAT_YVYU) {
+            uv = _mm_unpacklo_epi8(V, U);
+        } else {
+            uv = _mm_unpacklo_epi8(U, V);
+        }
+        if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            _mm_storeu_si128((__m128i *)(dst + 4 * i), _mm_unpacklo_epi8(uv, Y));
+            _mm_storeu_si128((__m128i *)(dst + 4 * i + 16), _mm_unpackhi_epi8(uv, Y));
+        } else {
+            _mm_storeu_si128((__m128i *)(dst + 4 * i), _mm_unpacklo_epi8(Y, uv));
+            _mm_storeu_si128((__m128i *)(dst + 4 * i + 16), _mm_unpackhi_epi8(Y, uv));
+        }
+    }
+    _mm256_zeroupper();
+    return i + RGB2YUV_RowPacked_SSE2(src + 2 * i, dst + 4 * i, width_half - i, dst_format, cvt);
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#ifdef __ARM_NEON
+SDL_FORCE_INLINE void RGB2YUV_Split_NEON(uint32x4_t p, uint32x4_t *r, uint32x4_t *g, uint32x4_t *b)
+{
+    const uint32x4_t mask = vdupq_n_u32(0xFF);
+    *r = vandq_u32(vshrq_n_u32(p, 16), mask);
+    *g = vandq_u32(vshrq_n_u32(p, 8), mask);
+    *b = vandq_u32(p, mask);
+}
+
+/* Multiplies and adds are kept separate, like in MAKE_Y() */
+SDL_FORCE_INLINE uint16x4_t RGB2YUV_Dot_NEON(uint32x4_t r, uint32x4_t g, uint32x4_t b, const float *factors, int offset)
+{
+    float32x4_t sum = vaddq_f32(vmulq_f32(vdupq_n_f32(factors[0]), vcvtq_f32_u32(r)),
+                                vmulq_f32(vdupq_n_f32(factors[1]), vcvtq_f32_u32(g)));
+    int32x4_t value;
+    sum = vaddq_f32(sum, vmulq_f32(vdupq_n_f32(factors[2]), vcvtq_f32_u32(b)));
+    sum = vaddq_f32(sum, vdupq_n_f32(0.5f));
+    value = vandq_s32(vaddq_s32(vcvtq_s32_f32(sum), vdupq_n_s32(offset)), vdupq_n_s32(0xFF));
+    return vmovn_u32(vreinterpretq_u32_s32(value));
+}
+
+SDL_FORCE_INLINE uint32x4_t RGB2YUV_PairSum_NEON(uint32x4_t a, uint32x4_t b)
+{
+    const uint32x4x2_t pairs = vuzpq_u32(a, b);
+    return vaddq_u32(pairs.val[0], pairs.val[1]);
+}
+
+static int RGB2YUV_RowY_NEON(const Uint32 *src, Uint8 *y, int width, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        uint32x4_t r, g, b;
+        uint16x4_t y0, y1, y2, y3;
+
+        RGB2YUV_Split_NEON(vld1q_u32(src + i), &r, &g, &b);
+        y0 = RGB2YUV_Dot_NEON(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_NEON(vld1q_u32(src + i + 4), &r, &g, &b);
+        y1 = RGB2YUV_Dot_NEON(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_NEON(vld1q_u32(src + i + 8), &r, &g, &b);
+        y2 = RGB2YUV_Dot_NEON(r, g, b, cvt->y, cvt->y_offset);
+        RGB2YUV_Split_NEON(vld1q_u32(src + i + 12), &r, &g, &b);
+        y3 = RGB2YUV_Dot_NEON(r, g, b, cvt->y, cvt->y_offset);
+        vst1q_u8(y + i, vcombine_u8(vmovn_u16(vcombine_u16(y0, y1)), vmovn_u16(vcombine_u16(y2, y3))));
+    }
+    return i;
+}
+
+static int RGB2YUV_RowUV_NEON(const Uint32 *curr, const Uint32 *next, Uint8 *u, Uint8 *v, int uv_step, int width_half, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i + 4 <= width_half; i += 4) {
+        uint32x4_t r0, g0, b0, r1, g1, b1, r2, g2, b2, r3, g3, b3, r, g, b;
+        uint8x8_t uv;
+        Uint8 *ui = u + i * uv_step;
+        Uint8 *vi = v + i * uv_step;
+
+        RGB2YUV_Split_NEON(vld1q_u32(curr + 2 * i), &r0, &g0, &b0);
+        RGB2YUV_Split_NEON(vld1q_u32(curr + 2 * i + 4), &r1, &g1, &b1);
+        RGB2YUV_Split_NEON(vld1q_u32(next + 2 * i), &r2, &g2, &b2);
+        RGB2YUV_Split_NEON(vld1q_u32(next + 2 * i + 4), &r3, &g3, &b3);
+        r = vshrq_n_u32(RGB2YUV_PairSum_NEON(vaddq_u32(r0, r2), vaddq_u32(r1, r3)), 2);
+        g = vshrq_n_u32(RGB2YUV_PairSum_NEON(vaddq_u32(g0, g2), vaddq_u32(g1, g3)), 2);
+        b = vshrq_n_u32(RGB2YUV_PairSum_NEON(vaddq_u32(b0, b2), vaddq_u32(b1, b3)), 2);
+        uv = vmovn_u16(vcombine_u16(RGB2YUV_Dot_NEON(r, g, b, cvt->u, 128), RGB2YUV_Dot_NEON(r, g, b, cvt->v, 128)));
+        if (uv_step == 1) {
+            Uint8 bytes[8];
+            vst1_u8(bytes, uv);
+            SDL_memcpy(ui, bytes, 4);
+            SDL_memcpy(vi, bytes + 4, 4);
+        } else if (ui < vi) {
+            vst1_u8(ui, vzip_u8(uv, vext_u8(uv, uv, 4)).val[0]);
+        } else {
+            vst1_u8(vi, vzip_u8(vext_u8(uv, uv, 4), uv).val[0]);
+        }
+    }
+    return i;
+}
+
+static int RGB2YUV_RowPacked_NEON(const Uint32 *src, Uint8 *dst, int width_half, Uint32 dst_format, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i + 4 <= width_half; i += 4) {
+        uint32x4_t r0, g0, b0, r1, g1, b1, R, G, B;
+        uint8x8_t Y, uv, chroma;
+        uint8x8x2_t out;
+
+        RGB2YUV_Split_NEON(vld1q_u32(src + 2 * i), &r0, &g0, &b0);
+        RGB2YUV_Split_NEON(vld1q_u32(src + 2 * i + 4), &r1, &g1, &b1);
+        Y = vmovn_u16(vcombine_u16(RGB2YUV_Dot_NEON(r0, g0, b0, cvt->y, cvt->y_offset),
+                                   RGB2YUV_Dot_NEON(r1, g1, b1, cvt->y, cvt->y_offset)));
+        R = vshrq_n_u32(RGB2YUV_PairSum_NEON(r0, r1), 1);
+        G = vshrq_n_u32(RGB2YUV_PairSum_NEON(g0, g1), 1);
+        B = vshrq_n_u32(RGB2YUV_PairSum_NEON(b0, b1), 1);
+        uv = vmovn_u16(vcombine_u16(RGB2YUV_Dot_NEON(R, G, B, cvt->u, 128), RGB2YUV_Dot_NEON(R, G, B, cvt->v, 128)));
+        if (dst_format == SDL_PIXELFORMAT_YVYU) {
+            chroma = vzip_u8(vext_u8(uv, uv, 4), uv).val[0];
+        } else {
+            chroma = vzip_u8(uv, vext_u8(uv, uv, 4)).val[0];
+        }
+        if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            out = vzip_u8(chroma, Y);
+        } else {
+            out = vzip_u8(Y, chroma);
+        }
+        vst1q_u8(dst + 4 * i, vcombine_u8(out.val[0], out.val[1]));
+    }
+    return i;
+}
+#endif /* __ARM_NEON */
+
+static void GetRGB2YUVRowFuncs(RGB2YUVRowYFunc *row_y, RGB2YUVRowUVFunc *row_uv, RGB2YUVRowPackedFunc *row_packed)
+{
+    *row_y = NULL;
+    *row_uv = NULL;
+    *row_packed = NULL;
+
+    if (!UseYUVIntrinsics()) {
+        return;
+    }
+#if defined(HAVE_AVX2_INTRINSICS)
+    if (SDL_HasAVX2()) {
+        *row_y = RGB2YUV_RowY_AVX2;
+        *row_uv = RGB2YUV_RowUV_AVX2;
+        *row_packed = RGB2YUV_RowPacked_AVX2;
+        return;
+    }
+#endif
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        *row_y = RGB2YUV_RowY_SSE2;
+        *row_uv = RGB2YUV_RowUV_SSE2;
+        *row_packed = RGB2YUV_RowPacked_SSE2;
+        return;
+    }
+#endif
+#ifdef __ARM_NEON
+    if (SDL_HasNEON()) {
+        *row_y = RGB2YUV_RowY_NEON;
+        *row_uv = RGB2YUV_RowUV_NEON;
+        *row_packed = RGB2YUV_RowPacked_NEON;
+        return;
+    }
+#endif
+}
+
+static const struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] = {
+    /* ITU-T T.871 (JPEG) */
+    {
+        0,
+        { 0.2990f, 0.5870f, 0.1140f },
+        { -0.1687f, -0.3313f, 0.5000f },
+        { 0.5000f, -0.4187f, -0.0813f },
+    },
+    /* ITU-R BT.601-7 */
+    {
+        16,
+        { 0.2568f, 0.5041f, 0.0979f },
+        { -0.1482f, -0.2910f, 0.4392f },
+        { 0.4392f, -0.3678f, -0.0714f },
+    },
+    /* ITU-R BT.709-6 */
+    {
+        16,
+        { 0.1826f, 0.6142f, 0.0620f },
+        { -0.1006f, -0.3386f, 0.4392f },
+        { 0.4392f, -0.3989f, -0.0403f },
+    },
+};
+
+/* Convert rows row to row + rows - 1 of a width x height image, row is even for 4:2:0 formats */
+static int SDL_ConvertPixels_ARGB8888_to_YUV_Rows(int width, int height, int row, int rows, const void *src, int src_pitch,
+                                                  Uint32 dst_format, void *dst, int dst_pitch, const struct RGB2YUVFactors *cvt)
 {
     const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
+    const int height_half = rows / 2;
+    const int height_remainder = (rows & 0x1);
     const int width_half = width / 2;
     const int width_remainder = (width & 0x1);
     int i, j;
+    RGB2YUVRowYFunc row_y;
+    RGB2YUVRowUVFunc row_uv;
+    RGB2YUVRowPackedFunc row_packed;
+
+    GetRGB2YUVRowFuncs(&row_y, &row_uv, &row_packed);
 
-    static struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] = {
-        /* ITU-T T.871 (JPEG) */
-        {
-            0,
-            { 0.2990f, 0.5870f, 0.1140f },
-            { -0.1687f, -0.3313f, 0.5000f },
-            { 0.5000f, -0.4187f, -0.0813f },
-        },
-        /* ITU-R BT.601-7 */
-        {
-            16,
-            { 0.2568f, 0.5041f, 0.0979f },
-            { -0.1482f, -0.2910f, 0.4392f },
-            { 0.4392f, -0.3678f, -0.0714f },
-        },
-        /* ITU-R BT.709-6 */
-        {
-            16,
-            { 0.1826f, 0.6142f, 0.0620f },
-            { -0.1006f, -0.3386f, 0.4392f },
-            { 0.4392f, -0.3989f, -0.0403f },
-        },
-    };
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+    src = (const Uint8 *)src + (size_t)row * src_pitch;
 
 #define MAKE_Y(r, g, b) (Uint8)((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset)
 #define MAKE_U(r, g, b) (Uint8)((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128)
@@ -599,11 +1573,18 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
         plane_interleaved_uv = (plane_y + height * y_stride);
         y_skip = (y_stride - width);
 
+        plane_y += (size_t)row * y_stride;
+        plane_u += (size_t)(row / 2) * uv_stride;
+        plane_v += (size_t)(row / 2) * uv_stride;
+        plane_interleaved_uv += (size_t)(row / 2) * uv_stride;
+
         curr_row = (const Uint8 *)src;
 
         /* Write Y plane */
-        for (j = 0; j < height; j++) {
-            for (i = 0; i < width; i++) {
+        for (j = 0; j < rows; j++) {
+            i = row_y ? row_y((const Uint32 *)curr_row, plane_y, width, cvt) : 0;
+            plane_y += i;
+            for (; i < width; i++) {
                 const Uint32 p1 = ((const Uint32 *)curr_row)[i];
                 const Uint32 r = (p1 & 0x00ff0000) >> 16;
                 const Uint32 g = (p1 & 0x0000ff00) >> 8;
@@ -622,7 +1603,10 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
             /* Write UV planes, not interleaved */
             uv_skip = (uv_stride - (width + 1) / 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = row_uv ? row_uv((const Uint32 *)curr_row, (const Uint32 *)next_row, plane_u, plane_v, 1, width_half, cvt) : 0;
+                plane_u += i;
+                plane_v += i;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_u++ = MAKE_U(r, g, b);
                     *plane_v++ = MAKE_V(r, g, b);
@@ -654,7 +1638,9 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
         } else if (dst_format == SDL_PIXELFORMAT_NV12) {
             uv_skip = (uv_stride - ((width + 1) / 2) * 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = row_uv ? row_uv((const Uint32 *)curr_row, (const Uint32 *)next_row, plane_interleaved_uv, plane_interleaved_uv + 1, 2, width_half, cvt) : 0;
+                plane_interleaved_uv += 2 * i;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_interleaved_uv++ = MAKE_U(r, g, b);
                     *plane_interleaved_uv++ = MAKE_V(r, g, b);
@@ -683,7 +1669,9 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
         } else /* dst_format == SDL_PIXELFORMAT_NV21 */ {
             uv_skip = (uv_stride - ((width + 1) / 2) * 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = row_uv ? row_uv((const Uint32 *)curr_row, (const Uint32 *)next_row, plane_interleaved_uv + 1, plane_interleaved_uv, 2, width_half, cvt) : 0;
+                plane_interleaved_uv += 2 * i;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_interleaved_uv++ = MAKE_V(r, g, b);
                     *plane_interleaved_uv++ = MAKE_U(r, g, b);
@@ -717,7 +1705,7 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
     case SDL_PIXELFORMAT_YVYU:
     {
         const Uint8 *curr_row = (const Uint8 *)src;
-        Uint8 *plane = (Uint8 *)dst;
+        Uint8 *plane = (Uint8 *)dst + (size_t)row * dst_pitch;
         const int row_size = (4 * ((width + 1) / 2));
         int plane_skip;
 
@@ -728,8 +1716,10 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
 
         /* Write YUV plane, packed */
         if (dst_format == SDL_PIXELFORMAT_YUY2) {
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
+            for (j = 0; j < rows; j++) {
+                i = row_packed ? row_packed((const Uint32 *)curr_row, plane, width_half, dst_format, cvt) : 0;
+                plane += 4 * i;
+                for (; i < width_half; i++) {
                     READ_TWO_RGB_PIXELS;
                     /* Y U Y1 V */
                     *plane++ = MAKE_Y(r, g, b);
@@ -749,8 +1739,10 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
                 curr_row += src_pitch;
             }
         } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
+            for (j = 0; j < rows; j++) {
+                i = row_packed ? row_packed((const Uint32 *)curr_row, plane, width_half, dst_format, cvt) : 0;
+                plane += 4 * i;
+                for (; i < width_half; i++) {
                     READ_TWO_RGB_PIXELS;
                     /* U Y V Y1 */
                     *plane++ = MAKE_U(R, G, B);
@@ -770,8 +1762,10 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
                 curr_row += src_pitch;
             }
         } else if (dst_format == SDL_PIXELFORMAT_YVYU) {
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
+            for (j = 0; j < rows; j++) {
+                i = row_packed ? row_packed((const Uint32 *)curr_row, plane, width_half, dst_format, cvt) : 0;
+                plane += 4 * i;
+                for (; i < width_half; i++) {
                     READ_TWO_RGB_PIXELS;
                     /* Y V Y1 U */
                     *plane++ = MAKE_Y(r, g, b);
@@ -808,6 +1802,41 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
     return 0;
 }
 
+typedef struct
+{
+    int width;
+    int height;
+    const void *src;
+    int src_pitch;
+    Uint32 dst_format;
+    void *dst;
+    int dst_pitch;
+    const struct RGB2YUVFactors *cvt;
+} ARGB8888ToYUVData;
+
+static int SDL_ConvertPixels_ARGB8888_to_YUV_Band(void *data, int row, int rows)
+{
+    const ARGB8888ToYUVData *yuv = (const ARGB8888ToYUVData *)data;
+
+    return SDL_ConvertPixels_ARGB8888_to_YUV_Rows(yuv->width, yuv->height, row, rows, yuv->src, yuv->src_pitch,
+                                                  yuv->dst_format, yuv->dst, yuv->dst_pitch, yuv->cvt);
+}
+
+static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+{
+    ARGB8888ToYUVData yuv;
+
+    yuv.width = width;
+    yuv.height = height;
+    yuv.src = src;
+    yuv.src_pitch = src_pitch;
+    yuv.dst_format = dst_format;
+    yuv.dst = dst;
+    yuv.dst_pitch = dst_pitch;
+    yuv.cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+    return SDL_ConvertInBands(width, height, 2, SDL_ConvertPixels_ARGB8888_to_YUV_Band, &yuv);
+}
+
 int SDL_ConvertPixels_RGB_to_YUV(int width, int height,
                                  Uint32 src_format, const void *src, int src_pitch,
                                  Uint32 dst_format, void *dst, int dst_pitch)
@@ -986,7 +2015,7 @@ static int SDL_ConvertPixels_PackUVPlanes_to_NV(int width, int height, const voi
     Uint8 *dstUV;
     Uint8 *tmp = NULL;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     /* Skip the Y plane */
@@ -1059,7 +2088,7 @@ static int SDL_ConvertPixels_SplitNV_to_UVPlanes(int width, int height, const vo
     Uint8 *dst1, *dst2;
     Uint8 *tmp = NULL;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     /* Skip the Y plane */
@@ -1136,7 +2165,7 @@ static int SDL_ConvertPixels_SwapNV(int width, int height, const void *src, int
     const Uint16 *srcUV;
     Uint16 *dstUV;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     /* Skip the Y plane */
@@ -1271,7 +2300,7 @@ static int SDL_ConvertPixels_YUY2_to_UYVY(int width, int height, const void *src
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     y = height;
@@ -1312,7 +2341,7 @@ static int SDL_ConvertPixels_YUY2_to_YVYU(int width, int height, const void *src
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     y = height;
@@ -1353,7 +2382,7 @@ static int SDL_ConvertPixels_UYVY_to_YUY2(int width, int height, const void *src
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     y = height;
@@ -1394,7 +2423,7 @@ static int SDL_ConvertPixels_UYVY_to_YVYU(int width, int height, const void *src
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     y = height;
@@ -1435,7 +2464,7 @@ static int SDL_ConvertPixels_YVYU_to_YUY2(int width, int height, const void *src
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     y = height;
@@ -1476,7 +2505,7 @@ static int SDL_ConvertPixels_YVYU_to_UYVY(int width, int height, const void *src
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_HasSSE2() && UseYUVIntrinsics();
 #endif
 
     y = height;
@@ -24,12 +24,23 @@
 
 #include "../SDL_internal.h"
 
+#include "SDL_rect.h"
+#include "SDL_render.h"
+
 /* YUV conversion functions */
 
 extern int SDL_ConvertPixels_YUV_to_RGB(int width, int height, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch);
 extern int SDL_ConvertPixels_RGB_to_YUV(int width, int height, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch);
 extern int SDL_ConvertPixels_YUV_to_YUV(int width, int height, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch);
 
+/* Convert srcrect of a src_w x src_h YUV image to a dst_w x dst_h RGB image, scaling as it goes */
+extern int SDL_ConvertPixels_YUV_to_RGB_Scaled(int src_w, int src_h, Uint32 src_format, const void *src, int src_pitch, const SDL_Rect *srcrect,
+                                               Uint32 dst_format, void *dst, int dst_w, int dst_h, int dst_pitch, SDL_ScaleMode scaleMode);
+
+/* Start and stop watching SDL_HINT_YUV_INTRINSICS, from SDL_InitSubSystem() and SDL_Quit() */
+extern void SDL_InitYUVIntrinsics(void);
+extern void SDL_QuitYUVIntrinsics(void);
+
 #endif /* SDL_yuv_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
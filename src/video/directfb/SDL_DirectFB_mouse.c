@@ -141,7 +141,6 @@ DirectFB_CreateCursor(SDL_Surface * surface, int hot_x, int hot_y)
     int pitch, i;
 
     SDL_assert(surface->format->format == SDL_PIXELFORMAT_ARGB8888);
-    SDL_assert(surface->pitch == surface->w * 4);
 
     SDL_DFB_ALLOC_CLEAR( cursor, sizeof(*cursor));
     SDL_DFB_ALLOC_CLEAR(curdata, sizeof(*curdata));
@@ -27,6 +27,7 @@
 
 #include "SDL_kmsdrmvideo.h"
 #include "SDL_kmsdrmdyn.h"
+#include "../SDL_blit_rotate.h"
 #include <errno.h>
 #include <sys/mman.h>
 
@@ -54,14 +55,29 @@ int KMSDRM_Dumb_CreateDumbBuffers(_THIS, SDL_Window *window)
         return -1;
     }
 
+    /* Let the plane rotate the buffers if it can, otherwise they keep the
+       panel's native size and get rotated on upload. */
+    if (dispdata->rotation != DRM_MODE_ROTATE_0 && !dispdata->plane_rotated &&
+        !KMSDRM_SetPlaneRotation(_this, dispdata, dispdata->rotation)) {
+        dispdata->rotation_prop_id = 0;
+    }
+    windata->dumb_rotation = dispdata->plane_rotated ? 0 : KMSDRM_GetRotationAngle(dispdata->rotation);
+
     for (int i = 0; i < SDL_arraysize(windata->dumb_buffers); i++) {
         buffer = &windata->dumb_buffers[i];
         req_create = &buffer->req_create;
         req_map = &buffer->req_map;
         req_destroy_dumb = &buffer->req_destroy_dumb;
 
-        req_create->width = dispdata->fullscreen_mode.hdisplay;
-        req_create->height = dispdata->fullscreen_mode.vdisplay;
+        if (dispdata->plane_rotated) {
+            int w, h;
+            KMSDRM_GetModeSize(_this, dispdata, &dispdata->fullscreen_mode, &w, &h);
+            req_create->width = w;
+            req_create->height = h;
+        } else {
+            req_create->width = dispdata->fullscreen_mode.hdisplay;
+            req_create->height = dispdata->fullscreen_mode.vdisplay;
+        }
         req_create->bpp = 32; //!! HARDCODED SDL_PIXELFORMAT_ARGB8888
 
         if (KMSDRM_drmIoctl(viddata->drm_fd, DRM_IOCTL_MODE_CREATE_DUMB, req_create) < 0) {
@@ -92,6 +108,7 @@ int KMSDRM_Dumb_CreateDumbBuffers(_THIS, SDL_Window *window)
 
     windata->back_buffer = 0;
     windata->front_buffer = 1;
+    windata->num_dumb_damage = -2;
     viddata->dumb_init = SDL_TRUE;
 
     return 0;
@@ -137,10 +154,30 @@ int KMSDRM_Dumb_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * for
     *pixels = surf->pixels;
     *pitch = surf->pitch;
     windata->framebuffer = surf;
+    windata->num_dumb_damage = -2;
 
     return 0;
 }
 
+static void KMSDRM_Dumb_CopyRect(SDL_Window *window, KMSDRM_DumbBuffer *buffer, SDL_Surface *surf, const SDL_Rect *rect)
+{
+    const SDL_Rect bounds = { 0, 0, window->w, window->h };
+    SDL_Rect clipped;
+    Uint8 *row_db, *row_fb;
+    int i;
+
+    if (!SDL_IntersectRect(rect, &bounds, &clipped)) {
+        return;
+    }
+    row_db = (Uint8 *)buffer->map + clipped.y * buffer->req_create.pitch + clipped.x * surf->format->BytesPerPixel;
+    row_fb = (Uint8 *)surf->pixels + clipped.y * surf->pitch + clipped.x * surf->format->BytesPerPixel;
+    for (i = 0; i < clipped.h; i++) {
+        SDL_memcpy(row_db, row_fb, clipped.w * surf->format->BytesPerPixel);
+        row_db += buffer->req_create.pitch;
+        row_fb += surf->pitch;
+    }
+}
+
 int KMSDRM_Dumb_UpdateWindowFramebuffer(_THIS, SDL_Window * window, const SDL_Rect * rects, int numrects)
 {
     SDL_WindowData *windata = ((SDL_WindowData *)window->driverdata);
@@ -161,10 +198,34 @@ int KMSDRM_Dumb_UpdateWindowFramebuffer(_THIS, SDL_Window * window, const SDL_Re
     if (!viddata->dumb_init)
         return -1;
 
-    for (int i = 0; i < window->h; i++) {
-        Uint32 *row_db = buffer->map + (i * buffer->req_create.pitch);
-        Uint32 *row_fb = surf->pixels + (i * surf->pitch);
-        SDL_memcpy(row_db, row_fb, window->w * surf->format->BytesPerPixel);
+    if (windata->dumb_rotation) {
+        SDL_BlitRotate90(surf->pixels, surf->pitch, buffer->map, buffer->req_create.pitch,
+                         window->w, window->h, surf->format->BytesPerPixel,
+                         windata->dumb_rotation, SDL_FALSE, SDL_FALSE);
+    } else if (windata->num_dumb_damage >= 0 && numrects <= KMSDRM_MAX_DUMB_DAMAGE) {
+        /* Only copy what changed since this buffer was last shown */
+        for (int i = 0; i < windata->num_dumb_damage; i++) {
+            KMSDRM_Dumb_CopyRect(window, buffer, surf, &windata->dumb_damage[i]);
+        }
+        for (int i = 0; i < numrects; i++) {
+            KMSDRM_Dumb_CopyRect(window, buffer, surf, &rects[i]);
+        }
+    } else {
+        for (int i = 0; i < window->h; i++) {
+            Uint32 *row_db = buffer->map + (i * buffer->req_create.pitch);
+            Uint32 *row_fb = surf->pixels + (i * surf->pitch);
+            SDL_memcpy(row_db, row_fb, window->w * surf->format->BytesPerPixel);
+        }
+    }
+
+    /* The other buffer still needs these, the rotated upload always copies everything */
+    if (windata->num_dumb_damage == -2) {
+        windata->num_dumb_damage = -1;
+    } else if (numrects <= KMSDRM_MAX_DUMB_DAMAGE && !windata->dumb_rotation) {
+        SDL_memcpy(windata->dumb_damage, rects, numrects * sizeof(*rects));
+        windata->num_dumb_damage = numrects;
+    } else {
+        windata->num_dumb_damage = -1;
     }
 
     ret = KMSDRM_drmModeSetCrtc(viddata->drm_fd, dispdata->crtc->crtc_id,
@@ -670,6 +670,174 @@ static SDL_bool KMSDRM_CrtcGetVrr(uint32_t drm_fd, uint32_t crtc_id)
     return SDL_FALSE;
 }
 
+/* Reads the connector "panel orientation" property and returns the
+   DRM_MODE_ROTATE_* value that shows the image upright on the panel. */
+static uint64_t KMSDRM_GetPanelRotation(uint32_t drm_fd, uint32_t connector_id)
+{
+    uint64_t rotation = DRM_MODE_ROTATE_0;
+    drmModeObjectPropertiesPtr props;
+    uint32_t i;
+    int j;
+
+    props = KMSDRM_drmModeObjectGetProperties(drm_fd,
+                                              connector_id,
+                                              DRM_MODE_OBJECT_CONNECTOR);
+
+    if (!props) {
+        return rotation;
+    }
+
+    for (i = 0; i < props->count_props; ++i) {
+        drmModePropertyPtr drm_prop = KMSDRM_drmModeGetProperty(drm_fd, props->props[i]);
+
+        if (!drm_prop) {
+            continue;
+        }
+
+        if (SDL_strcmp(drm_prop->name, "panel orientation") == 0) {
+            for (j = 0; j < drm_prop->count_enums; ++j) {
+                const char *name = drm_prop->enums[j].name;
+
+                if (drm_prop->enums[j].value != props->prop_values[i]) {
+                    continue;
+                }
+
+                if (SDL_strcmp(name, "Upside Down") == 0) {
+                    rotation = DRM_MODE_ROTATE_180;
+                } else if (SDL_strcmp(name, "Left Side Up") == 0) {
+                    rotation = DRM_MODE_ROTATE_90;
+                } else if (SDL_strcmp(name, "Right Side Up") == 0) {
+                    rotation = DRM_MODE_ROTATE_270;
+                }
+            }
+        }
+
+        KMSDRM_drmModeFreeProperty(drm_prop);
+    }
+
+    KMSDRM_drmModeFreeObjectProperties(props);
+
+    return rotation;
+}
+
+/* Finds the primary plane of the CRTC, and its "rotation" property if the
+   plane can apply the rotation the display needs. */
+static void KMSDRM_FindPlaneRotation(uint32_t drm_fd, SDL_DisplayData *dispdata, int crtc_index)
+{
+    drmModePlaneResPtr plane_res;
+    uint32_t i, j;
+    int k;
+
+    if (KMSDRM_drmSetClientCap(drm_fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) != 0) {
+        return;
+    }
+
+    plane_res = KMSDRM_drmModeGetPlaneResources(drm_fd);
+    if (!plane_res) {
+        return;
+    }
+
+    for (i = 0; !dispdata->plane_id && i < plane_res->count_planes; ++i) {
+        drmModePlanePtr plane = KMSDRM_drmModeGetPlane(drm_fd, plane_res->planes[i]);
+        drmModeObjectPropertiesPtr props;
+        SDL_bool is_primary = SDL_FALSE;
+        uint32_t rotation_prop_id = 0;
+
+        if (!plane) {
+            continue;
+        }
+
+        props = KMSDRM_drmModeObjectGetProperties(drm_fd, plane->plane_id, DRM_MODE_OBJECT_PLANE);
+
+        for (j = 0; props && j < props->count_props; ++j) {
+            drmModePropertyPtr drm_prop = KMSDRM_drmModeGetProperty(drm_fd, props->props[j]);
+
+            if (!drm_prop) {
+                continue;
+            }
+
+            if (SDL_strcmp(drm_prop->name, "type") == 0) {
+                is_primary = (props->prop_values[j] == DRM_PLANE_TYPE_PRIMARY);
+            } else if (SDL_strcmp(drm_prop->name, "rotation") == 0) {
+                /* Bitmask properties list the bit index of every supported value. */
+                for (k = 0; k < drm_prop->count_enums; ++k) {
+                    if ((1ULL << drm_prop->enums[k].value) == dispdata->rotation) {
+                        rotation_prop_id = drm_prop->prop_id;
+                    }
+                }
+            }
+
+            KMSDRM_drmModeFreeProperty(drm_prop);
+        }
+
+        if (props) {
+            KMSDRM_drmModeFreeObjectProperties(props);
+        }
+
+        if (is_primary && (plane->possible_crtcs & (1 << crtc_index))) {
+            dispdata->plane_id = plane->plane_id;
+            dispdata->rotation_prop_id = rotation_prop_id;
+        }
+
+        KMSDRM_drmModeFreePlane(plane);
+    }
+
+    KMSDRM_drmModeFreePlaneResources(plane_res);
+}
+
+/* Converts a DRM_MODE_ROTATE_* value (counter-clockwise) to the number of
+   clockwise quarter turns used by SDL_BlitRotate90(). */
+int KMSDRM_GetRotationAngle(uint64_t rotation)
+{
+    switch (rotation) {
+    case DRM_MODE_ROTATE_90:
+        return 3;
+    case DRM_MODE_ROTATE_180:
+        return 2;
+    case DRM_MODE_ROTATE_270:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* Gets the size of a mode as the app sees it. Dumb buffers are rotated on
+   upload when the plane can't do it, but GL output can only be rotated by
+   the plane, so it keeps the panel's native size otherwise. */
+void KMSDRM_GetModeSize(_THIS, SDL_DisplayData *dispdata, const drmModeModeInfo *mode, int *w, int *h)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+    SDL_bool swap = (dispdata->rotation & (DRM_MODE_ROTATE_90 | DRM_MODE_ROTATE_270)) &&
+                    (!viddata->opengl_mode || dispdata->rotation_prop_id);
+
+    *w = swap ? mode->vdisplay : mode->hdisplay;
+    *h = swap ? mode->hdisplay : mode->vdisplay;
+}
+
+/* Sets the rotation of the display's primary plane. The plane can't be
+   rotated while it scans out a buffer sized for the old orientation, so the
+   CRTC is disabled first and has to be set again with a matching buffer. */
+SDL_bool KMSDRM_SetPlaneRotation(_THIS, SDL_DisplayData *dispdata, uint64_t rotation)
+{
+    SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
+
+    if (!dispdata->plane_id || !dispdata->rotation_prop_id) {
+        return SDL_FALSE;
+    }
+
+    KMSDRM_drmSetClientCap(viddata->drm_fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1);
+    KMSDRM_drmModeSetCrtc(viddata->drm_fd, dispdata->crtc->crtc_id, 0, 0, 0, NULL, 0, NULL);
+
+    if (KMSDRM_drmModeObjectSetProperty(viddata->drm_fd, dispdata->plane_id, DRM_MODE_OBJECT_PLANE,
+                                        dispdata->rotation_prop_id, rotation) != 0) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "KMSDRM: Could not set plane rotation, rotating in software.");
+        return SDL_FALSE;
+    }
+
+    dispdata->plane_rotated = (rotation != DRM_MODE_ROTATE_0);
+    return SDL_TRUE;
+}
+
 /* Gets a DRM connector, builds an SDL_Display with it, and adds it to the
    list of SDL Displays in _this->displays[]  */
 static void KMSDRM_AddDisplay(_THIS, drmModeConnector *connector, drmModeRes *resources)
@@ -833,6 +1001,19 @@ static void KMSDRM_AddDisplay(_THIS, drmModeConnector *connector, drmModeRes *re
     dispdata->connector = connector;
     dispdata->crtc = crtc;
 
+    /* Find out if the panel is mounted rotated, and if the plane can fix it. */
+    dispdata->rotation = KMSDRM_GetPanelRotation(viddata->drm_fd, connector->connector_id);
+    if (dispdata->rotation != DRM_MODE_ROTATE_0) {
+        for (i = 0; i < resources->count_crtcs; i++) {
+            if (resources->crtcs[i] == crtc->crtc_id) {
+                KMSDRM_FindPlaneRotation(viddata->drm_fd, dispdata, i);
+                break;
+            }
+        }
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Panel needs rotation %d, done by the %s",
+                     (int)dispdata->rotation, dispdata->rotation_prop_id ? "plane" : "CPU");
+    }
+
     /* save previous vrr state */
     dispdata->saved_vrr = KMSDRM_CrtcGetVrr(viddata->drm_fd, crtc->crtc_id);
     /* try to enable vrr */
@@ -857,8 +1038,7 @@ static void KMSDRM_AddDisplay(_THIS, drmModeConnector *connector, drmModeRes *re
     modedata->mode_index = mode_index;
 
     display.driverdata = dispdata;
-    display.desktop_mode.w = dispdata->mode.hdisplay;
-    display.desktop_mode.h = dispdata->mode.vdisplay;
+    KMSDRM_GetModeSize(_this, dispdata, &dispdata->mode, &display.desktop_mode.w, &display.desktop_mode.h);
     display.desktop_mode.refresh_rate = dispdata->mode.vrefresh;
     display.desktop_mode.format = SDL_PIXELFORMAT_ARGB8888;
     display.desktop_mode.driverdata = modedata;
@@ -992,6 +1172,11 @@ static void KMSDRM_DestroySurfaces(_THIS, SDL_Window *window)
     /**********************************************/
     /*KMSDRM_WaitPageflip(_this, windata);*/
 
+    /* The original TTY buffer isn't rotated, put the plane back to normal. */
+    if (dispdata->plane_rotated) {
+        KMSDRM_SetPlaneRotation(_this, dispdata, DRM_MODE_ROTATE_0);
+    }
+
     /***********************************************************************/
     /* Restore the original CRTC configuration: configue the crtc with the */
     /* original video mode and make it point to the original TTY buffer.   */
@@ -1044,10 +1229,12 @@ static void KMSDRM_GetModeToSet(SDL_Window *window, drmModeModeInfo *out_mode)
     }
 }
 
-static void KMSDRM_DirtySurfaces(SDL_Window *window)
+static void KMSDRM_DirtySurfaces(_THIS, SDL_Window *window)
 {
     SDL_WindowData *windata = (SDL_WindowData *)window->driverdata;
+    SDL_DisplayData *dispdata = (SDL_DisplayData *)SDL_GetDisplayForWindow(window)->driverdata;
     drmModeModeInfo mode;
+    int w, h;
 
     /* Can't recreate EGL surfaces right now, need to wait until SwapWindow
        so the correct thread-local surface and context state are available */
@@ -1057,7 +1244,8 @@ static void KMSDRM_DirtySurfaces(SDL_Window *window)
        or SetWindowFullscreen, send a fake event for now since the actual
        recreation is deferred */
     KMSDRM_GetModeToSet(window, &mode);
-    SDL_SendWindowEvent(window, SDL_WINDOWEVENT_RESIZED, mode.hdisplay, mode.vdisplay);
+    KMSDRM_GetModeSize(_this, dispdata, &mode, &w, &h);
+    SDL_SendWindowEvent(window, SDL_WINDOWEVENT_RESIZED, w, h);
 }
 
 /* This determines the size of the fb, which comes from the GBM surface
@@ -1077,6 +1265,7 @@ int KMSDRM_CreateSurfaces(_THIS, SDL_Window *window)
 #else
     SDL_bool is_init = windata->dumb_buffers[0].buf_id > 0;
 #endif
+    int w, h;
 
     /* If the current window already has surfaces, destroy them before creating other. */
     if (is_init) {
@@ -1091,8 +1280,8 @@ int KMSDRM_CreateSurfaces(_THIS, SDL_Window *window)
             return SDL_SetError("KMSDRM: Failed to create window Dumb Buffer.");
         }
 
-        SDL_SendWindowEvent(window, SDL_WINDOWEVENT_RESIZED,
-            dispdata->mode.hdisplay, dispdata->mode.vdisplay);
+        KMSDRM_GetModeSize(_this, dispdata, &dispdata->mode, &w, &h);
+        SDL_SendWindowEvent(window, SDL_WINDOWEVENT_RESIZED, w, h);
 
         windata->egl_surface_dirty = SDL_FALSE;
         return 0;
@@ -1109,14 +1298,22 @@ int KMSDRM_CreateSurfaces(_THIS, SDL_Window *window)
        SDL_video.c expects. Hulk-smash the display's current_mode to keep the
        mode that's set in sync with what SDL_video.c thinks is set */
     KMSDRM_GetModeToSet(window, &dispdata->mode);
+    KMSDRM_GetModeSize(_this, dispdata, &dispdata->mode, &w, &h);
 
-    display->current_mode.w = dispdata->mode.hdisplay;
-    display->current_mode.h = dispdata->mode.vdisplay;
+    display->current_mode.w = w;
+    display->current_mode.h = h;
     display->current_mode.refresh_rate = dispdata->mode.vrefresh;
     display->current_mode.format = SDL_PIXELFORMAT_ARGB8888;
 
-    windata->gs = KMSDRM_gbm_surface_create(viddata->gbm_dev,
-                                            dispdata->mode.hdisplay, dispdata->mode.vdisplay,
+    /* GL output can only be rotated by the plane: the GBM surface is created
+       in the app's orientation and scanned out rotated. */
+    if (dispdata->rotation != DRM_MODE_ROTATE_0 && dispdata->rotation_prop_id &&
+        !KMSDRM_SetPlaneRotation(_this, dispdata, dispdata->rotation)) {
+        dispdata->rotation_prop_id = 0;
+        KMSDRM_GetModeSize(_this, dispdata, &dispdata->mode, &w, &h);
+    }
+
+    windata->gs = KMSDRM_gbm_surface_create(viddata->gbm_dev, w, h,
                                             surface_fmt, surface_flags);
 
     if (!windata->gs) {
@@ -1139,8 +1336,7 @@ int KMSDRM_CreateSurfaces(_THIS, SDL_Window *window)
     egl_context = (EGLContext)SDL_GL_GetCurrentContext();
     ret = SDL_EGL_MakeCurrent(_this, windata->egl_surface, egl_context);
 
-    SDL_SendWindowEvent(window, SDL_WINDOWEVENT_RESIZED,
-                        dispdata->mode.hdisplay, dispdata->mode.vdisplay);
+    SDL_SendWindowEvent(window, SDL_WINDOWEVENT_RESIZED, w, h);
 
     windata->egl_surface_dirty = SDL_FALSE;
 
@@ -1227,8 +1423,7 @@ void KMSDRM_GetDisplayModes(_THIS, SDL_VideoDisplay *display)
             modedata->mode_index = i;
         }
 
-        mode.w = conn->modes[i].hdisplay;
-        mode.h = conn->modes[i].vdisplay;
+        KMSDRM_GetModeSize(_this, dispdata, &conn->modes[i], &mode.w, &mode.h);
         mode.refresh_rate = conn->modes[i].vrefresh;
         mode.format = SDL_PIXELFORMAT_ARGB8888;
         mode.driverdata = modedata;
@@ -1264,7 +1459,7 @@ int KMSDRM_SetDisplayMode(_THIS, SDL_VideoDisplay *display, SDL_DisplayMode *mod
     dispdata->fullscreen_mode = conn->modes[modedata->mode_index];
 
     for (i = 0; i < viddata->num_windows; i++) {
-        KMSDRM_DirtySurfaces(viddata->windows[i]);
+        KMSDRM_DirtySurfaces(_this, viddata->windows[i]);
     }
 
     return 0;
@@ -1510,7 +1705,7 @@ void KMSDRM_SetWindowSize(_THIS, SDL_Window *window)
 {
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
     if (!viddata->vulkan_mode) {
-        KMSDRM_DirtySurfaces(window);
+        KMSDRM_DirtySurfaces(_this, window);
     }
 }
 void KMSDRM_SetWindowFullscreen(_THIS, SDL_Window *window, SDL_VideoDisplay *display, SDL_bool fullscreen)
@@ -1518,7 +1713,7 @@ void KMSDRM_SetWindowFullscreen(_THIS, SDL_Window *window, SDL_VideoDisplay *dis
 {
     SDL_VideoData *viddata = ((SDL_VideoData *)_this->driverdata);
     if (!viddata->vulkan_mode) {
-        KMSDRM_DirtySurfaces(window);
+        KMSDRM_DirtySurfaces(_this, window);
     }
 }
 void KMSDRM_ShowWindow(_THIS, SDL_Window *window)
@@ -36,6 +36,17 @@
 #include <gbm.h>
 #include <EGL/egl.h>
 
+#ifndef DRM_MODE_ROTATE_0
+#define DRM_MODE_ROTATE_0   (1 << 0)
+#define DRM_MODE_ROTATE_90  (1 << 1)
+#define DRM_MODE_ROTATE_180 (1 << 2)
+#define DRM_MODE_ROTATE_270 (1 << 3)
+#endif
+
+#ifndef DRM_PLANE_TYPE_PRIMARY
+#define DRM_PLANE_TYPE_PRIMARY 1
+#endif
+
 typedef struct SDL_VideoData
 {
     int devindex;     /* device index that was passed on creation */
@@ -84,8 +95,19 @@ typedef struct SDL_DisplayData
     uint64_t cursor_w, cursor_h;
 
     SDL_bool default_cursor_init;
+
+    /* Panel orientation: 'rotation' is the DRM_MODE_ROTATE_* value that shows
+       the image upright on the panel. It's applied by the primary plane when
+       it has a "rotation" property supporting it, and by the dumb buffer
+       upload otherwise. */
+    uint64_t rotation;
+    uint32_t plane_id;
+    uint32_t rotation_prop_id;
+    SDL_bool plane_rotated;
 } SDL_DisplayData;
 
+#define KMSDRM_MAX_DUMB_DAMAGE 16
+
 typedef struct KMSDRM_DumbBuffer {
     struct drm_mode_destroy_dumb req_destroy_dumb;
     struct drm_mode_create_dumb req_create;
@@ -112,8 +134,15 @@ typedef struct SDL_WindowData
     KMSDRM_DumbBuffer dumb_buffers[2];
     int front_buffer;
     int back_buffer;
+    int dumb_rotation; /* Clockwise quarter turns applied on upload */
     SDL_Surface *framebuffer;
 
+    /* The back buffer is a frame behind, so it also needs the rects updated
+       in the front buffer by the last upload. -1 if it needs everything, and
+       -2 if both buffers do. */
+    SDL_Rect dumb_damage[KMSDRM_MAX_DUMB_DAMAGE];
+    int num_dumb_damage;
+
     SDL_bool waiting_for_flip;
     SDL_bool double_buffer;
 
@@ -133,6 +162,9 @@ KMSDRM_FBInfo *KMSDRM_FBFromBO(_THIS, struct gbm_bo *bo);
 KMSDRM_FBInfo *KMSDRM_FBFromBO2(_THIS, struct gbm_bo *bo, int w, int h);
 SDL_bool KMSDRM_WaitPageflip(_THIS, SDL_WindowData *windata);
 void KMSDRM_CreateCursorBO(SDL_VideoDisplay *display);
+void KMSDRM_GetModeSize(_THIS, SDL_DisplayData *dispdata, const drmModeModeInfo *mode, int *w, int *h);
+SDL_bool KMSDRM_SetPlaneRotation(_THIS, SDL_DisplayData *dispdata, uint64_t rotation);
+int KMSDRM_GetRotationAngle(uint64_t rotation);
 
 /****************************************************************************/
 /* SDL_VideoDevice functions declaration                                    */
@@ -38,6 +38,9 @@ my @dst_formats = (
     "RGB888",
     "BGR888",
     "ARGB8888",
+    "RGB565",
+    "ARGB2101010",
+    "RGB24",
 );
 
 my %format_size = (
@@ -47,6 +50,9 @@ my %format_size = (
     "RGBA8888" => 4,
     "ABGR8888" => 4,
     "BGRA8888" => 4,
+    "RGB565" => 2,
+    "ARGB2101010" => 4,
+    "RGB24" => 3,
 );
 
 my %format_type = (
@@ -56,6 +62,9 @@ my %format_type = (
     "RGBA8888" => "Uint32",
     "ABGR8888" => "Uint32",
     "BGRA8888" => "Uint32",
+    "RGB565" => "Uint16",
+    "ARGB2101010" => "Uint32",
+    "RGB24" => "Uint8",
 );
 
 my %get_rgba_string_ignore_alpha = (
@@ -65,6 +74,9 @@ my %get_rgba_string_ignore_alpha = (
     "RGBA8888" => "_R = (Uint8)(_pixel >> 24); _G = (Uint8)(_pixel >> 16); _B = (Uint8)(_pixel >> 8);",
     "ABGR8888" => "_B = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _R = (Uint8)_pixel;",
     "BGRA8888" => "_B = (Uint8)(_pixel >> 24); _G = (Uint8)(_pixel >> 16); _R = (Uint8)(_pixel >> 8);",
+    "RGB565" => "_R = SDL_expand_byte[3][_pixel >> 11]; _G = SDL_expand_byte[2][(_pixel >> 5) & 0x3F]; _B = SDL_expand_byte[3][_pixel & 0x1F];",
+    "ARGB2101010" => "_R = (Uint8)(_pixel >> 22); _G = (Uint8)(_pixel >> 12); _B = (Uint8)(_pixel >> 2);",
+    "RGB24" => "_R = dst[0]; _G = dst[1]; _B = dst[2];",
 );
 
 my %get_rgba_string = (
@@ -74,6 +86,9 @@ my %get_rgba_string = (
     "RGBA8888" => $get_rgba_string_ignore_alpha{"RGBA8888"} . " _A = (Uint8)_pixel;",
     "ABGR8888" => $get_rgba_string_ignore_alpha{"ABGR8888"} . " _A = (Uint8)(_pixel >> 24);",
     "BGRA8888" => $get_rgba_string_ignore_alpha{"BGRA8888"} . " _A = (Uint8)_pixel;",
+    "RGB565" => $get_rgba_string_ignore_alpha{"RGB565"},
+    "ARGB2101010" => $get_rgba_string_ignore_alpha{"ARGB2101010"} . " _A = SDL_expand_byte[6][_pixel >> 30];",
+    "RGB24" => $get_rgba_string_ignore_alpha{"RGB24"},
 );
 
 my %set_rgba_string = (
@@ -83,6 +98,64 @@ my %set_rgba_string = (
     "RGBA8888" => "_pixel = (_R << 24) | (_G << 16) | (_B << 8) | _A;",
     "ABGR8888" => "_pixel = (_A << 24) | (_B << 16) | (_G << 8) | _R;",
     "BGRA8888" => "_pixel = (_B << 24) | (_G << 16) | (_R << 8) | _A;",
+    "RGB565" => "_pixel = ((_R >> 3) << 11) | ((_G >> 2) << 5) | (_B >> 3);",
+    "ARGB2101010" => "_pixel = (((_A * 3) / 255) << 30) | ((_R ? ((_R << 2) | 0x3) : 0) << 20) | ((_G ? ((_G << 2) | 0x3) : 0) << 10) | (_B ? ((_B << 2) | 0x3) : 0);",
+    "RGB24" => "dst[0] = (Uint8)_R; dst[1] = (Uint8)_G; dst[2] = (Uint8)_B;",
+);
+
+# The shifts of the R, G, B and A channels of each format, -1 when there's no alpha
+my %format_shifts = (
+    "RGB888" => "16, 8, 0, -1",
+    "BGR888" => "0, 8, 16, -1",
+    "ARGB8888" => "16, 8, 0, 24",
+    "RGBA8888" => "24, 16, 8, 0",
+    "ABGR8888" => "0, 8, 16, 24",
+    "BGRA8888" => "8, 16, 24, 0",
+    "RGB565" => "11, 5, 0, -1",
+    "ARGB2101010" => "20, 10, 0, 30",
+    "RGB24" => "16, 8, 0, -1",
+);
+
+# How the vector blitters store each destination format
+my %format_layout = (
+    "RGB888" => "SDL_BLIT_DST_8888",
+    "BGR888" => "SDL_BLIT_DST_8888",
+    "ARGB8888" => "SDL_BLIT_DST_8888",
+    "RGB565" => "SDL_BLIT_DST_565",
+    "ARGB2101010" => "SDL_BLIT_DST_2101010",
+    "RGB24" => "SDL_BLIT_DST_24",
+);
+
+# The vector instruction sets we're creating blitters for, in order of preference
+my @simd_isas = (
+    "AVX2",
+    "SSE2",
+    "NEON",
+);
+
+my %simd_guard = (
+    "AVX2" => "HAVE_AVX2_INTRINSICS",
+    "SSE2" => "HAVE_SSE2_INTRINSICS",
+    "NEON" => "HAVE_NEON_INTRINSICS",
+);
+
+my %simd_cpu = (
+    "AVX2" => "SDL_CPU_AVX2",
+    "SSE2" => "SDL_CPU_SSE2",
+    "NEON" => "SDL_CPU_NEON",
+);
+
+my %simd_target = (
+    "AVX2" => "SDL_TARGET_AVX2\n",
+    "SSE2" => "",
+    "NEON" => "",
+);
+
+# The number of pixels the vector blitters work on at a time
+my %simd_block = (
+    "AVX2" => 16,
+    "SSE2" => 8,
+    "NEON" => 8,
 );
 
 sub open_file {
@@ -153,6 +226,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $isa = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -164,6 +238,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $isa ) {
+        print FILE "_$isa";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -183,8 +260,10 @@ sub get_rgba
         $string = $get_rgba_string{$format};
     }
 
-    $string =~ s/_/$prefix/g;
-    if ( $prefix ne "" ) {
+    $string =~ s/_(pixel|[RGBA])\b/$prefix$1/g;
+    if ( $format_size{$format} == 3 ) {
+        # The channels are read directly from the bytes
+    } elsif ( $prefix ne "" ) {
         print FILE <<__EOF__;
             ${prefix}pixel = *$prefix;
 __EOF__
@@ -203,11 +282,15 @@ sub set_rgba
     my $prefix = shift;
     my $format = shift;
     my $string = $set_rgba_string{$format};
-    $string =~ s/_/$prefix/g;
+    $string =~ s/_(pixel|[RGBA])\b/$prefix$1/g;
     print FILE <<__EOF__;
             $string
+__EOF__
+    if ( $format_size{$format} != 3 ) {
+        print FILE <<__EOF__;
             *dst = ${prefix}pixel;
 __EOF__
+    }
 }
 
 sub output_copycore
@@ -368,9 +451,15 @@ __EOF__
         print FILE <<__EOF__;
                 break;
             case SDL_COPY_ADD:
-                ${d}R = ${s}R + ${d}R; if (${d}R > 255) ${d}R = 255;
-                ${d}G = ${s}G + ${d}G; if (${d}G > 255) ${d}G = 255;
-                ${d}B = ${s}B + ${d}B; if (${d}B > 255) ${d}B = 255;
+                ${d}R = ${s}R + ${d}R; if (${d}R > 255) {
+                    ${d}R = 255;
+                }
+                ${d}G = ${s}G + ${d}G; if (${d}G > 255) {
+                    ${d}G = 255;
+                }
+                ${d}B = ${s}B + ${d}B; if (${d}B > 255) {
+                    ${d}B = 255;
+                }
                 break;
             case SDL_COPY_MOD:
                 ${d}R = (${s}R * ${d}R) / 255;
@@ -387,9 +476,15 @@ __EOF__
 __EOF__
         } else {
             print FILE <<__EOF__;
-                ${d}R = ((${s}R * ${d}R) + (${d}R * (255 - ${s}A))) / 255; if (${d}R > 255) ${d}R = 255;
-                ${d}G = ((${s}G * ${d}G) + (${d}G * (255 - ${s}A))) / 255; if (${d}G > 255) ${d}G = 255;
-                ${d}B = ((${s}B * ${d}B) + (${d}B * (255 - ${s}A))) / 255; if (${d}B > 255) ${d}B = 255;
+                ${d}R = ((${s}R * ${d}R) + (${d}R * (255 - ${s}A))) / 255; if (${d}R > 255) {
+                    ${d}R = 255;
+                }
+                ${d}G = ((${s}G * ${d}G) + (${d}G * (255 - ${s}A))) / 255; if (${d}G > 255) {
+                    ${d}G = 255;
+                }
+                ${d}B = ((${s}B * ${d}B) + (${d}B * (255 - ${s}A))) / 255; if (${d}B > 255) {
+                    ${d}B = 255;
+                }
 __EOF__
         }
         if ( $dst_has_alpha ) {
@@ -399,7 +494,9 @@ __EOF__
 __EOF__
             } else {
                 print FILE <<__EOF__;
-                ${d}A = ((${s}A * ${d}A) + (${d}A * (255 - ${s}A))) / 255; if (${d}A > 255) ${d}A = 255;
+                ${d}A = ((${s}A * ${d}A) + (${d}A * (255 - ${s}A))) / 255; if (${d}A > 255) {
+                    ${d}A = 255;
+                }
 __EOF__
             }
         }
@@ -431,6 +528,7 @@ sub output_copyfunc
 
     my $is_modulateA_done = 0;
     my $A_is_const_FF = 0;
+    my $dst_next = ($format_size{$dst} == 3) ? "dst += 3;" : "++dst;";
 
     my $sa = $src;
     my $da = $dst;
@@ -482,9 +580,11 @@ __EOF__
     Uint32 srcR, srcG, srcB, srcA;
 __EOF__
         }
-        print FILE <<__EOF__;
+        if ( $format_size{$dst} != 3 ) {
+            print FILE <<__EOF__;
     Uint32 dstpixel;
 __EOF__
+        }
         if ($dst_has_alpha) {
             print FILE <<__EOF__;
     Uint32 dstR, dstG, dstB, dstA;
@@ -556,7 +656,7 @@ __EOF__
         output_copycore($src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
         print FILE <<__EOF__;
             posx += incx;
-            ++dst;
+            $dst_next
         }
         posy += incy;
         info->dst += info->dst_pitch;
@@ -574,7 +674,7 @@ __EOF__
         output_copycore($src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
         print FILE <<__EOF__;
             ++src;
-            ++dst;
+            $dst_next
         }
         info->src += info->src_pitch;
         info->dst += info->dst_pitch;
@@ -587,6 +687,727 @@ __EOF__
 __EOF__
 }
 
+sub output_simdcore
+{
+    print FILE <<'__EOF__';
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#if defined(HAVE_SSE2_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+/* The vector blitters below do exactly what the C blitters do, a block of
+   pixels at a time, with the channels unpacked into 16-bit lanes.  They are
+   specialized for each format pair through the constant arguments of the
+   inlined SDL_Blit8888_*() functions. */
+
+/* How the destination pixels are stored.  24-bit pixels are unpacked to
+   RGB888 around the blocks. */
+#define SDL_BLIT_DST_8888    0
+#define SDL_BLIT_DST_565     1
+#define SDL_BLIT_DST_2101010 2
+#define SDL_BLIT_DST_24      3
+
+typedef struct
+{
+    int srcR, srcG, srcB, srcA; /* channel shifts, srcA is -1 without alpha */
+    int dstR, dstG, dstB, dstA; /* dstA is -1 without alpha */
+    int dst_layout;
+    int blend;
+    int modulate_color;
+    int modulate_alpha;
+    int premultiply;
+    int mode;
+    int opaque_mul;
+    Uint8 r, g, b, a;
+} SDL_Blit8888Params;
+
+SDL_FORCE_INLINE void SDL_Blit8888SetParams(SDL_Blit8888Params *p, const SDL_BlitInfo *info,
+                                            int srcR, int srcG, int srcB, int srcA,
+                                            int dstR, int dstG, int dstB, int dstA,
+                                            int dst_layout, int modulate, int blend)
+{
+    const int flags = info->flags;
+
+    p->srcR = srcR;
+    p->srcG = srcG;
+    p->srcB = srcB;
+    p->srcA = srcA;
+    p->dstR = dstR;
+    p->dstG = dstG;
+    p->dstB = dstB;
+    p->dstA = dstA;
+    p->dst_layout = dst_layout;
+    p->blend = blend;
+    p->modulate_color = modulate && (flags & SDL_COPY_MODULATE_COLOR);
+    p->modulate_alpha = modulate && (flags & SDL_COPY_MODULATE_ALPHA);
+    p->premultiply = blend && (flags & (SDL_COPY_BLEND | SDL_COPY_ADD));
+    p->mode = blend ? (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) : 0;
+    /* The C blitters write an opaque alpha for SDL_COPY_MUL when the source has no alpha to modulate */
+    p->opaque_mul = (srcA < 0 && !modulate);
+    p->r = info->r;
+    p->g = info->g;
+    p->b = info->b;
+    p->a = info->a;
+}
+#endif /* HAVE_SSE2_INTRINSICS || HAVE_NEON_INTRINSICS */
+
+#if defined(HAVE_SSE2_INTRINSICS)
+SDL_FORCE_INLINE __m128i SDL_BlitGetChannel_SSE2(__m128i lo, __m128i hi, int shift)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(lo, count), mask),
+                           _mm_and_si128(_mm_srl_epi32(hi, count), mask));
+}
+
+SDL_FORCE_INLINE __m128i SDL_BlitPutChannel_SSE2(__m128i c, int shift)
+{
+    return _mm_sll_epi32(c, _mm_cvtsi32_si128(shift));
+}
+
+/* x / 255, exact for any x <= 255 * 255 */
+SDL_FORCE_INLINE __m128i SDL_BlitDiv255_SSE2(__m128i x)
+{
+    x = _mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8));
+    return _mm_srli_epi16(x, 8);
+}
+
+SDL_FORCE_INLINE __m128i SDL_BlitMul255_SSE2(__m128i a, __m128i b)
+{
+    return SDL_BlitDiv255_SSE2(_mm_mullo_epi16(a, b));
+}
+
+/* min((a * b + c * d) / 255, 255) */
+SDL_FORCE_INLINE __m128i SDL_BlitMulAdd255_SSE2(__m128i a, __m128i b, __m128i c, __m128i d)
+{
+    const __m128i bias = _mm_set1_epi16(510);
+    __m128i x = _mm_adds_epu16(_mm_mullo_epi16(a, b), _mm_mullo_epi16(c, d));
+    x = _mm_subs_epu16(_mm_adds_epu16(x, bias), bias);
+    return SDL_BlitDiv255_SSE2(x);
+}
+
+/* The same values as SDL_expand_byte[3] and SDL_expand_byte[2] */
+SDL_FORCE_INLINE __m128i SDL_BlitExpand5_SSE2(__m128i x)
+{
+    return _mm_srli_epi16(_mm_mullo_epi16(x, _mm_set1_epi16(1053)), 7);
+}
+
+SDL_FORCE_INLINE __m128i SDL_BlitExpand6_SSE2(__m128i x)
+{
+    return _mm_add_epi16(_mm_slli_epi16(x, 2), _mm_srli_epi16(_mm_mullo_epi16(x, _mm_set1_epi16(49)), 10));
+}
+
+/* The 10-bit channels of ARGB2101010, as ARGB2101010_FROM_RGBA() does it */
+SDL_FORCE_INLINE __m128i SDL_BlitTo10_SSE2(__m128i x)
+{
+    const __m128i nonzero = _mm_cmpgt_epi16(x, _mm_setzero_si128());
+    return _mm_and_si128(_mm_or_si128(_mm_slli_epi16(x, 2), _mm_set1_epi16(0x3)), nonzero);
+}
+
+SDL_FORCE_INLINE void SDL_Blit8888Block_SSE2(const Uint32 *srcp, void *dstp, const SDL_Blit8888Params *p)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi16(255);
+    const __m128i s0 = _mm_loadu_si128((const __m128i *)srcp);
+    const __m128i s1 = _mm_loadu_si128((const __m128i *)srcp + 1);
+    __m128i sR, sG, sB, sA, dR, dG, dB, dA, inv, d0, d1;
+
+    sR = SDL_BlitGetChannel_SSE2(s0, s1, p->srcR);
+    sG = SDL_BlitGetChannel_SSE2(s0, s1, p->srcG);
+    sB = SDL_BlitGetChannel_SSE2(s0, s1, p->srcB);
+    sA = (p->srcA >= 0) ? SDL_BlitGetChannel_SSE2(s0, s1, p->srcA) : opaque;
+
+    if (p->modulate_color) {
+        sR = SDL_BlitMul255_SSE2(sR, _mm_set1_epi16(p->r));
+        sG = SDL_BlitMul255_SSE2(sG, _mm_set1_epi16(p->g));
+        sB = SDL_BlitMul255_SSE2(sB, _mm_set1_epi16(p->b));
+    }
+    if (p->modulate_alpha) {
+        sA = SDL_BlitMul255_SSE2(sA, _mm_set1_epi16(p->a));
+    }
+
+    if (p->blend) {
+        if (p->dst_layout == SDL_BLIT_DST_565) {
+            d0 = _mm_loadu_si128((const __m128i *)dstp);
+            dR = SDL_BlitExpand5_SSE2(_mm_srli_epi16(d0, 11));
+            dG = SDL_BlitExpand6_SSE2(_mm_and_si128(_mm_srli_epi16(d0, 5), _mm_set1_epi16(0x3F)));
+            dB = SDL_BlitExpand5_SSE2(_mm_and_si128(d0, _mm_set1_epi16(0x1F)));
+            dA = zero;
+        } else if (p->dst_layout == SDL_BLIT_DST_2101010) {
+            d0 = _mm_loadu_si128((const __m128i *)dstp);
+            d1 = _mm_loadu_si128((const __m128i *)dstp + 1);
+            dR = SDL_BlitGetChannel_SSE2(d0, d1, 22);
+            dG = SDL_BlitGetChannel_SSE2(d0, d1, 12);
+            dB = SDL_BlitGetChannel_SSE2(d0, d1, 2);
+            dA = _mm_mullo_epi16(SDL_BlitGetChannel_SSE2(d0, d1, 30), _mm_set1_epi16(85));
+        } else {
+            d0 = _mm_loadu_si128((const __m128i *)dstp);
+            d1 = _mm_loadu_si128((const __m128i *)dstp + 1);
+            dR = SDL_BlitGetChannel_SSE2(d0, d1, p->dstR);
+            dG = SDL_BlitGetChannel_SSE2(d0, d1, p->dstG);
+            dB = SDL_BlitGetChannel_SSE2(d0, d1, p->dstB);
+            dA = (p->dstA >= 0) ? SDL_BlitGetChannel_SSE2(d0, d1, p->dstA) : zero;
+        }
+
+        if (p->premultiply) {
+            sR = SDL_BlitMul255_SSE2(sR, sA);
+            sG = SDL_BlitMul255_SSE2(sG, sA);
+            sB = SDL_BlitMul255_SSE2(sB, sA);
+        }
+        inv = _mm_sub_epi16(opaque, sA);
+
+        switch (p->mode) {
+        case SDL_COPY_BLEND:
+            dR = _mm_add_epi16(sR, SDL_BlitMul255_SSE2(inv, dR));
+            dG = _mm_add_epi16(sG, SDL_BlitMul255_SSE2(inv, dG));
+            dB = _mm_add_epi16(sB, SDL_BlitMul255_SSE2(inv, dB));
+            dA = _mm_add_epi16(sA, SDL_BlitMul255_SSE2(inv, dA));
+            break;
+        case SDL_COPY_ADD:
+            dR = _mm_min_epi16(_mm_add_epi16(sR, dR), opaque);
+            dG = _mm_min_epi16(_mm_add_epi16(sG, dG), opaque);
+            dB = _mm_min_epi16(_mm_add_epi16(sB, dB), opaque);
+            break;
+        case SDL_COPY_MOD:
+            dR = SDL_BlitMul255_SSE2(sR, dR);
+            dG = SDL_BlitMul255_SSE2(sG, dG);
+            dB = SDL_BlitMul255_SSE2(sB, dB);
+            break;
+        case SDL_COPY_MUL:
+            dR = SDL_BlitMulAdd255_SSE2(sR, dR, dR, inv);
+            dG = SDL_BlitMulAdd255_SSE2(sG, dG, dG, inv);
+            dB = SDL_BlitMulAdd255_SSE2(sB, dB, dB, inv);
+            if (p->opaque_mul) {
+                dA = opaque;
+            }
+            break;
+        default:
+            break;
+        }
+    } else {
+        dR = sR;
+        dG = sG;
+        dB = sB;
+        dA = sA;
+    }
+
+    if (p->dst_layout == SDL_BLIT_DST_565) {
+        d0 = _mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(dR, 3), 11),
+                          _mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(dG, 2), 5), _mm_srli_epi16(dB, 3)));
+        _mm_storeu_si128((__m128i *)dstp, d0);
+        return;
+    }
+    if (p->dst_layout == SDL_BLIT_DST_2101010) {
+        dR = SDL_BlitTo10_SSE2(dR);
+        dG = SDL_BlitTo10_SSE2(dG);
+        dB = SDL_BlitTo10_SSE2(dB);
+        dA = SDL_BlitDiv255_SSE2(_mm_mullo_epi16(dA, _mm_set1_epi16(3)));
+    }
+
+    d0 = _mm_or_si128(SDL_BlitPutChannel_SSE2(_mm_unpacklo_epi16(dR, zero), p->dstR),
+                      _mm_or_si128(SDL_BlitPutChannel_SSE2(_mm_unpacklo_epi16(dG, zero), p->dstG),
+                                   SDL_BlitPutChannel_SSE2(_mm_unpacklo_epi16(dB, zero), p->dstB)));
+    d1 = _mm_or_si128(SDL_BlitPutChannel_SSE2(_mm_unpackhi_epi16(dR, zero), p->dstR),
+                      _mm_or_si128(SDL_BlitPutChannel_SSE2(_mm_unpackhi_epi16(dG, zero), p->dstG),
+                                   SDL_BlitPutChannel_SSE2(_mm_unpackhi_epi16(dB, zero), p->dstB)));
+    if (p->dstA >= 0) {
+        d0 = _mm_or_si128(d0, SDL_BlitPutChannel_SSE2(_mm_unpacklo_epi16(dA, zero), p->dstA));
+        d1 = _mm_or_si128(d1, SDL_BlitPutChannel_SSE2(_mm_unpackhi_epi16(dA, zero), p->dstA));
+    }
+    _mm_storeu_si128((__m128i *)dstp, d0);
+    _mm_storeu_si128((__m128i *)dstp + 1, d1);
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if defined(HAVE_AVX2_INTRINSICS)
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i SDL_BlitGetChannel_AVX2(__m256i lo, __m256i hi, int shift)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    return _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(lo, count), mask),
+                              _mm256_and_si256(_mm256_srl_epi32(hi, count), mask));
+}
+
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i SDL_BlitPutChannel_AVX2(__m256i c, int shift)
+{
+    return _mm256_sll_epi32(c, _mm_cvtsi32_si128(shift));
+}
+
+/* x / 255, exact for any x <= 255 * 255 */
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i SDL_BlitDiv255_AVX2(__m256i x)
+{
+    x = _mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_srli_epi16(x, 8));
+    return _mm256_srli_epi16(x, 8);
+}
+
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i SDL_BlitMul255_AVX2(__m256i a, __m256i b)
+{
+    return SDL_BlitDiv255_AVX2(_mm256_mullo_epi16(a, b));
+}
+
+/* min((a * b + c * d) / 255, 255) */
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i SDL_BlitMulAdd255_AVX2(__m256i a, __m256i b, __m256i c, __m256i d)
+{
+    const __m256i bias = _mm256_set1_epi16(510);
+    __m256i x = _mm256_adds_epu16(_mm256_mullo_epi16(a, b), _mm256_mullo_epi16(c, d));
+    x = _mm256_subs_epu16(_mm256_adds_epu16(x, bias), bias);
+    return SDL_BlitDiv255_AVX2(x);
+}
+
+/* The same values as SDL_expand_byte[3] and SDL_expand_byte[2] */
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i SDL_BlitExpand5_AVX2(__m256i x)
+{
+    return _mm256_srli_epi16(_mm256_mullo_epi16(x, _mm256_set1_epi16(1053)), 7);
+}
+
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i SDL_BlitExpand6_AVX2(__m256i x)
+{
+    return _mm256_add_epi16(_mm256_slli_epi16(x, 2), _mm256_srli_epi16(_mm256_mullo_epi16(x, _mm256_set1_epi16(49)), 10));
+}
+
+/* The 10-bit channels of ARGB2101010, as ARGB2101010_FROM_RGBA() does it */
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE __m256i SDL_BlitTo10_AVX2(__m256i x)
+{
+    const __m256i nonzero = _mm256_cmpgt_epi16(x, _mm256_setzero_si256());
+    return _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi16(x, 2), _mm256_set1_epi16(0x3)), nonzero);
+}
+
+/* The channels unpacked from 32-bit pixels are ordered 0-3, 8-11, 4-7, 12-15
+   in the 16-bit lanes, 16-bit pixels are swapped to that order and back. */
+SDL_TARGET_AVX2
+SDL_FORCE_INLINE void SDL_Blit8888Block_AVX2(const Uint32 *srcp, void *dstp, const SDL_Blit8888Params *p)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i opaque = _mm256_set1_epi16(255);
+    const __m256i s0 = _mm256_loadu_si256((const __m256i *)srcp);
+    const __m256i s1 = _mm256_loadu_si256((const __m256i *)srcp + 1);
+    __m256i sR, sG, sB, sA, dR, dG, dB, dA, inv, d0, d1;
+
+    sR = SDL_BlitGetChannel_AVX2(s0, s1, p->srcR);
+    sG = SDL_BlitGetChannel_AVX2(s0, s1, p->srcG);
+    sB = SDL_BlitGetChannel_AVX2(s0, s1, p->srcB);
+    sA = (p->srcA >= 0) ? SDL_BlitGetChannel_AVX2(s0, s1, p->srcA) : opaque;
+
+    if (p->modulate_color) {
+        sR = SDL_BlitMul255_AVX2(sR, _mm256_set1_epi16(p->r));
+        sG = SDL_BlitMul255_AVX2(sG, _mm256_set1_epi16(p->g));
+        sB = SDL_BlitMul255_AVX2(sB, _mm256_set1_epi16(p->b));
+    }
+    if (p->modulate_alpha) {
+        sA = SDL_BlitMul255_AVX2(sA, _mm256_set1_epi16(p->a));
+    }
+
+    if (p->blend) {
+        if (p->dst_layout == SDL_BLIT_DST_565) {
+            d0 = _mm256_loadu_si256((const __m256i *)dstp);
+            d0 = _mm256_permute4x64_epi64(d0, _MM_SHUFFLE(3, 1, 2, 0));
+            dR = SDL_BlitExpand5_AVX2(_mm256_srli_epi16(d0, 11));
+            dG = SDL_BlitExpand6_AVX2(_mm256_and_si256(_mm256_srli_epi16(d0, 5), _mm256_set1_epi16(0x3F)));
+            dB = SDL_BlitExpand5_AVX2(_mm256_and_si256(d0, _mm256_set1_epi16(0x1F)));
+            dA = zero;
+        } else if (p->dst_layout == SDL_BLIT_DST_2101010) {
+            d0 = _mm256_loadu_si256((const __m256i *)dstp);
+            d1 = _mm256_loadu_si256((const __m256i *)dstp + 1);
+            dR = SDL_BlitGetChannel_AVX2(d0, d1, 22);
+            dG = SDL_BlitGetChannel_AVX2(d0, d1, 12);
+            dB = SDL_BlitGetChannel_AVX2(d0, d1, 2);
+            dA = _mm256_mullo_epi16(SDL_BlitGetChannel_AVX2(d0, d1, 30), _mm256_set1_epi16(85));
+        } else {
+            d0 = _mm256_loadu_si256((const __m256i *)dstp);
+            d1 = _mm256_loadu_si256((const __m256i *)dstp + 1);
+            dR = SDL_BlitGetChannel_AVX2(d0, d1, p->dstR);
+            dG = SDL_BlitGetChannel_AVX2(d0, d1, p->dstG);
+            dB = SDL_BlitGetChannel_AVX2(d0, d1, p->dstB);
+            dA = (p->dstA >= 0) ? SDL_BlitGetChannel_AVX2(d0, d1, p->dstA) : zero;
+        }
+
+        if (p->premultiply) {
+            sR = SDL_BlitMul255_AVX2(sR, sA);
+            sG = SDL_BlitMul255_AVX2(sG, sA);
+            sB = SDL_BlitMul255_AVX2(sB, sA);
+        }
+        inv = _mm256_sub_epi16(opaque, sA);
+
+        switch (p->mode) {
+        case SDL_COPY_BLEND:
+            dR = _mm256_add_epi16(sR, SDL_BlitMul255_AVX2(inv, dR));
+            dG = _mm256_add_epi16(sG, SDL_BlitMul255_AVX2(inv, dG));
+            dB = _mm256_add_epi16(sB, SDL_BlitMul255_AVX2(inv, dB));
+            dA = _mm256_add_epi16(sA, SDL_BlitMul255_AVX2(inv, dA));
+            break;
+        case SDL_COPY_ADD:
+            dR = _mm256_min_epi16(_mm256_add_epi16(sR, dR), opaque);
+            dG = _mm256_min_epi16(_mm256_add_epi16(sG, dG), opaque);
+            dB = _mm256_min_epi16(_mm256_add_epi16(sB, dB), opaque);
+            break;
+        case SDL_COPY_MOD:
+            dR = SDL_BlitMul255_AVX2(sR, dR);
+            dG = SDL_BlitMul255_AVX2(sG, dG);
+            dB = SDL_BlitMul255_AVX2(sB, dB);
+            break;
+        case SDL_COPY_MUL:
+            dR = SDL_BlitMulAdd255_AVX2(sR, dR, dR, inv);
+            dG = SDL_BlitMulAdd255_AVX2(sG, dG, dG, inv);
+            dB = SDL_BlitMulAdd255_AVX2(sB, dB, dB, inv);
+            if (p->opaque_mul) {
+                dA = opaque;
+            }
+            break;
+        default:
+            break;
+        }
+    } else {
+        dR = sR;
+        dG = sG;
+        dB = sB;
+        dA = sA;
+    }
+
+    if (p->dst_layout == SDL_BLIT_DST_565) {
+        d0 = _mm256_or_si256(_mm256_slli_epi16(_mm256_srli_epi16(dR, 3), 11),
+                             _mm256_or_si256(_mm256_slli_epi16(_mm256_srli_epi16(dG, 2), 5), _mm256_srli_epi16(dB, 3)));
+        d0 = _mm256_permute4x64_epi64(d0, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256((__m256i *)dstp, d0);
+        return;
+    }
+    if (p->dst_layout == SDL_BLIT_DST_2101010) {
+        dR = SDL_BlitTo10_AVX2(dR);
+        dG = SDL_BlitTo10_AVX2(dG);
+        dB = SDL_BlitTo10_AVX2(dB);
+        dA = SDL_BlitDiv255_AVX2(_mm256_mullo_epi16(dA, _mm256_set1_epi16(3)));
+    }
+
+    d0 = _mm256_or_si256(SDL_BlitPutChannel_AVX2(_mm256_unpacklo_epi16(dR, zero), p->dstR),
+                         _mm256_or_si256(SDL_BlitPutChannel_AVX2(_mm256_unpacklo_epi16(dG, zero), p->dstG),
+                                         SDL_BlitPutChannel_AVX2(_mm256_unpacklo_epi16(dB, zero), p->dstB)));
+    d1 = _mm256_or_si256(SDL_BlitPutChannel_AVX2(_mm256_unpackhi_epi16(dR, zero), p->dstR),
+                         _mm256_or_si256(SDL_BlitPutChannel_AVX2(_mm256_unpackhi_epi16(dG, zero), p->dstG),
+                                         SDL_BlitPutChannel_AVX2(_mm256_unpackhi_epi16(dB, zero), p->dstB)));
+    if (p->dstA >= 0) {
+        d0 = _mm256_or_si256(d0, SDL_BlitPutChannel_AVX2(_mm256_unpacklo_epi16(dA, zero), p->dstA));
+        d1 = _mm256_or_si256(d1, SDL_BlitPutChannel_AVX2(_mm256_unpackhi_epi16(dA, zero), p->dstA));
+    }
+    _mm256_storeu_si256((__m256i *)dstp, d0);
+    _mm256_storeu_si256((__m256i *)dstp + 1, d1);
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if defined(HAVE_NEON_INTRINSICS)
+/* x / 255, exact for any x <= 255 * 255 */
+SDL_FORCE_INLINE uint16x8_t SDL_BlitDiv255_NEON(uint16x8_t x)
+{
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE uint16x8_t SDL_BlitMul255_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return SDL_BlitDiv255_NEON(vmulq_u16(a, b));
+}
+
+/* min((a * b + c * d) / 255, 255) */
+SDL_FORCE_INLINE uint16x8_t SDL_BlitMulAdd255_NEON(uint16x8_t a, uint16x8_t b, uint16x8_t c, uint16x8_t d)
+{
+    uint16x8_t x = vqaddq_u16(vmulq_u16(a, b), vmulq_u16(c, d));
+    return SDL_BlitDiv255_NEON(vminq_u16(x, vdupq_n_u16(255 * 255)));
+}
+
+/* The same values as SDL_expand_byte[3] and SDL_expand_byte[2] */
+SDL_FORCE_INLINE uint16x8_t SDL_BlitExpand5_NEON(uint16x8_t x)
+{
+    return vshrq_n_u16(vmulq_n_u16(x, 1053), 7);
+}
+
+SDL_FORCE_INLINE uint16x8_t SDL_BlitExpand6_NEON(uint16x8_t x)
+{
+    return vaddq_u16(vshlq_n_u16(x, 2), vshrq_n_u16(vmulq_n_u16(x, 49), 10));
+}
+
+/* The 10-bit channels of ARGB2101010, as ARGB2101010_FROM_RGBA() does it */
+SDL_FORCE_INLINE uint16x8_t SDL_BlitTo10_NEON(uint16x8_t x)
+{
+    return vandq_u16(vorrq_u16(vshlq_n_u16(x, 2), vdupq_n_u16(0x3)), vtstq_u16(x, x));
+}
+
+/* 8 bits at 'shift' of 8 ARGB2101010 pixels */
+#define SDL_BlitGetChannel2101010_NEON(lo, hi, shift) \
+    vandq_u16(vcombine_u16(vmovn_u32(vshrq_n_u32(lo, shift)), vmovn_u32(vshrq_n_u32(hi, shift))), vdupq_n_u16(0xFF))
+
+/* On little endian a channel at bit 'shift' is byte 'shift / 8' of the pixel */
+SDL_FORCE_INLINE void SDL_Blit8888Block_NEON(const Uint32 *srcp, void *dstp, const SDL_Blit8888Params *p)
+{
+    const uint16x8_t opaque = vdupq_n_u16(255);
+    const uint8x8x4_t s = vld4_u8((const Uint8 *)srcp);
+    uint8x8x4_t d;
+    uint32x4_t d0, d1;
+    uint16x8_t sR, sG, sB, sA, dR, dG, dB, dA, inv;
+
+    sR = vmovl_u8(s.val[p->srcR / 8]);
+    sG = vmovl_u8(s.val[p->srcG / 8]);
+    sB = vmovl_u8(s.val[p->srcB / 8]);
+    sA = (p->srcA >= 0) ? vmovl_u8(s.val[p->srcA / 8]) : opaque;
+
+    if (p->modulate_color) {
+        sR = SDL_BlitMul255_NEON(sR, vdupq_n_u16(p->r));
+        sG = SDL_BlitMul255_NEON(sG, vdupq_n_u16(p->g));
+        sB = SDL_BlitMul255_NEON(sB, vdupq_n_u16(p->b));
+    }
+    if (p->modulate_alpha) {
+        sA = SDL_BlitMul255_NEON(sA, vdupq_n_u16(p->a));
+    }
+
+    if (p->blend) {
+        if (p->dst_layout == SDL_BLIT_DST_565) {
+            const uint16x8_t d565 = vld1q_u16((const Uint16 *)dstp);
+            dR = SDL_BlitExpand5_NEON(vshrq_n_u16(d565, 11));
+            dG = SDL_BlitExpand6_NEON(vandq_u16(vshrq_n_u16(d565, 5), vdupq_n_u16(0x3F)));
+            dB = SDL_BlitExpand5_NEON(vandq_u16(d565, vdupq_n_u16(0x1F)));
+            dA = vdupq_n_u16(0);
+        } else if (p->dst_layout == SDL_BLIT_DST_2101010) {
+            d0 = vld1q_u32((const Uint32 *)dstp);
+            d1 = vld1q_u32((const Uint32 *)dstp + 4);
+            dR = SDL_BlitGetChannel2101010_NEON(d0, d1, 22);
+            dG = SDL_BlitGetChannel2101010_NEON(d0, d1, 12);
+            dB = SDL_BlitGetChannel2101010_NEON(d0, d1, 2);
+            dA = vmulq_n_u16(SDL_BlitGetChannel2101010_NEON(d0, d1, 30), 85);
+        } else {
+            d = vld4_u8((const Uint8 *)dstp);
+            dR = vmovl_u8(d.val[p->dstR / 8]);
+            dG = vmovl_u8(d.val[p->dstG / 8]);
+            dB = vmovl_u8(d.val[p->dstB / 8]);
+            dA = (p->dstA >= 0) ? vmovl_u8(d.val[p->dstA / 8]) : vdupq_n_u16(0);
+        }
+
+        if (p->premultiply) {
+            sR = SDL_BlitMul255_NEON(sR, sA);
+            sG = SDL_BlitMul255_NEON(sG, sA);
+            sB = SDL_BlitMul255_NEON(sB, sA);
+        }
+        inv = vsubq_u16(opaque, sA);
+
+        switch (p->mode) {
+        case SDL_COPY_BLEND:
+            dR = vaddq_u16(sR, SDL_BlitMul255_NEON(inv, dR));
+            dG = vaddq_u16(sG, SDL_BlitMul255_NEON(inv, dG));
+            dB = vaddq_u16(sB, SDL_BlitMul255_NEON(inv, dB));
+            dA = vaddq_u16(sA, SDL_BlitMul255_NEON(inv, dA));
+            break;
+        case SDL_COPY_ADD:
+            dR = vminq_u16(vaddq_u16(sR, dR), opaque);
+            dG = vminq_u16(vaddq_u16(sG, dG), opaque);
+            dB = vminq_u16(vaddq_u16(sB, dB), opaque);
+            break;
+        case SDL_COPY_MOD:
+            dR = SDL_BlitMul255_NEON(sR, dR);
+            dG = SDL_BlitMul255_NEON(sG, dG);
+            dB = SDL_BlitMul255_NEON(sB, dB);
+            break;
+        case SDL_COPY_MUL:
+            dR = SDL_BlitMulAdd255_NEON(sR, dR, dR, inv);
+            dG = SDL_BlitMulAdd255_NEON(sG, dG, dG, inv);
+            dB = SDL_BlitMulAdd255_NEON(sB, dB, dB, inv);
+            if (p->opaque_mul) {
+                dA = opaque;
+            }
+            break;
+        default:
+            break;
+        }
+    } else {
+        dR = sR;
+        dG = sG;
+        dB = sB;
+        dA = sA;
+    }
+
+    if (p->dst_layout == SDL_BLIT_DST_565) {
+        const uint16x8_t d565 = vorrq_u16(vshlq_n_u16(vshrq_n_u16(dR, 3), 11),
+                                          vorrq_u16(vshlq_n_u16(vshrq_n_u16(dG, 2), 5), vshrq_n_u16(dB, 3)));
+        vst1q_u16((Uint16 *)dstp, d565);
+        return;
+    }
+    if (p->dst_layout == SDL_BLIT_DST_2101010) {
+        dR = SDL_BlitTo10_NEON(dR);
+        dG = SDL_BlitTo10_NEON(dG);
+        dB = SDL_BlitTo10_NEON(dB);
+        dA = SDL_BlitDiv255_NEON(vmulq_n_u16(dA, 3));
+        d0 = vorrq_u32(vorrq_u32(vshlq_n_u32(vmovl_u16(vget_low_u16(dA)), 30), vshlq_n_u32(vmovl_u16(vget_low_u16(dR)), 20)),
+                       vorrq_u32(vshlq_n_u32(vmovl_u16(vget_low_u16(dG)), 10), vmovl_u16(vget_low_u16(dB))));
+        d1 = vorrq_u32(vorrq_u32(vshlq_n_u32(vmovl_u16(vget_high_u16(dA)), 30), vshlq_n_u32(vmovl_u16(vget_high_u16(dR)), 20)),
+                       vorrq_u32(vshlq_n_u32(vmovl_u16(vget_high_u16(dG)), 10), vmovl_u16(vget_high_u16(dB))));
+        vst1q_u32((Uint32 *)dstp, d0);
+        vst1q_u32((Uint32 *)dstp + 4, d1);
+        return;
+    }
+
+    d.val[0] = d.val[1] = d.val[2] = d.val[3] = vdup_n_u8(0);
+    d.val[p->dstR / 8] = vmovn_u16(dR);
+    d.val[p->dstG / 8] = vmovn_u16(dG);
+    d.val[p->dstB / 8] = vmovn_u16(dB);
+    if (p->dstA >= 0) {
+        d.val[p->dstA / 8] = vmovn_u16(dA);
+    }
+    vst4_u8((Uint8 *)dstp, d);
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+__EOF__
+    for (my $i = 0; $i <= $#simd_isas; ++$i) {
+        my $isa = $simd_isas[$i];
+        my $guard = $simd_guard{$isa};
+        my $target = $simd_target{$isa};
+        my $block = $simd_block{$isa};
+        print FILE <<__EOF__;
+#if defined($guard)
+${target}SDL_FORCE_INLINE void SDL_Blit8888_${isa}(SDL_BlitInfo *info,
+                                        int srcR, int srcG, int srcB, int srcA,
+                                        int dstR, int dstG, int dstB, int dstA,
+                                        int dst_layout, int modulate, int blend, int scale, int copy)
+{
+    SDL_Blit8888Params p;
+    Uint32 srcbuf[${block}], dstbuf[${block}];
+    const int dstbpp = (dst_layout == SDL_BLIT_DST_565) ? 2 : (dst_layout == SDL_BLIT_DST_24) ? 3 : 4;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int height = info->dst_h;
+    int incy = 0, incx = 0;
+    Uint32 posy = 0, posx = 0;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_Blit8888SetParams(&p, info, srcR, srcG, srcB, srcA, dstR, dstG, dstB, dstA, dst_layout, modulate, blend);
+
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+        posy = incy / 2;
+    }
+
+    while (height--) {
+        const Uint32 *srcp = (const Uint32 *)src;
+        Uint8 *dstp = dst;
+        int n = info->dst_w;
+
+        if (scale) {
+            srcp = (const Uint32 *)(info->src + (posy >> 16) * info->src_pitch);
+            posx = incx / 2;
+        }
+        while (n > 0) {
+            const int count = SDL_min(n, ${block});
+            const Uint32 *s = srcp;
+            void *d = dstp;
+            int i;
+
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = srcp[posx >> 16];
+                    posx += incx;
+                }
+                s = srcbuf;
+                if (copy) {
+                    SDL_memcpy(dstp, srcbuf, count * sizeof(Uint32));
+                    dstp += count * dstbpp;
+                    n -= count;
+                    continue;
+                }
+            } else if (count < ${block}) {
+                SDL_memcpy(srcbuf, srcp, count * sizeof(Uint32));
+                s = srcbuf;
+            }
+            if (dst_layout == SDL_BLIT_DST_24) {
+                if (blend) {
+                    for (i = 0; i < count; ++i) {
+                        dstbuf[i] = ((Uint32)dstp[i * 3] << 16) | ((Uint32)dstp[i * 3 + 1] << 8) | dstp[i * 3 + 2];
+                    }
+                }
+                d = dstbuf;
+            } else if (count < ${block}) {
+                if (blend) {
+                    SDL_memcpy(dstbuf, dstp, count * dstbpp);
+                }
+                d = dstbuf;
+            }
+
+            SDL_Blit8888Block_${isa}(s, d, &p);
+
+            if (dst_layout == SDL_BLIT_DST_24) {
+                for (i = 0; i < count; ++i) {
+                    dstp[i * 3] = (Uint8)(dstbuf[i] >> 16);
+                    dstp[i * 3 + 1] = (Uint8)(dstbuf[i] >> 8);
+                    dstp[i * 3 + 2] = (Uint8)dstbuf[i];
+                }
+            } else if (d != dstp) {
+                SDL_memcpy(dstp, dstbuf, count * dstbpp);
+            }
+            if (!scale) {
+                srcp += count;
+            }
+            dstp += count * dstbpp;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            src += info->src_pitch;
+        }
+        dst += info->dst_pitch;
+    }
+}
+#endif /* $guard */
+
+__EOF__
+    }
+}
+
+sub output_simdfunc
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $copy = ($src eq $dst && !$modulate && !$blend) ? 1 : 0;
+
+    print FILE $simd_target{$isa};
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n", $isa);
+    print FILE <<__EOF__;
+{
+    SDL_Blit8888_${isa}(info, $format_shifts{$src}, $format_shifts{$dst}, $format_layout{$dst}, $modulate, $blend, $scale, $copy);
+}
+
+__EOF__
+}
+
+sub output_simdfuncs
+{
+    for (my $k = 0; $k <= $#simd_isas; ++$k) {
+        my $isa = $simd_isas[$k];
+        print FILE "#if defined($simd_guard{$isa})\n\n";
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                    for (my $blend = 0; $blend <= 1; ++$blend) {
+                        for (my $scale = 0; $scale <= 1; ++$scale) {
+                            if ( $modulate || $blend || $scale ) {
+                                output_simdfunc($isa, $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        print FILE "#endif /* $simd_guard{$isa} */\n\n";
+    }
+}
+
 sub output_copyfunc_h
 {
 }
@@ -601,11 +1422,11 @@ sub output_copyinc
 __EOF__
 }
 
-sub output_copyfunctable
+sub output_copyfunctable_entries
 {
-    print FILE <<__EOF__;
-SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
-__EOF__
+    my $cpu = shift;
+    my $isa = shift;
+
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -644,14 +1465,29 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            print FILE "($flags), $cpu,";
+                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n", $isa);
                         }
                     }
                 }
             }
         }
     }
+}
+
+sub output_copyfunctable
+{
+    print FILE <<__EOF__;
+SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+__EOF__
+    # The vector blitters come first, so they're preferred when the CPU supports them
+    for (my $k = 0; $k <= $#simd_isas; ++$k) {
+        my $isa = $simd_isas[$k];
+        print FILE "#if defined($simd_guard{$isa})\n";
+        output_copyfunctable_entries($simd_cpu{$isa}, $isa);
+        print FILE "#endif\n";
+    }
+    output_copyfunctable_entries("SDL_CPU_ANY", "");
     print FILE <<__EOF__;
     { 0, 0, 0, 0, NULL }
 };
@@ -692,5 +1528,7 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdcore();
+output_simdfuncs();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
@@ -99,6 +99,7 @@ static SDL_Cursor *WIN_CreateCursor(SDL_Surface *surface, int hot_x, int hot_y)
     size_t maskbitslen;
     SDL_bool isstack;
     ICONINFO ii;
+    int y;
 
     SDL_zero(bmh);
     bmh.bV4Size = sizeof(bmh);
@@ -133,8 +134,9 @@ static SDL_Cursor *WIN_CreateCursor(SDL_Surface *surface, int hot_x, int hot_y)
     SDL_small_free(maskbits, isstack);
 
     SDL_assert(surface->format->format == SDL_PIXELFORMAT_ARGB8888);
-    SDL_assert(surface->pitch == surface->w * 4);
-    SDL_memcpy(pixels, surface->pixels, (size_t)surface->h * surface->pitch);
+    for (y = 0; y < surface->h; ++y) {
+        SDL_memcpy((Uint8 *)pixels + y * surface->w * 4, (Uint8 *)surface->pixels + y * surface->pitch, (size_t)surface->w * 4);
+    }
 
     hicon = CreateIconIndirect(&ii);
 
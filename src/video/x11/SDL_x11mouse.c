@@ -86,6 +86,7 @@ static Cursor X11_CreateXCursorCursor(SDL_Surface *surface, int hot_x, int hot_y
     Display *display = GetDisplay();
     Cursor cursor = None;
     XcursorImage *image;
+    int y;
 
     image = X11_XcursorImageCreate(surface->w, surface->h);
     if (image == NULL) {
@@ -97,8 +98,9 @@ static Cursor X11_CreateXCursorCursor(SDL_Surface *surface, int hot_x, int hot_y
     image->delay = 0;
 
     SDL_assert(surface->format->format == SDL_PIXELFORMAT_ARGB8888);
-    SDL_assert(surface->pitch == surface->w * 4);
-    SDL_memcpy(image->pixels, surface->pixels, (size_t)surface->h * surface->pitch);
+    for (y = 0; y < surface->h; ++y) {
+        SDL_memcpy((Uint8 *)image->pixels + y * surface->w * 4, (Uint8 *)surface->pixels + y * surface->pitch, (size_t)surface->w * 4);
+    }
 
     cursor = X11_XcursorImageLoadCursor(display, image);
 
@@ -0,0 +1,285 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	NEON_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* The arithmetic is the same as in the SSE version: 16 bit products that
+ * wrap, an arithmetic shift by PRECISION and unsigned saturation, so both
+ * give identical results.
+ * All loads read exactly the bytes of the 16 pixels being converted, so
+ * unlike the SSE version no column or line needs a fixup at the end of the
+ * buffer.
+ */
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_UV \
+	u = vld1_u8(u_ptr); \
+	v = vld1_u8(v_ptr); \
+
+#define READ_Y(y_ptr) \
+	y = vld1q_u8(y_ptr); \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+/* u_ptr and v_ptr point into the same interleaved plane */
+#define READ_UV \
+{ \
+	const uint8x8x2_t uv = vld2_u8(uv_first ? u_ptr : v_ptr); \
+	u = uv.val[uv_first ? 0 : 1]; \
+	v = uv.val[uv_first ? 1 : 0]; \
+}
+
+#define READ_Y(y_ptr) \
+	y = vld1q_u8(y_ptr); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+/* Y, U and V are interleaved, load 8 macropixels from the first byte and
+   pick the planes by their offset from it */
+#define READ_UV \
+{ \
+	const uint8x8x4_t yuyv = vld4_u8(packed_ptr); \
+	const uint8x8x2_t y_even_odd = vzip_u8(yuyv.val[y_index], yuyv.val[y_index + 2]); \
+	y = vcombine_u8(y_even_odd.val[0], y_even_odd.val[1]); \
+	u = yuyv.val[u_index]; \
+	v = yuyv.val[v_index]; \
+}
+
+#define READ_Y(y_ptr)
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define UV2RGB_16(U, V, R1, G1, B1, R2, G2, B2) \
+{ \
+	const int16x8_t r_tmp = vmulq_s16(V, v_r_factor); \
+	const int16x8_t g_tmp = vaddq_s16(vmulq_s16(U, u_g_factor), vmulq_s16(V, v_g_factor)); \
+	const int16x8_t b_tmp = vmulq_s16(U, u_b_factor); \
+	const int16x8x2_t r_zip = vzipq_s16(r_tmp, r_tmp); \
+	const int16x8x2_t g_zip = vzipq_s16(g_tmp, g_tmp); \
+	const int16x8x2_t b_zip = vzipq_s16(b_tmp, b_tmp); \
+	R1 = r_zip.val[0]; \
+	G1 = g_zip.val[0]; \
+	B1 = b_zip.val[0]; \
+	R2 = r_zip.val[1]; \
+	G2 = g_zip.val[1]; \
+	B2 = b_zip.val[1]; \
+}
+
+#define Y2RGB_16(Y, R, G, B) \
+{ \
+	const int16x8_t y_lo = vmulq_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(Y))), y_shift), y_factor); \
+	const int16x8_t y_hi = vmulq_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(Y))), y_shift), y_factor); \
+	R = vcombine_u8(vqshrun_n_s16(vaddq_s16(r_uv_1, y_lo), PRECISION), vqshrun_n_s16(vaddq_s16(r_uv_2, y_hi), PRECISION)); \
+	G = vcombine_u8(vqshrun_n_s16(vaddq_s16(g_uv_1, y_lo), PRECISION), vqshrun_n_s16(vaddq_s16(g_uv_2, y_hi), PRECISION)); \
+	B = vcombine_u8(vqshrun_n_s16(vaddq_s16(b_uv_1, y_lo), PRECISION), vqshrun_n_s16(vaddq_s16(b_uv_2, y_hi), PRECISION)); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define SAVE_PIXELS(rgb_ptr, R, G, B) \
+{ \
+	uint16x8_t rgb_lo = vshll_n_u8(vget_low_u8(R), 8); \
+	uint16x8_t rgb_hi = vshll_n_u8(vget_high_u8(R), 8); \
+	rgb_lo = vsriq_n_u16(rgb_lo, vshll_n_u8(vget_low_u8(G), 8), 5); \
+	rgb_hi = vsriq_n_u16(rgb_hi, vshll_n_u8(vget_high_u8(G), 8), 5); \
+	rgb_lo = vsriq_n_u16(rgb_lo, vshll_n_u8(vget_low_u8(B), 8), 11); \
+	rgb_hi = vsriq_n_u16(rgb_hi, vshll_n_u8(vget_high_u8(B), 8), 11); \
+	vst1q_u8(rgb_ptr, vreinterpretq_u8_u16(rgb_lo)); \
+	vst1q_u8(rgb_ptr + 16, vreinterpretq_u8_u16(rgb_hi)); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define SAVE_PIXELS(rgb_ptr, R, G, B) \
+{ \
+	uint8x16x3_t rgb; \
+	rgb.val[0] = R; \
+	rgb.val[1] = G; \
+	rgb.val[2] = B; \
+	vst3q_u8(rgb_ptr, rgb); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+
+/* Byte order in memory of the 32 bit formats, as the SSE version writes them */
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define RGBA_BYTES(R, G, B, A) A, B, G, R
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define RGBA_BYTES(R, G, B, A) A, R, G, B
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define RGBA_BYTES(R, G, B, A) B, G, R, A
+#else
+#define RGBA_BYTES(R, G, B, A) R, G, B, A
+#endif
+
+#define SAVE_RGBA(rgb_ptr, C0, C1, C2, C3) \
+{ \
+	uint8x16x4_t rgb; \
+	rgb.val[0] = C0; \
+	rgb.val[1] = C1; \
+	rgb.val[2] = C2; \
+	rgb.val[3] = C3; \
+	vst4q_u8(rgb_ptr, rgb); \
+}
+
+#define SAVE_PIXELS_(rgb_ptr, BYTES) SAVE_RGBA(rgb_ptr, BYTES)
+#define SAVE_PIXELS(rgb_ptr, R, G, B) SAVE_PIXELS_(rgb_ptr, RGBA_BYTES(R, G, B, alpha))
+
+#else
+#error SAVE_PIXELS unimplemented
+#endif
+
+#define YUV2RGB_16 \
+	uint8x16_t y; \
+	uint8x8_t u, v; \
+	int16x8_t u_16, v_16; \
+	int16x8_t r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2; \
+	uint8x16_t r, g, b; \
+	\
+	READ_UV \
+	u_16 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(u)), bias); \
+	v_16 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v)), bias); \
+	UV2RGB_16(u_16, v_16, r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2) \
+	\
+	/* process 16 pixels of first line */ \
+	READ_Y(y_ptr1) \
+	Y2RGB_16(y, r, g, b) \
+	SAVE_PIXELS(rgb_ptr1, r, g, b) \
+	\
+	/* process 16 pixels of second line */ \
+	if (uv_y_sample_interval > 1) { \
+		READ_Y(y_ptr2) \
+		Y2RGB_16(y, r, g, b) \
+		SAVE_PIXELS(rgb_ptr2, r, g, b) \
+	} \
+
+
+void NEON_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+	const uint8_t *packed = SDL_min(Y, SDL_min(U, V));
+	const int y_index = (int)(Y - packed);
+	const int u_index = (int)(U - packed);
+	const int v_index = (int)(V - packed);
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+	const int uv_first = (U < V);
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+	const uint8x16_t alpha = vdupq_n_u8(0xFF);
+#else
+#error Unknown RGB pixel size
+#endif
+	const int16x8_t v_r_factor = vdupq_n_s16(param->v_r_factor);
+	const int16x8_t u_g_factor = vdupq_n_s16(param->u_g_factor);
+	const int16x8_t v_g_factor = vdupq_n_s16(param->v_g_factor);
+	const int16x8_t u_b_factor = vdupq_n_s16(param->u_b_factor);
+	const int16x8_t y_factor = vdupq_n_s16(param->y_factor);
+	const int16x8_t y_shift = vdupq_n_s16(param->y_shift);
+	const int16x8_t bias = vdupq_n_s16(128);
+
+	if (width >= 16) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+#if YUV_FORMAT == YUV_FORMAT_422
+			const uint8_t *packed_ptr=packed+ypos*Y_stride;
+#endif
+
+			for(xpos=0; xpos<(width-15); xpos+=16)
+			{
+				YUV2RGB_16
+
+				y_ptr1+=16*y_pixel_stride;
+				y_ptr2+=16*y_pixel_stride;
+				u_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=16*rgb_pixel_stride;
+				rgb_ptr2+=16*rgb_pixel_stride;
+#if YUV_FORMAT == YUV_FORMAT_422
+				packed_ptr+=16*y_pixel_stride;
+#endif
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		int converted = (width & ~15);
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef NEON_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef READ_UV
+#undef READ_Y
+#undef UV2RGB_16
+#undef Y2RGB_16
+#undef RGBA_BYTES
+#undef SAVE_RGBA
+#undef SAVE_PIXELS_
+#undef SAVE_PIXELS
+#undef YUV2RGB_16
@@ -495,6 +495,111 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/* The nearest palette index by checking every color, lowest index on ties */
+static Uint8 pixels_findNearestColor(const SDL_Palette *palette, Uint8 r, Uint8 g, Uint8 b)
+{
+    int i, best = 0;
+    int smallest = SDL_MAX_SINT32;
+
+    for (i = 0; i < palette->ncolors; i++) {
+        const int rd = palette->colors[i].r - r;
+        const int gd = palette->colors[i].g - g;
+        const int bd = palette->colors[i].b - b;
+        const int ad = palette->colors[i].a - SDL_ALPHA_OPAQUE;
+        const int distance = rd * rd + gd * gd + bd * bd + ad * ad;
+        if (distance < smallest) {
+            smallest = distance;
+            best = i;
+        }
+    }
+    return (Uint8)best;
+}
+
+/**
+ * @brief Check that SDL_MapRGB and blits to an 8-bit surface pick the nearest palette colors
+ *
+ * @sa http://wiki.libsdl.org/SDL_MapRGB
+ * @sa http://wiki.libsdl.org/SDL_SetPaletteColors
+ */
+int pixels_mapNearestColor(void *arg)
+{
+    SDL_Surface *src, *dst;
+    SDL_Color colors[256];
+    int variation, i;
+    int mismatches;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, 256, 64, 32, SDL_PIXELFORMAT_XRGB8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 256, 64, 8, SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+    if (src == NULL || dst == NULL) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < src->w * src->h; i++) {
+        ((Uint32 *)src->pixels)[i] = (Uint32)SDLTest_RandomUint32() & 0x00FFFFFF;
+    }
+
+    /* Change the palette between checks so the lookups have to be rebuilt */
+    for (variation = 0; variation < 3; variation++) {
+        for (i = 0; i < 256; i++) {
+            colors[i].r = SDLTest_RandomUint8();
+            colors[i].g = SDLTest_RandomUint8();
+            colors[i].b = SDLTest_RandomUint8();
+            colors[i].a = (variation == 2 && i < 32) ? SDLTest_RandomUint8() : SDL_ALPHA_OPAQUE;
+        }
+        if (variation == 1) {
+            /* Duplicate colors, which should map to the first one */
+            SDL_memcpy(&colors[128], &colors[0], 64 * sizeof(SDL_Color));
+        }
+        SDL_SetPaletteColors(dst->format->palette, colors, 0, 256);
+        SDLTest_AssertPass("Call to SDL_SetPaletteColors(), variation %d", variation);
+
+        mismatches = 0;
+        for (i = 0; i < 10000; i++) {
+            const Uint32 rgb = SDLTest_RandomUint32();
+            const Uint8 r = (Uint8)(rgb >> 16), g = (Uint8)(rgb >> 8), b = (Uint8)rgb;
+            if (SDL_MapRGB(dst->format, r, g, b) != pixels_findNearestColor(dst->format->palette, r, g, b)) {
+                mismatches++;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify SDL_MapRGB() returns the nearest colors; expected: 0 mismatches, got: %d", mismatches);
+
+        /* The blit looks up the nearest color of the pixel rounded to RGB 5-5-5 */
+        SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertPass("Call to SDL_BlitSurface()");
+        mismatches = 0;
+        for (i = 0; i < src->w * src->h; i++) {
+            const Uint32 pixel = ((Uint32 *)src->pixels)[i];
+            const Uint8 r = (Uint8)((pixel >> 16) & 0xF8), g = (Uint8)((pixel >> 8) & 0xF8), b = (Uint8)(pixel & 0xF8);
+            const Uint8 expected = pixels_findNearestColor(dst->format->palette, r | (r >> 5), g | (g >> 5), b | (b >> 5));
+            if (((Uint8 *)dst->pixels)[(i / src->w) * dst->pitch + (i % src->w)] != expected) {
+                mismatches++;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify blit to 8-bit uses the nearest colors; expected: 0 mismatches, got: %d", mismatches);
+    }
+
+    /* A palette without colors maps everything to 0 */
+    dst->format->palette->ncolors = 0;
+    SDL_SetPaletteColors(dst->format->palette, colors, 0, 0);
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertPass("Call to SDL_BlitSurface() with an empty palette");
+    mismatches = 0;
+    for (i = 0; i < src->w * src->h; i++) {
+        if (((Uint8 *)dst->pixels)[(i / src->w) * dst->pitch + (i % src->w)] != 0) {
+            mismatches++;
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify blit to an empty palette uses color 0; expected: 0 mismatches, got: %d", mismatches);
+    dst->format->palette->ncolors = 256;
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -512,9 +617,13 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 = {
+    (SDLTest_TestCaseFp)pixels_mapNearestColor, "pixels_mapNearestColor", "Check that SDL_MapRGB and blits to 8-bit surfaces pick the nearest palette colors", TEST_ENABLED
+};
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, NULL
 };
 
 /* Pixels test suite (global) */
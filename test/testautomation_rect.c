@@ -8,6 +8,9 @@
 #include "SDL.h"
 #include "SDL_test.h"
 
+/* Internal to SDL, the tests link against the static library */
+extern int SDL_GetClusteredRects(int width, int height, int numrects, const SDL_Rect *rects, int cost, SDL_Rect *clusters, int maxclusters);
+
 /* ================= Test Case Implementation ================== */
 
 /* Helper functions */
@@ -1698,6 +1701,131 @@ int rect_testFRectEqualsParam(void *arg)
     return TEST_COMPLETED;
 }
 
+/* !
+ * \brief Private helper to check that every clipped rect lies inside one of the clusters
+ */
+void _validateClusteredRectsCoverage(int width, int height, const SDL_Rect *rects, int numrects,
+                                     const SDL_Rect *clusters, int count)
+{
+    SDL_Rect bounds, clipped, merged;
+    int i, j;
+
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = width;
+    bounds.h = height;
+    for (i = 0; i < numrects; ++i) {
+        if (!SDL_IntersectRect(&rects[i], &bounds, &clipped)) {
+            continue;
+        }
+        for (j = 0; j < count; ++j) {
+            SDL_UnionRect(&clusters[j], &clipped, &merged);
+            if (SDL_RectEquals(&merged, &clusters[j])) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(j < count, "Check that rect (%d,%d,%d,%d) is covered by a cluster",
+                            rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+    }
+}
+
+/* !
+ * \brief Tests the internal SDL_GetClusteredRects() used for window texture updates
+ */
+int rect_testGetClusteredRects(void *arg)
+{
+    SDL_Rect rects[5];
+    SDL_Rect clusters[4];
+    int count, i;
+
+    /* Empty input */
+    count = SDL_GetClusteredRects(100, 100, 0, NULL, 0, clusters, SDL_arraysize(clusters));
+    SDLTest_AssertCheck(count == 0, "Check that no rects give no clusters, got %d", count);
+
+    rects[0].x = -20;
+    rects[0].y = 0;
+    rects[0].w = 10;
+    rects[0].h = 10;
+    rects[1].x = 0;
+    rects[1].y = 100;
+    rects[1].w = 10;
+    rects[1].h = 10;
+    rects[2].x = 0;
+    rects[2].y = 0;
+    rects[2].w = 0;
+    rects[2].h = 10;
+    count = SDL_GetClusteredRects(100, 100, 3, rects, 0, clusters, SDL_arraysize(clusters));
+    SDLTest_AssertCheck(count == 0, "Check that rects outside the area give no clusters, got %d", count);
+
+    count = SDL_GetClusteredRects(100, 100, 1, rects, 0, clusters, 0);
+    SDLTest_AssertCheck(count == -1, "Check that no room for clusters is an error, got %d", count);
+
+    /* Clipping */
+    rects[0].x = -5;
+    rects[0].y = 95;
+    rects[0].w = 10;
+    rects[0].h = 10;
+    count = SDL_GetClusteredRects(100, 100, 1, rects, 0, clusters, SDL_arraysize(clusters));
+    SDLTest_AssertCheck(count == 1 && clusters[0].x == 0 && clusters[0].y == 95 && clusters[0].w == 5 && clusters[0].h == 5,
+                        "Check that the rect is clipped to the area, got %d clusters", count);
+
+    /* Overlapping rects merge when the union adds at most cost pixels */
+    rects[0].x = 0;
+    rects[0].y = 0;
+    rects[0].w = 16;
+    rects[0].h = 16;
+    rects[1].x = 8;
+    rects[1].y = 8;
+    rects[1].w = 16;
+    rects[1].h = 16;
+    count = SDL_GetClusteredRects(100, 100, 2, rects, 100, clusters, SDL_arraysize(clusters));
+    SDLTest_AssertCheck(count == 1 && clusters[0].x == 0 && clusters[0].y == 0 && clusters[0].w == 24 && clusters[0].h == 24,
+                        "Check that overlapping rects are merged, got %d clusters", count);
+    count = SDL_GetClusteredRects(100, 100, 2, rects, 0, clusters, SDL_arraysize(clusters));
+    SDLTest_AssertCheck(count == 2, "Check that overlapping rects aren't merged without a cost, got %d clusters", count);
+    _validateClusteredRectsCoverage(100, 100, rects, 2, clusters, count);
+
+    /* Distant rects stay separate */
+    rects[1].x = 80;
+    rects[1].y = 80;
+    count = SDL_GetClusteredRects(100, 100, 2, rects, 100, clusters, SDL_arraysize(clusters));
+    SDLTest_AssertCheck(count == 2, "Check that distant rects aren't merged, got %d clusters", count);
+    _validateClusteredRectsCoverage(100, 100, rects, 2, clusters, count);
+
+    /* A rect bridging two clusters merges them all */
+    rects[0].x = 0;
+    rects[0].y = 0;
+    rects[0].w = 10;
+    rects[0].h = 10;
+    rects[1].x = 30;
+    rects[1].y = 0;
+    rects[1].w = 10;
+    rects[1].h = 10;
+    rects[2].x = 10;
+    rects[2].y = 0;
+    rects[2].w = 20;
+    rects[2].h = 10;
+    count = SDL_GetClusteredRects(100, 100, 3, rects, 0, clusters, SDL_arraysize(clusters));
+    SDLTest_AssertCheck(count == 1 && clusters[0].x == 0 && clusters[0].y == 0 && clusters[0].w == 40 && clusters[0].h == 10,
+                        "Check that a bridging rect merges both clusters, got %d clusters", count);
+
+    /* The cluster limit merges into the closest cluster */
+    for (i = 0; i < 5; ++i) {
+        rects[i].x = i * 20;
+        rects[i].y = i * 20;
+        rects[i].w = 10;
+        rects[i].h = 10;
+    }
+    count = SDL_GetClusteredRects(100, 100, 5, rects, 0, clusters, SDL_arraysize(clusters));
+    SDLTest_AssertCheck(count == 4, "Check that the clusters are limited to 4, got %d", count);
+    _validateClusteredRectsCoverage(100, 100, rects, 5, clusters, count);
+    count = SDL_GetClusteredRects(100, 100, 5, rects, 0, clusters, 1);
+    SDLTest_AssertCheck(count == 1 && clusters[0].x == 0 && clusters[0].y == 0 && clusters[0].w == 90 && clusters[0].h == 90,
+                        "Check that a single cluster covers all rects, got %d clusters", count);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Rect test cases */
@@ -1836,6 +1964,12 @@ static const SDLTest_TestCaseReference rectTest31 = {
     (SDLTest_TestCaseFp)rect_testFRectEqualsParam, "rect_testFRectEqualsParam", "Negative tests against SDL_FRectEquals with invalid parameters", TEST_ENABLED
 };
 
+/* SDL_GetClusteredRects */
+
+static const SDLTest_TestCaseReference rectTest32 = {
+    (SDLTest_TestCaseFp)rect_testGetClusteredRects, "rect_testGetClusteredRects", "Tests merging, clipping and the cluster limit of the internal SDL_GetClusteredRects", TEST_ENABLED
+};
+
 /* !
  * \brief Sequence of Rect test cases; functions that handle simple rectangles including overlaps and merges.
  *
@@ -1845,7 +1979,7 @@ static const SDLTest_TestCaseReference rectTest31 = {
 static const SDLTest_TestCaseReference *rectTests[] = {
     &rectTest1, &rectTest2, &rectTest3, &rectTest4, &rectTest5, &rectTest6, &rectTest7, &rectTest8, &rectTest9, &rectTest10, &rectTest11, &rectTest12, &rectTest13, &rectTest14,
     &rectTest15, &rectTest16, &rectTest17, &rectTest18, &rectTest19, &rectTest20, &rectTest21, &rectTest22, &rectTest23, &rectTest24, &rectTest25, &rectTest26, &rectTest27,
-    &rectTest28, &rectTest29, &rectTest30, &rectTest31, NULL
+    &rectTest28, &rectTest29, &rectTest30, &rectTest31, &rectTest32, NULL
 };
 
 /* Rect test suite (global) */
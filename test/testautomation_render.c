@@ -436,6 +436,724 @@ int render_testBlit(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests updating part of a YUV texture that is converted in software.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_UpdateYUVTexture
+ * http://wiki.libsdl.org/SDL_RenderCopy
+ */
+int render_testUpdateYUVTexture(void *arg)
+{
+    const int w = TESTRENDER_SCREEN_W, h = TESTRENDER_SCREEN_H;
+    const int cw = (w + 1) / 2, ch = (h + 1) / 2;
+    const size_t size = (size_t)w * h + 2 * cw * ch;
+    SDL_Rect rect;
+    SDL_RendererInfo info;
+    SDL_Texture *texture;
+    SDL_Surface *pattern;
+    SDL_Surface *referenceSurface;
+    Uint8 *frame, *update, *expected;
+    Uint32 i;
+    int ret, x, y, plane;
+
+    ret = SDL_GetRendererInfo(renderer, &info);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+    for (i = 0; i < info.num_texture_formats; ++i) {
+        if (info.texture_formats[i] == SDL_PIXELFORMAT_YV12) {
+            SDLTest_Log("Renderer supports YV12 textures directly, skipping test");
+            return TEST_SKIPPED;
+        }
+    }
+
+    /* Clear surface. */
+    _clearScreen();
+
+    /* Two different frames converted from RGB */
+    frame = (Uint8 *)SDL_malloc(size);
+    update = (Uint8 *)SDL_malloc(size);
+    expected = (Uint8 *)SDL_malloc(size);
+    pattern = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(frame && update && expected && pattern, "Validate allocated test buffers");
+    if (frame == NULL || update == NULL || expected == NULL || pattern == NULL) {
+        SDL_free(frame);
+        SDL_free(update);
+        SDL_free(expected);
+        SDL_FreeSurface(pattern);
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < h; ++y) {
+        Uint32 *p = (Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch);
+        for (x = 0; x < w; ++x) {
+            p[x] = 0xFF000000 | ((x * 3) << 16) | ((y * 4) << 8) | ((x + y) * 2);
+        }
+    }
+    SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, pattern->pixels, pattern->pitch, SDL_PIXELFORMAT_YV12, frame, w);
+    for (y = 0; y < h; ++y) {
+        Uint32 *p = (Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch);
+        for (x = 0; x < w; ++x) {
+            p[x] = 0xFF000000 | ((255 - x * 3) << 16) | (((x * y) & 0xFF) << 8) | (y * 4);
+        }
+    }
+    SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, pattern->pixels, pattern->pitch, SDL_PIXELFORMAT_YV12, update, w);
+    SDL_FreeSurface(pattern);
+
+    /* An odd sized rectangle at odd coordinates, so chroma samples are shared
+       with pixels outside of it */
+    rect.x = 13;
+    rect.y = 7;
+    rect.w = 31;
+    rect.h = 21;
+
+    /* The texture contents after replacing rect with the second frame */
+    SDL_memcpy(expected, frame, size);
+    for (y = rect.y; y < rect.y + rect.h; ++y) {
+        SDL_memcpy(expected + y * w + rect.x, update + y * w + rect.x, rect.w);
+    }
+    for (plane = 0; plane < 2; ++plane) {
+        const size_t offset = (size_t)w * h + plane * cw * ch;
+        for (y = rect.y / 2; y < rect.y / 2 + (rect.h + 1) / 2; ++y) {
+            SDL_memcpy(expected + offset + y * cw + rect.x / 2, update + offset + y * cw + rect.x / 2, (rect.w + 1) / 2);
+        }
+    }
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_YV12, SDL_TEXTUREACCESS_STREAMING, w, h);
+    SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+    if (texture != NULL) {
+        const size_t chroma_offset = (size_t)(rect.y / 2) * cw + rect.x / 2;
+
+        ret = SDL_UpdateTexture(texture, NULL, frame, w);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+
+        /* YV12 stores the V plane before the U plane */
+        ret = SDL_UpdateYUVTexture(texture, &rect,
+                                   update + rect.y * w + rect.x, w,
+                                   update + w * h + cw * ch + chroma_offset, cw,
+                                   update + w * h + chroma_offset, cw);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateYUVTexture, expected: 0, got: %i", ret);
+
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = w;
+        rect.h = h;
+        ret = SDL_RenderCopy(renderer, texture, NULL, &rect);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+
+        /* See if it's the same as converting the whole frame */
+        referenceSurface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, RENDER_COMPARE_FORMAT);
+        SDLTest_AssertCheck(referenceSurface != NULL, "Verify reference surface is not NULL");
+        if (referenceSurface != NULL) {
+            SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_YV12, expected, w, RENDER_COMPARE_FORMAT, referenceSurface->pixels, referenceSurface->pitch);
+            _compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+            SDL_FreeSurface(referenceSurface);
+        }
+
+        /* Make current */
+        SDL_RenderPresent(renderer);
+
+        SDL_DestroyTexture(texture);
+    }
+
+    SDL_free(frame);
+    SDL_free(update);
+    SDL_free(expected);
+
+    return TEST_COMPLETED;
+}
+
+/* Scale srcrect of an ARGB8888 frame like the renderer does, and blit it to dstrect */
+static void _scaleYUVReference(SDL_Surface *frame, const SDL_Rect *srcrect, const SDL_Rect *dstrect,
+                               SDL_ScaleMode scaleMode, SDL_Surface *expected)
+{
+    SDL_Surface *tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h, 0, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Rect rect = *dstrect;
+
+    if (tmp == NULL) {
+        return;
+    }
+    if (scaleMode == SDL_ScaleModeNearest) {
+        SDL_SoftStretch(frame, srcrect, tmp, NULL);
+    } else {
+        SDL_SoftStretchLinear(frame, srcrect, tmp, NULL);
+    }
+    SDL_SetSurfaceBlendMode(tmp, SDL_BLENDMODE_NONE);
+    SDL_BlitSurface(tmp, NULL, expected, &rect);
+    SDL_FreeSurface(tmp);
+}
+
+/* The largest difference of a color channel between two surfaces */
+static int _maxChannelError(SDL_Surface *actual, SDL_Surface *expected)
+{
+    int x, y, error = 0;
+
+    for (y = 0; y < actual->h; ++y) {
+        for (x = 0; x < actual->w; ++x) {
+            const Uint8 *a = (const Uint8 *)actual->pixels + y * actual->pitch + x * actual->format->BytesPerPixel;
+            const Uint8 *e = (const Uint8 *)expected->pixels + y * expected->pitch + x * expected->format->BytesPerPixel;
+            const Uint32 pa = (actual->format->BytesPerPixel == 4) ? *(const Uint32 *)a : *(const Uint16 *)a;
+            const Uint32 pe = (expected->format->BytesPerPixel == 4) ? *(const Uint32 *)e : *(const Uint16 *)e;
+            Uint8 ar, ag, ab, er, eg, eb;
+
+            SDL_GetRGB(pa, actual->format, &ar, &ag, &ab);
+            SDL_GetRGB(pe, expected->format, &er, &eg, &eb);
+            error = SDL_max(error, SDL_abs(ar - er));
+            error = SDL_max(error, SDL_abs(ag - eg));
+            error = SDL_max(error, SDL_abs(ab - eb));
+        }
+    }
+    return error;
+}
+
+/**
+ * @brief Tests scaled copies of YUV textures, which the software renderer
+ *        converts and scales in one pass.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_CreateSoftwareRenderer
+ * http://wiki.libsdl.org/SDL_SetTextureScaleMode
+ * http://wiki.libsdl.org/SDL_RenderCopy
+ */
+int render_testScaleYUVTexture(void *arg)
+{
+    const Uint32 formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 };
+    /* Upscaled from odd coordinates, partly outside of the surface, downscaled, and clipped */
+    const SDL_Rect srcrects[] = { { 0, 0, 40, 30 }, { 3, 1, 21, 15 }, { 0, 0, 40, 30 }, { 7, 5, 30, 20 }, { 1, 2, 33, 25 } };
+    const SDL_Rect dstrects[] = { { 0, 0, 64, 48 }, { 5, 3, 47, 29 }, { -10, -6, 80, 60 }, { 30, 20, 15, 10 }, { 2, 4, 50, 40 } };
+    const SDL_Rect cliprect = { 10, 8, 30, 20 };
+    const int tw = 40, th = 30, w = 64, h = 48;
+    const size_t size = (size_t)tw * th + 2 * ((tw + 1) / 2) * ((th + 1) / 2);
+    SDL_Surface *pattern, *frames[2], *surface, *expected;
+    SDL_Window *win;
+    SDL_Renderer *sw;
+    SDL_Texture *texture;
+    SDL_Rect rect;
+    Uint8 *yuv[2];
+    int f, m, i, x, y, ret, error;
+
+    /* The scaled conversions are compared with the C conversion of the whole frame */
+    SDL_SetHint(SDL_HINT_YUV_INTRINSICS, "0");
+
+    /* Two different frames converted from RGB, and back for the reference */
+    pattern = SDL_CreateRGBSurfaceWithFormat(0, tw, th, 0, SDL_PIXELFORMAT_ARGB8888);
+    frames[0] = SDL_CreateRGBSurfaceWithFormat(0, tw, th, 0, SDL_PIXELFORMAT_ARGB8888);
+    frames[1] = SDL_CreateRGBSurfaceWithFormat(0, tw, th, 0, SDL_PIXELFORMAT_ARGB8888);
+    yuv[0] = (Uint8 *)SDL_malloc(size);
+    yuv[1] = (Uint8 *)SDL_malloc(size);
+    SDLTest_AssertCheck(pattern && frames[0] && frames[1] && yuv[0] && yuv[1], "Validate allocated test buffers");
+    if (pattern == NULL || frames[0] == NULL || frames[1] == NULL || yuv[0] == NULL || yuv[1] == NULL) {
+        SDL_FreeSurface(pattern);
+        SDL_FreeSurface(frames[0]);
+        SDL_FreeSurface(frames[1]);
+        SDL_free(yuv[0]);
+        SDL_free(yuv[1]);
+        SDL_ResetHint(SDL_HINT_YUV_INTRINSICS);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < 2; ++i) {
+        for (y = 0; y < th; ++y) {
+            Uint32 *p = (Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch);
+            for (x = 0; x < tw; ++x) {
+                p[x] = i ? (0xFF000000 | ((255 - x * 6) << 16) | (((x * y) & 0xFF) << 8) | (y * 8))
+                         : (0xFF000000 | ((x * 6) << 16) | ((y * 8) << 8) | ((x ^ y) * 4));
+            }
+        }
+        SDL_ConvertPixels(tw, th, SDL_PIXELFORMAT_ARGB8888, pattern->pixels, pattern->pitch, SDL_PIXELFORMAT_YV12, yuv[i], tw);
+        SDL_ConvertPixels(tw, th, SDL_PIXELFORMAT_YV12, yuv[i], tw, SDL_PIXELFORMAT_ARGB8888, frames[i]->pixels, frames[i]->pitch);
+    }
+    SDL_FreeSurface(pattern);
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+        expected = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+        sw = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+        texture = sw ? SDL_CreateTexture(sw, SDL_PIXELFORMAT_YV12, SDL_TEXTUREACCESS_STREAMING, tw, th) : NULL;
+        SDLTest_AssertCheck(surface && expected && sw && texture, "Verify %s surfaces, software renderer and YV12 texture", SDL_GetPixelFormatName(formats[f]));
+        if (texture == NULL) {
+            SDL_DestroyRenderer(sw);
+            SDL_FreeSurface(surface);
+            SDL_FreeSurface(expected);
+            continue;
+        }
+        ret = SDL_UpdateTexture(texture, NULL, yuv[0], tw);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+
+        for (m = 0; m < 2; ++m) {
+            const SDL_ScaleMode scaleMode = m ? SDL_ScaleModeLinear : SDL_ScaleModeNearest;
+            /* Linear filtering rounds between the passes a little differently,
+               which can be one step of a 5 bit channel */
+            const int allowable_error = (formats[f] == SDL_PIXELFORMAT_RGB565) ? 9 : m;
+
+            SDL_SetTextureScaleMode(texture, scaleMode);
+            for (i = 0; i < SDL_arraysize(srcrects); ++i) {
+                const SDL_bool clipped = (i == SDL_arraysize(srcrects) - 1);
+
+                SDL_RenderSetClipRect(sw, clipped ? &cliprect : NULL);
+                SDL_FillRect(surface, NULL, 0);
+                ret = SDL_RenderCopy(sw, texture, &srcrects[i], &dstrects[i]);
+                SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+                SDL_RenderFlush(sw);
+
+                SDL_FillRect(expected, NULL, 0);
+                SDL_SetClipRect(expected, clipped ? &cliprect : NULL);
+                _scaleYUVReference(frames[0], &srcrects[i], &dstrects[i], scaleMode, expected);
+                SDL_SetClipRect(expected, NULL);
+
+                error = _maxChannelError(surface, expected);
+                SDLTest_AssertCheck(error <= allowable_error, "Verify %s copy %d with scale mode %d, expected error <= %d, got: %d",
+                                    SDL_GetPixelFormatName(formats[f]), i, (int)scaleMode, allowable_error, error);
+            }
+        }
+
+        SDL_DestroyTexture(texture);
+        SDL_DestroyRenderer(sw);
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(expected);
+    }
+
+    /* Updating the texture between two batched copies must not change the first one */
+    SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+    win = SDL_CreateWindow("render_testScaleYUVTexture", 0, 0, w, h, 0);
+    sw = win ? SDL_CreateRenderer(win, -1, SDL_RENDERER_SOFTWARE) : NULL;
+    SDL_ResetHint(SDL_HINT_RENDER_BATCHING);
+    texture = sw ? SDL_CreateTexture(sw, SDL_PIXELFORMAT_YV12, SDL_TEXTUREACCESS_STREAMING, tw, th) : NULL;
+    surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, RENDER_COMPARE_FORMAT);
+    expected = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(win && sw && texture && surface && expected, "Verify window, batched software renderer and YV12 texture");
+    if (texture != NULL && surface != NULL && expected != NULL) {
+        SDL_SetTextureScaleMode(texture, SDL_ScaleModeLinear);
+        SDL_SetRenderDrawColor(sw, 0, 0, 0, 255);
+        SDL_RenderClear(sw);
+        SDL_FillRect(expected, NULL, SDL_MapRGB(expected->format, 0, 0, 0));
+        for (i = 0; i < 2; ++i) {
+            rect.x = i * w / 2;
+            rect.y = 0;
+            rect.w = w / 2;
+            rect.h = h;
+            SDL_UpdateTexture(texture, NULL, yuv[i], tw);
+            ret = SDL_RenderCopy(sw, texture, NULL, &rect);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+            _scaleYUVReference(frames[i], &srcrects[0], &rect, SDL_ScaleModeLinear, expected);
+        }
+        ret = SDL_RenderReadPixels(sw, NULL, RENDER_COMPARE_FORMAT, surface->pixels, surface->pitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+        error = _maxChannelError(surface, expected);
+        SDLTest_AssertCheck(error <= 1, "Verify batched copies of two frames, expected error <= 1, got: %d", error);
+    }
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(sw);
+    SDL_DestroyWindow(win);
+    SDL_FreeSurface(surface);
+    SDL_FreeSurface(expected);
+
+    SDL_FreeSurface(frames[0]);
+    SDL_FreeSurface(frames[1]);
+    SDL_free(yuv[0]);
+    SDL_free(yuv[1]);
+    SDL_ResetHint(SDL_HINT_YUV_INTRINSICS);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests blended fills and lines of the software renderer against the
+ *        per pixel blend equations.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_CreateSoftwareRenderer
+ * http://wiki.libsdl.org/SDL_SetRenderDrawBlendMode
+ * http://wiki.libsdl.org/SDL_RenderFillRect
+ */
+int render_testSoftwareBlendFill(void *arg)
+{
+    const Uint32 formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_RGB565 };
+    const SDL_BlendMode modes[] = { SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL };
+    const Uint8 alphas[] = { 0, 1, 128, 254, 255 };
+    /* A span with a partial vector at the end, a column, and a horizontal line */
+    const SDL_Rect rects[] = { { 3, 5, 37, 9 }, { 50, 2, 1, 40 }, { 5, 30, 38, 1 } };
+    const int w = 64, h = 48;
+    int f, m, i, x, y, ret;
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+        SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[f]);
+        SDL_Renderer *sw = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+
+        SDLTest_AssertCheck(surface && expected && sw, "Verify %s surfaces and software renderer", SDL_GetPixelFormatName(formats[f]));
+        if (surface == NULL || expected == NULL || sw == NULL) {
+            SDL_DestroyRenderer(sw);
+            SDL_FreeSurface(surface);
+            SDL_FreeSurface(expected);
+            return TEST_ABORTED;
+        }
+
+        for (m = 0; m < SDL_arraysize(modes); ++m) {
+            for (i = 0; i < SDL_arraysize(alphas); ++i) {
+                const unsigned r = SDLTest_RandomUint8(), g = SDLTest_RandomUint8(), b = SDLTest_RandomUint8();
+                const unsigned a = alphas[i], inva = 255 - a;
+
+                for (y = 0; y < h; ++y) {
+                    for (x = 0; x < w; ++x) {
+                        const Uint32 pixel = SDL_MapRGBA(surface->format, SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8());
+                        if (surface->format->BytesPerPixel == 4) {
+                            ((Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch))[x] = pixel;
+                        } else {
+                            ((Uint16 *)((Uint8 *)surface->pixels + y * surface->pitch))[x] = (Uint16)pixel;
+                        }
+                    }
+                }
+                SDL_memcpy(expected->pixels, surface->pixels, (size_t)surface->pitch * h);
+
+                /* Blend every pixel of the rects, with the color premultiplied like the renderer does */
+                for (y = 0; y < h; ++y) {
+                    for (x = 0; x < w; ++x) {
+                        const SDL_Point point = { x, y };
+                        Uint8 *pixel = (Uint8 *)expected->pixels + y * expected->pitch + x * expected->format->BytesPerPixel;
+                        Uint32 value = (expected->format->BytesPerPixel == 4) ? *(Uint32 *)pixel : *(Uint16 *)pixel;
+                        Uint8 dr, dg, db, da;
+                        unsigned c[4], s[4];
+                        int k;
+
+                        if (!SDL_PointInRect(&point, &rects[0]) && !SDL_PointInRect(&point, &rects[1]) && !SDL_PointInRect(&point, &rects[2])) {
+                            continue;
+                        }
+                        SDL_GetRGBA(value, expected->format, &dr, &dg, &db, &da);
+                        c[0] = dr, c[1] = dg, c[2] = db, c[3] = da;
+                        s[0] = r, s[1] = g, s[2] = b, s[3] = a;
+                        for (k = 0; k < 4; ++k) {
+                            switch (modes[m]) {
+                            case SDL_BLENDMODE_BLEND:
+                                c[k] = c[k] * inva / 255 + ((k < 3) ? s[k] * a / 255 : a);
+                                break;
+                            case SDL_BLENDMODE_ADD:
+                                c[k] = (k < 3) ? SDL_min(c[k] + s[k] * a / 255, 255) : c[k];
+                                break;
+                            case SDL_BLENDMODE_MOD:
+                                c[k] = (k < 3) ? c[k] * s[k] / 255 : c[k];
+                                break;
+                            default:
+                                c[k] = SDL_min(c[k] * s[k] / 255 + c[k] * inva / 255, 255);
+                                break;
+                            }
+                        }
+                        value = SDL_MapRGBA(expected->format, c[0], c[1], c[2], c[3]);
+                        if (expected->format->BytesPerPixel == 4) {
+                            *(Uint32 *)pixel = value;
+                        } else {
+                            *(Uint16 *)pixel = (Uint16)value;
+                        }
+                    }
+                }
+
+                SDL_SetRenderDrawBlendMode(sw, modes[m]);
+                SDL_SetRenderDrawColor(sw, r, g, b, a);
+                SDL_RenderFillRects(sw, rects, 2);
+                SDL_RenderDrawLine(sw, rects[2].x, rects[2].y, rects[2].x + rects[2].w - 1, rects[2].y);
+                ret = SDL_RenderFlush(sw);
+                SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFlush, expected: 0, got: %i", ret);
+
+                for (y = 0; y < h; ++y) {
+                    if (SDL_memcmp((Uint8 *)surface->pixels + y * surface->pitch,
+                                   (Uint8 *)expected->pixels + y * expected->pitch,
+                                   w * surface->format->BytesPerPixel) != 0) {
+                        break;
+                    }
+                }
+                SDLTest_AssertCheck(y == h, "Verify %s blend mode %d alpha %u, first different row: %d",
+                                    SDL_GetPixelFormatName(formats[f]), (int)modes[m], a, (y == h) ? -1 : y);
+            }
+        }
+
+        SDL_DestroyRenderer(sw);
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(expected);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests several updates and locks of a streaming texture that the
+ *        software renderer converts to a format it supports.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_UpdateTexture
+ * http://wiki.libsdl.org/SDL_LockTexture
+ * http://wiki.libsdl.org/SDL_RenderCopy
+ */
+int render_testUpdateStreamingTexture(void *arg)
+{
+    /* The whole texture, overlapping locks and updates, then more small rects than are tracked separately */
+    const SDL_Rect rects[] = { { 0, 0, 64, 48 }, { 5, 3, 20, 10 }, { 10, 8, 30, 20 }, { 40, 30, 10, 10 }, { 0, 0, 8, 8 } };
+    const int count = SDL_arraysize(rects) + 100;
+    const int w = 64, h = 48;
+    SDL_Surface *surface, *expected, *converted;
+    SDL_Renderer *sw;
+    SDL_Texture *texture;
+    SDL_Rect rect;
+    void *pixels;
+    int pitch;
+    int i, x, y, ret;
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, SDL_PIXELFORMAT_RGB888);
+    expected = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, SDL_PIXELFORMAT_RGB24);
+    sw = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    texture = sw ? SDL_CreateTexture(sw, SDL_PIXELFORMAT_RGB24, SDL_TEXTUREACCESS_STREAMING, w, h) : NULL;
+    SDLTest_AssertCheck(surface && expected && sw && texture, "Verify surfaces, software renderer and texture");
+    if (surface == NULL || expected == NULL || sw == NULL || texture == NULL) {
+        SDL_DestroyRenderer(sw);
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(expected);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < count; ++i) {
+        if (i < SDL_arraysize(rects)) {
+            rect = rects[i];
+        } else {
+            rect.x = (i * 7) % w;
+            rect.y = (i * 5) % h;
+            rect.w = 1;
+            rect.h = 1;
+        }
+
+        /* Write the rect with random pixels, alternating updates and locks */
+        for (y = rect.y; y < rect.y + rect.h; ++y) {
+            Uint8 *row = (Uint8 *)expected->pixels + y * expected->pitch + rect.x * 3;
+            for (x = 0; x < rect.w * 3; ++x) {
+                row[x] = SDLTest_RandomUint8();
+            }
+        }
+        if (i % 2) {
+            ret = SDL_LockTexture(texture, &rect, &pixels, &pitch);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTexture, expected: 0, got: %i", ret);
+            if (ret == 0) {
+                for (y = 0; y < rect.h; ++y) {
+                    SDL_memcpy((Uint8 *)pixels + y * pitch, (Uint8 *)expected->pixels + (rect.y + y) * expected->pitch + rect.x * 3, rect.w * 3);
+                }
+                SDL_UnlockTexture(texture);
+            }
+        } else {
+            ret = SDL_UpdateTexture(texture, i ? &rect : NULL, (Uint8 *)expected->pixels + rect.y * expected->pitch + rect.x * 3, expected->pitch);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+        }
+        if (i == 0) {
+            SDL_RenderCopy(sw, texture, NULL, NULL);
+        }
+
+        /* Check the rendered texture after the updates and locks that overlap and the small rects */
+        if (i != 2 && i != 4 && i != count - 1) {
+            continue;
+        }
+        ret = SDL_RenderCopy(sw, texture, NULL, NULL);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+        ret = SDL_RenderFlush(sw);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFlush, expected: 0, got: %i", ret);
+
+        converted = SDL_ConvertSurfaceFormat(expected, SDL_PIXELFORMAT_RGB888, 0);
+        SDLTest_AssertCheck(converted != NULL, "Verify converted surface is not NULL");
+        if (converted == NULL) {
+            break;
+        }
+        for (y = 0; y < h; ++y) {
+            const Uint32 *actual_row = (const Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+            const Uint32 *expected_row = (const Uint32 *)((Uint8 *)converted->pixels + y * converted->pitch);
+            for (x = 0; x < w; ++x) {
+                if ((actual_row[x] & 0x00FFFFFF) != (expected_row[x] & 0x00FFFFFF)) {
+                    break;
+                }
+            }
+            if (x < w) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(y == h, "Verify rendered texture after %d updates, first different pixel: %d,%d",
+                            i + 1, (y == h) ? -1 : x, (y == h) ? -1 : y);
+        SDL_FreeSurface(converted);
+    }
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(sw);
+    SDL_FreeSurface(surface);
+    SDL_FreeSurface(expected);
+
+    return TEST_COMPLETED;
+}
+
+/* Draws part of a frame into area, the same way for the window and the reference renderer */
+static void _drawPartialFrame(SDL_Renderer *r, SDL_Texture *texture, const SDL_Rect *area, int frame)
+{
+    const int cx = area->x + area->w / 2, cy = area->y + area->h / 2;
+    SDL_Rect rect;
+    SDL_Point points[3];
+    SDL_Vertex verts[3];
+    int i;
+
+    SDL_SetRenderDrawColor(r, (Uint8)(frame * 40), 200, (Uint8)(255 - frame * 30), 255);
+    switch (frame % 4) {
+    case 0:
+        /* A fill, a line and points */
+        SDL_RenderFillRect(r, area);
+        SDL_SetRenderDrawColor(r, 255, 255, 255, 255);
+        SDL_RenderDrawLine(r, area->x, area->y, area->x + area->w - 1, area->y + area->h - 1);
+        points[0].x = cx;
+        points[0].y = area->y;
+        points[1].x = area->x;
+        points[1].y = cy;
+        points[2].x = cx;
+        points[2].y = cy;
+        SDL_RenderDrawPoints(r, points, 3);
+        break;
+    case 1:
+        /* A plain and a rotated copy */
+        SDL_RenderCopy(r, texture, NULL, area);
+        rect.x = cx - 8;
+        rect.y = cy - 8;
+        rect.w = 16;
+        rect.h = 16;
+        SDL_RenderCopyEx(r, texture, NULL, &rect, 30.0 * frame, NULL, SDL_FLIP_HORIZONTAL);
+        break;
+    case 2:
+        /* Geometry */
+        for (i = 0; i < 3; ++i) {
+            verts[i].color.r = (Uint8)(i * 100);
+            verts[i].color.g = 100;
+            verts[i].color.b = (Uint8)(255 - i * 100);
+            verts[i].color.a = 255;
+            verts[i].tex_coord.x = 0.0f;
+            verts[i].tex_coord.y = 0.0f;
+        }
+        verts[0].position.x = (float)area->x;
+        verts[0].position.y = (float)area->y;
+        verts[1].position.x = (float)(area->x + area->w);
+        verts[1].position.y = (float)cy;
+        verts[2].position.x = (float)cx;
+        verts[2].position.y = (float)(area->y + area->h);
+        SDL_RenderGeometry(r, NULL, verts, 3, NULL, 0);
+        break;
+    default:
+        /* More small fills than are batched, clipped to the area */
+        SDL_RenderSetClipRect(r, area);
+        for (i = 0; i < 100; ++i) {
+            rect.x = area->x - 2 + (i * 7) % (area->w + 4);
+            rect.y = area->y - 2 + (i * 3) % (area->h + 4);
+            rect.w = 3;
+            rect.h = 2;
+            SDL_RenderFillRect(r, &rect);
+        }
+        SDL_RenderSetClipRect(r, NULL);
+        break;
+    }
+}
+
+/**
+ * @brief Tests that a software renderer for a window keeps the output of
+ *        earlier frames when only parts of the window are redrawn.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_CreateRenderer
+ * http://wiki.libsdl.org/SDL_RenderPresent
+ * http://wiki.libsdl.org/SDL_RenderReadPixels
+ */
+int render_testSoftwarePartialFrames(void *arg)
+{
+    const int w = 80, h = 60;
+    const int frames = 12;
+    SDL_Window *win;
+    SDL_Renderer *sw, *ref;
+    SDL_Surface *surface, *pattern, *actual;
+    SDL_Texture *texture, *ref_texture;
+    SDL_Rect area;
+    int i, x, y, ret;
+
+    /* Draw lines like the surface renderer does */
+    SDL_SetHint(SDL_HINT_RENDER_LINE_METHOD, "2");
+    win = SDL_CreateWindow("render_testSoftwarePartialFrames", 0, 0, w, h, 0);
+    sw = win ? SDL_CreateRenderer(win, -1, SDL_RENDERER_SOFTWARE) : NULL;
+    SDL_ResetHint(SDL_HINT_RENDER_LINE_METHOD);
+    surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, RENDER_COMPARE_FORMAT);
+    ref = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    pattern = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 0, RENDER_COMPARE_FORMAT);
+    actual = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(win && sw && ref && pattern && actual, "Verify window, software renderers and surfaces");
+    if (win == NULL || sw == NULL || ref == NULL || pattern == NULL || actual == NULL) {
+        SDL_DestroyRenderer(ref);
+        SDL_DestroyRenderer(sw);
+        SDL_DestroyWindow(win);
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(pattern);
+        SDL_FreeSurface(actual);
+        return TEST_ABORTED;
+    }
+
+    for (y = 0; y < pattern->h; ++y) {
+        for (x = 0; x < pattern->w; ++x) {
+            ((Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch))[x] = 0xFF000000 | (x * 16) << 16 | (y * 16) << 8 | ((x ^ y) & 1) * 0xFF;
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(sw, pattern);
+    ref_texture = SDL_CreateTextureFromSurface(ref, pattern);
+    SDLTest_AssertCheck(texture && ref_texture, "Verify pattern textures");
+
+    /* A full frame, then frames that only draw into a part of the window */
+    SDL_SetRenderDrawColor(sw, 64, 64, 64, 255);
+    SDL_RenderClear(sw);
+    SDL_RenderPresent(sw);
+    SDL_SetRenderDrawColor(ref, 64, 64, 64, 255);
+    SDL_RenderClear(ref);
+
+    for (i = 0; i < frames; ++i) {
+        area.x = (i * 13) % (w - 20) - 4;
+        area.y = (i * 11) % (h - 16) - 2;
+        area.w = 12 + i * 2;
+        area.h = 10 + i;
+
+        /* Every few frames the window is exposed and fully updated */
+        if (i == frames / 2) {
+            SDL_Event event;
+
+            SDL_zero(event);
+            event.type = SDL_WINDOWEVENT;
+            event.window.event = SDL_WINDOWEVENT_EXPOSED;
+            event.window.windowID = SDL_GetWindowID(win);
+            SDL_PushEvent(&event);
+            SDL_PumpEvents();
+        }
+
+        _drawPartialFrame(sw, texture, &area, i);
+        SDL_RenderPresent(sw);
+        _drawPartialFrame(ref, ref_texture, &area, i);
+        SDL_RenderFlush(ref);
+
+        ret = SDL_RenderReadPixels(sw, NULL, RENDER_COMPARE_FORMAT, actual->pixels, actual->pitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+        for (y = 0; y < h; ++y) {
+            const Uint32 *actual_row = (const Uint32 *)((Uint8 *)actual->pixels + y * actual->pitch);
+            const Uint32 *expected_row = (const Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+            for (x = 0; x < w; ++x) {
+                if ((actual_row[x] & 0x00FFFFFF) != (expected_row[x] & 0x00FFFFFF)) {
+                    break;
+                }
+            }
+            if (x < w) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(y == h, "Verify window after partial frame %d, first different pixel: %d,%d",
+                            i + 1, (y == h) ? -1 : x, (y == h) ? -1 : y);
+    }
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyTexture(ref_texture);
+    SDL_DestroyRenderer(ref);
+    SDL_DestroyRenderer(sw);
+    SDL_DestroyWindow(win);
+    SDL_FreeSurface(surface);
+    SDL_FreeSurface(pattern);
+    SDL_FreeSurface(actual);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * @brief Blits doing color tests.
  *
@@ -1156,9 +1874,29 @@ static const SDLTest_TestCaseReference renderTest7 = {
     (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED
 };
 
+static const SDLTest_TestCaseReference renderTest8 = {
+    (SDLTest_TestCaseFp)render_testUpdateYUVTexture, "render_testUpdateYUVTexture", "Tests updating part of a YUV texture", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest9 = {
+    (SDLTest_TestCaseFp)render_testSoftwareBlendFill, "render_testSoftwareBlendFill", "Tests blended fills and lines of the software renderer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest10 = {
+    (SDLTest_TestCaseFp)render_testUpdateStreamingTexture, "render_testUpdateStreamingTexture", "Tests updates and locks of a converted streaming texture", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest11 = {
+    (SDLTest_TestCaseFp)render_testSoftwarePartialFrames, "render_testSoftwarePartialFrames", "Tests partial frames of a software renderer for a window", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest12 = {
+    (SDLTest_TestCaseFp)render_testScaleYUVTexture, "render_testScaleYUVTexture", "Tests scaled copies of YUV textures", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, &renderTest11, &renderTest12, NULL
 };
 
 /* Render test suite (global) */
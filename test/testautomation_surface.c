@@ -761,6 +761,818 @@ int surface_testOverflow(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests remapping palettized surfaces after their palettes change
+ * and when alternating between blit targets.
+ */
+int surface_testPaletteRemap(void *arg)
+{
+    const SDL_Color colors[4] = { { 255, 0, 0, 255 }, { 0, 255, 0, 255 }, { 0, 0, 255, 255 }, { 255, 255, 255, 255 } };
+    SDL_Color reversed[4];
+    SDL_Surface *src, *dst, *argb;
+    Uint8 *pixels;
+    int i, ret;
+
+    for (i = 0; i < 4; ++i) {
+        reversed[i] = colors[3 - i];
+    }
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, 4, 1, 8, SDL_PIXELFORMAT_INDEX8);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 4, 1, 8, SDL_PIXELFORMAT_INDEX8);
+    argb = SDL_CreateRGBSurfaceWithFormat(0, 4, 1, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL && dst != NULL && argb != NULL, "Verify surfaces are not NULL");
+    if (src == NULL || dst == NULL || argb == NULL) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(argb);
+        return TEST_ABORTED;
+    }
+
+    SDL_SetPaletteColors(src->format->palette, colors, 0, 4);
+    SDL_SetPaletteColors(dst->format->palette, reversed, 0, 4);
+    pixels = (Uint8 *)src->pixels;
+    for (i = 0; i < 4; ++i) {
+        pixels[i] = (Uint8)i;
+    }
+
+    /* Blit to the reversed palette, then to another format and back */
+    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result from blitting to reversed palette, expected: 0, got: %i", ret);
+    pixels = (Uint8 *)dst->pixels;
+    for (i = 0; i < 4; ++i) {
+        SDLTest_AssertCheck(pixels[i] == 3 - i, "Verify pixel %d is remapped, expected: %d, got: %d", i, 3 - i, pixels[i]);
+    }
+
+    ret = SDL_BlitSurface(src, NULL, argb, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result from blitting to ARGB8888, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(*(Uint32 *)argb->pixels == 0xFFFF0000, "Verify first ARGB8888 pixel, expected: 0xFFFF0000, got: 0x%.8x", *(Uint32 *)argb->pixels);
+
+    /* Changing the destination palette must produce a new mapping */
+    SDL_SetPaletteColors(dst->format->palette, colors, 0, 4);
+    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result from blitting to identical palette, expected: 0, got: %i", ret);
+    for (i = 0; i < 4; ++i) {
+        SDLTest_AssertCheck(pixels[i] == i, "Verify pixel %d is copied, expected: %d, got: %d", i, i, pixels[i]);
+    }
+
+    SDL_SetPaletteColors(dst->format->palette, reversed, 0, 4);
+    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result from blitting to reversed palette again, expected: 0, got: %i", ret);
+    for (i = 0; i < 4; ++i) {
+        SDLTest_AssertCheck(pixels[i] == 3 - i, "Verify pixel %d is remapped again, expected: %d, got: %d", i, 3 - i, pixels[i]);
+    }
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(argb);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that conversions split across threads match the single threaded ones.
+ */
+int surface_testConvertThreaded(void *arg)
+{
+    const Uint32 formats[] = { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_YUY2 };
+    const int w = 257, h = 211;
+    const int pitch = w * 4;
+    const size_t size = (size_t)pitch * h;
+    SDL_Surface *face, *converted[2];
+    Uint8 *src, *dst[2], *rgb[2];
+    int i, j, ret;
+
+    src = (Uint8 *)SDL_malloc(size);
+    dst[0] = (Uint8 *)SDL_malloc(size);
+    dst[1] = (Uint8 *)SDL_malloc(size);
+    rgb[0] = (Uint8 *)SDL_malloc(size);
+    rgb[1] = (Uint8 *)SDL_malloc(size);
+    SDLTest_AssertCheck(src && dst[0] && dst[1] && rgb[0] && rgb[1], "Validate allocated test buffers");
+    if (!src || !dst[0] || !dst[1] || !rgb[0] || !rgb[1]) {
+        SDL_free(src);
+        SDL_free(dst[0]);
+        SDL_free(dst[1]);
+        SDL_free(rgb[0]);
+        SDL_free(rgb[1]);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < (int)size; ++i) {
+        src[i] = SDLTest_RandomUint8();
+    }
+
+    /* Every image is large enough to be split */
+    SDL_SetHint(SDL_HINT_CONVERT_THREADS_MIN_PIXELS, "1");
+
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        /* Planar YUV formats take the Y plane pitch, the chroma planes follow it */
+        const int dst_pitch = (formats[i] == SDL_PIXELFORMAT_NV12 || formats[i] == SDL_PIXELFORMAT_YV12) ? w : pitch;
+
+        /* Convert to the format and back, once on the calling thread and once on 4 threads */
+        for (j = 0; j < 2; ++j) {
+            SDL_SetHint(SDL_HINT_CONVERT_THREADS, j ? "4" : "1");
+            SDL_memset(dst[j], 0, size);
+            ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, src, pitch, formats[i], dst[j], dst_pitch);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels to %s, expected: 0, got: %i", SDL_GetPixelFormatName(formats[i]), ret);
+            ret = SDL_ConvertPixels(w, h, formats[i], dst[j], dst_pitch, SDL_PIXELFORMAT_ARGB8888, rgb[j], pitch);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels from %s, expected: 0, got: %i", SDL_GetPixelFormatName(formats[i]), ret);
+        }
+        SDLTest_AssertCheck(SDL_memcmp(dst[0], dst[1], size) == 0, "Verify threaded conversion to %s matches", SDL_GetPixelFormatName(formats[i]));
+        SDLTest_AssertCheck(SDL_memcmp(rgb[0], rgb[1], size) == 0, "Verify threaded conversion from %s matches", SDL_GetPixelFormatName(formats[i]));
+    }
+
+    /* SDL_ConvertSurface() splits plain conversions too */
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Verify face surface is not NULL");
+    if (face != NULL) {
+        for (j = 0; j < 2; ++j) {
+            SDL_SetHint(SDL_HINT_CONVERT_THREADS, j ? "4" : "1");
+            converted[j] = SDL_ConvertSurfaceFormat(face, SDL_PIXELFORMAT_RGB565, 0);
+            SDLTest_AssertCheck(converted[j] != NULL, "Verify converted surface is not NULL");
+        }
+        if (converted[0] && converted[1]) {
+            int y;
+            for (y = 0; y < face->h; ++y) {
+                if (SDL_memcmp((Uint8 *)converted[0]->pixels + y * converted[0]->pitch,
+                               (Uint8 *)converted[1]->pixels + y * converted[1]->pitch, face->w * 2) != 0) {
+                    break;
+                }
+            }
+            SDLTest_AssertCheck(y == face->h, "Verify threaded SDL_ConvertSurface() matches, first different row: %d", y);
+        }
+        SDL_FreeSurface(converted[0]);
+        SDL_FreeSurface(converted[1]);
+        SDL_FreeSurface(face);
+    }
+
+    SDL_ResetHint(SDL_HINT_CONVERT_THREADS);
+    SDL_ResetHint(SDL_HINT_CONVERT_THREADS_MIN_PIXELS);
+    SDL_free(src);
+    SDL_free(dst[0]);
+    SDL_free(dst[1]);
+    SDL_free(rgb[0]);
+    SDL_free(rgb[1]);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests loading BMP files straight into a pixel format
+ *
+ * @sa http://wiki.libsdl.org/SDL_LoadBMPFormat_RW
+ */
+int surface_testLoadBMPFormat(void *arg)
+{
+    const Uint32 srcFormats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_INDEX8 };
+    const Uint32 dstFormats[] = { SDL_PIXELFORMAT_UNKNOWN, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_INDEX8 };
+    const char *sampleFilename = "testLoadBMPFormat.bmp";
+    const int w = 301, h = 203;
+    const size_t size = 1024 + (size_t)w * h * 4;
+    Uint8 *data;
+    int i, j, k, ret;
+
+    data = (Uint8 *)SDL_malloc(size);
+    SDLTest_AssertCheck(data != NULL, "Validate allocated test buffer");
+    if (data == NULL) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(srcFormats); ++i) {
+        SDL_Surface *face, *image;
+        SDL_RWops *rw;
+        Sint64 length = 0;
+
+        /* Save random pixels, in a file and in memory */
+        face = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, srcFormats[i]);
+        SDLTest_AssertCheck(face != NULL, "Verify %s surface is not NULL", SDL_GetPixelFormatName(srcFormats[i]));
+        if (face == NULL) {
+            continue;
+        }
+        if (face->format->palette) {
+            SDL_Color colors[256];
+            for (j = 0; j < 256; ++j) {
+                colors[j].r = SDLTest_RandomUint8();
+                colors[j].g = SDLTest_RandomUint8();
+                colors[j].b = SDLTest_RandomUint8();
+                colors[j].a = SDL_ALPHA_OPAQUE;
+            }
+            SDL_SetPaletteColors(face->format->palette, colors, 0, 256);
+        }
+        for (j = 0; j < h; ++j) {
+            for (k = 0; k < w * face->format->BytesPerPixel; ++k) {
+                ((Uint8 *)face->pixels)[j * face->pitch + k] = SDLTest_RandomUint8();
+            }
+        }
+        unlink(sampleFilename);
+        ret = SDL_SaveBMP(face, sampleFilename);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SaveBMP, expected: 0, got: %i", ret);
+        rw = SDL_RWFromMem(data, (int)size);
+        if (rw != NULL) {
+            ret = SDL_SaveBMP_RW(face, rw, 0);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SaveBMP_RW, expected: 0, got: %i", ret);
+            length = SDL_RWtell(rw);
+            SDL_RWclose(rw);
+        }
+        SDL_FreeSurface(face);
+
+        image = SDL_LoadBMP(sampleFilename);
+        SDLTest_AssertCheck(image != NULL, "Verify result from SDL_LoadBMP is not NULL");
+        if (image == NULL) {
+            continue;
+        }
+
+        /* Loading into a format gives the same pixels as converting afterwards */
+        for (j = 0; j < (int)SDL_arraysize(dstFormats); ++j) {
+            const char *name = SDL_GetPixelFormatName(dstFormats[j]);
+            SDL_Surface *expected, *loaded;
+
+            if (dstFormats[j] == SDL_PIXELFORMAT_UNKNOWN || dstFormats[j] == image->format->format) {
+                expected = SDL_DuplicateSurface(image);
+            } else {
+                expected = SDL_ConvertSurfaceFormat(image, dstFormats[j], 0);
+            }
+            SDLTest_AssertCheck(expected != NULL, "Verify converted surface is not NULL");
+            if (expected == NULL) {
+                continue;
+            }
+
+            for (k = 0; k < 2; ++k) {
+                rw = k ? SDL_RWFromConstMem(data, (int)length) : SDL_RWFromFile(sampleFilename, "rb");
+                SDLTest_AssertCheck(rw != NULL, "Verify %s stream is not NULL", k ? "memory" : "file");
+                if (rw == NULL) {
+                    continue;
+                }
+                loaded = SDL_LoadBMPFormat_RW(rw, 0, dstFormats[j]);
+                SDLTest_AssertPass("Call to SDL_LoadBMPFormat_RW(%s) from %s", name, k ? "memory" : "file");
+                SDLTest_AssertCheck(loaded != NULL, "Verify result from SDL_LoadBMPFormat_RW is not NULL");
+                SDLTest_AssertCheck(SDL_RWtell(rw) == length, "Verify the stream is after the image");
+                SDL_RWclose(rw);
+                if (loaded != NULL) {
+                    SDLTest_AssertCheck(loaded->format->format == expected->format->format,
+                                        "Verify loaded format, expected: %s, got: %s", SDL_GetPixelFormatName(expected->format->format), SDL_GetPixelFormatName(loaded->format->format));
+                    ret = SDLTest_CompareSurfaces(loaded, expected, 0);
+                    SDLTest_AssertCheck(ret == 0, "Verify loading %s into %s matches conversion, expected: 0, got: %i", SDL_GetPixelFormatName(srcFormats[i]), name, ret);
+                    SDL_FreeSurface(loaded);
+                }
+            }
+            SDL_FreeSurface(expected);
+        }
+        SDL_FreeSurface(image);
+    }
+
+    unlink(sampleFilename);
+    SDL_free(data);
+
+    return TEST_COMPLETED;
+}
+
+/* Write a 32-bit BI_RGB BMP file, top-down if height is negative, with the pixels 4 byte aligned */
+static int _writeBMP32(const char *file, int width, int height, const Uint32 *pixels)
+{
+    const Uint32 offset = 64;
+    const Uint32 size = (Uint32)width * SDL_abs(height) * 4;
+    SDL_RWops *rw = SDL_RWFromFile(file, "wb");
+    Uint32 i;
+
+    if (rw == NULL) {
+        return -1;
+    }
+    SDL_RWwrite(rw, "BM", 2, 1);
+    SDL_WriteLE32(rw, offset + size);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, offset);
+    SDL_WriteLE32(rw, 40);
+    SDL_WriteLE32(rw, (Uint32)width);
+    SDL_WriteLE32(rw, (Uint32)height);
+    SDL_WriteLE16(rw, 1);
+    SDL_WriteLE16(rw, 32);
+    SDL_WriteLE32(rw, 0); /* BI_RGB */
+    SDL_WriteLE32(rw, size);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, 0);
+    while (SDL_RWtell(rw) < (Sint64)offset) {
+        SDL_WriteU8(rw, 0);
+    }
+    for (i = 0; i < size / 4; ++i) {
+        SDL_WriteLE32(rw, pixels[i]);
+    }
+    return SDL_RWclose(rw);
+}
+
+/**
+ * @brief Tests loading top-down 32-bit BMP files with SDL_HINT_BMP_LOAD_MAPPED
+ *
+ * @sa http://wiki.libsdl.org/SDL_LoadBMP_RW
+ */
+int surface_testLoadBMPMapped(void *arg)
+{
+    const char *sampleFilename = "testLoadBMPMapped.bmp";
+    /* Large enough to be mapped */
+    const int w = 128, h = 130;
+    Uint32 *pixels;
+    SDL_Surface *image;
+    int i, x, y, ret;
+
+    pixels = (Uint32 *)SDL_malloc((size_t)w * h * sizeof(*pixels));
+    SDLTest_AssertCheck(pixels != NULL, "Validate allocated test buffer");
+    if (pixels == NULL) {
+        return TEST_ABORTED;
+    }
+
+    SDL_SetHintWithPriority(SDL_HINT_BMP_LOAD_MAPPED, "1", SDL_HINT_OVERRIDE);
+
+    /* With alpha, without alpha, and bottom-up which is always copied */
+    for (i = 0; i < 3; ++i) {
+        const Uint32 amask = (i == 1) ? 0 : 0xFF000000;
+
+        for (y = 0; y < w * h; ++y) {
+            pixels[y] = (SDLTest_RandomUint32() & 0x00FFFFFF) | (SDLTest_RandomUint32() & amask);
+        }
+        unlink(sampleFilename);
+        ret = _writeBMP32(sampleFilename, w, (i == 2) ? h : -h, pixels);
+        SDLTest_AssertCheck(ret == 0, "Verify the BMP file was written, expected: 0, got: %i", ret);
+
+        image = SDL_LoadBMP(sampleFilename);
+        SDLTest_AssertCheck(image != NULL, "Verify result from SDL_LoadBMP is not NULL");
+        if (image == NULL) {
+            continue;
+        }
+        SDLTest_AssertCheck(image->format->format == SDL_PIXELFORMAT_ARGB8888, "Verify loaded format, expected: %s, got: %s",
+                            SDL_GetPixelFormatName(SDL_PIXELFORMAT_ARGB8888), SDL_GetPixelFormatName(image->format->format));
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN && (defined(__LINUX__) || defined(__MACOSX__))
+        SDLTest_AssertCheck(!(image->flags & SDL_PREALLOC) == (i == 2), "Verify the pixels are %s", (i == 2) ? "copied" : "mapped");
+#endif
+        for (y = 0; y < h; ++y) {
+            const Uint32 *row = (const Uint32 *)((const Uint8 *)image->pixels + y * image->pitch);
+            const Uint32 *expected = pixels + ((i == 2) ? (h - 1 - y) : y) * w;
+            for (x = 0; x < w; ++x) {
+                if (row[x] != (expected[x] | (amask ? 0 : 0xFF000000))) {
+                    break;
+                }
+            }
+            if (x < w) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(y == h, "Verify loaded pixels, first different pixel: %d,%d", (y == h) ? -1 : x, (y == h) ? -1 : y);
+
+        /* Writing to the surface doesn't change the file */
+        SDL_FillRect(image, NULL, 0x12345678);
+        SDL_FreeSurface(image);
+        image = SDL_LoadBMP(sampleFilename);
+        SDLTest_AssertCheck(image != NULL, "Verify result from SDL_LoadBMP is not NULL");
+        if (image != NULL) {
+            const Uint32 *row = (const Uint32 *)image->pixels;
+            SDLTest_AssertCheck(row[0] != 0x12345678, "Verify the file wasn't changed through the surface");
+            SDL_FreeSurface(image);
+        }
+    }
+
+    SDL_ResetHint(SDL_HINT_BMP_LOAD_MAPPED);
+    unlink(sampleFilename);
+    SDL_free(pixels);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that surface copies share pixels until they are written, with SDL_HINT_SURFACE_COPY_ON_WRITE
+ *
+ * @sa http://wiki.libsdl.org/SDL_DuplicateSurface
+ */
+int surface_testCopyOnWrite(void *arg)
+{
+    SDL_Surface *face, *reference, *copies[3], *converted;
+    SDL_Surface copy;
+    SDL_Rect rect;
+    Uint32 argb[16 * 16], abgr[16 * 16];
+    void *pixels;
+    int i, ret;
+
+    /* The image uses static pixels, so copy it into a surface that owns them */
+    reference = SDLTest_ImageFace();
+    SDLTest_AssertCheck(reference != NULL, "Verify face surface is not NULL");
+    if (reference == NULL) {
+        return TEST_ABORTED;
+    }
+    face = SDL_DuplicateSurface(reference);
+    SDLTest_AssertCheck(face != NULL && face->pixels != reference->pixels, "Verify copies don't share pixels by default");
+    if (face == NULL) {
+        return TEST_ABORTED;
+    }
+
+    SDL_SetHint(SDL_HINT_SURFACE_COPY_ON_WRITE, "1");
+
+    for (i = 0; i < (int)SDL_arraysize(copies); ++i) {
+        copies[i] = SDL_DuplicateSurface(face);
+        SDLTest_AssertCheck(copies[i] != NULL, "Verify result from SDL_DuplicateSurface is not NULL");
+        if (copies[i] == NULL) {
+            return TEST_ABORTED;
+        }
+        SDLTest_AssertCheck(copies[i]->pixels == face->pixels, "Verify copy %d shares the pixels", i);
+    }
+    converted = SDL_ConvertSurfaceFormat(face, face->format->format, 0);
+    SDLTest_AssertCheck(converted != NULL && converted->pixels == face->pixels, "Verify conversion to the same format shares the pixels");
+    ret = SDLTest_CompareSurfaces(converted, reference, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+    /* Write to each copy in a different way */
+    ret = SDL_LockSurface(copies[0]);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockSurface, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(copies[0]->pixels != face->pixels, "Verify a locked copy has its own pixels");
+    SDL_memset(copies[0]->pixels, 0, (size_t)copies[0]->pitch * copies[0]->h);
+    SDL_UnlockSurface(copies[0]);
+
+    rect.x = 10;
+    rect.y = 20;
+    rect.w = 30;
+    rect.h = 40;
+    ret = SDL_FillRect(copies[1], &rect, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_FillRect, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(copies[1]->pixels != face->pixels, "Verify a filled copy has its own pixels");
+
+    ret = SDL_BlitSurface(copies[0], NULL, copies[2], NULL);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(copies[2]->pixels != face->pixels, "Verify a blit destination copy has its own pixels");
+
+    /* The original and the copy that wasn't written are unchanged */
+    ret = SDLTest_CompareSurfaces(face, reference, 0);
+    SDLTest_AssertCheck(ret == 0, "Verify the original is unchanged, expected: 0, got: %i", ret);
+    SDL_FreeSurface(face);
+    ret = SDLTest_CompareSurfaces(converted, reference, 0);
+    SDLTest_AssertCheck(ret == 0, "Verify the last user of the pixels is unchanged, expected: 0, got: %i", ret);
+
+    /* The last user writes in place */
+    face = converted;
+    converted = SDL_ConvertSurfaceFormat(reference, SDL_PIXELFORMAT_RGB565, 0);
+    SDLTest_AssertCheck(converted != NULL && converted->pixels != reference->pixels, "Verify conversion to another format copies the pixels");
+    pixels = face->pixels;
+    ret = SDL_BlitSurface(converted, NULL, face, NULL);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(face->pixels == pixels, "Verify the last user of the pixels keeps them");
+    SDL_FreeSurface(converted);
+
+    /* SDL_ConvertPixels() blits between plain surfaces on the stack, which never share pixels */
+    for (i = 0; i < (int)SDL_arraysize(argb); ++i) {
+        argb[i] = 0x01020304u * (Uint32)i;
+    }
+    ret = SDL_ConvertPixels(16, 16, SDL_PIXELFORMAT_ARGB8888, argb, 16 * 4, SDL_PIXELFORMAT_ABGR8888, abgr, 16 * 4);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_ConvertPixels, expected: 0, got: %i", ret);
+    for (i = 0; i < (int)SDL_arraysize(argb); ++i) {
+        if (abgr[i] != ((argb[i] & 0xFF00FF00) | ((argb[i] & 0x00FF0000) >> 16) | ((argb[i] & 0x000000FF) << 16))) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i == (int)SDL_arraysize(argb), "Verify converted pixels, first different pixel: %d", (i == (int)SDL_arraysize(argb)) ? -1 : i);
+
+    /* A surface copied by value is a plain surface too */
+    copy = *face;
+    converted = SDL_ConvertSurfaceFormat(&copy, face->format->format, 0);
+    SDLTest_AssertCheck(converted != NULL && converted->pixels != face->pixels, "Verify conversion of a surface copied by value copies the pixels");
+    ret = SDLTest_CompareSurfaces(converted, face, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+    SDL_FreeSurface(converted);
+
+    SDL_ResetHint(SDL_HINT_SURFACE_COPY_ON_WRITE);
+
+    for (i = 0; i < (int)SDL_arraysize(copies); ++i) {
+        SDL_FreeSurface(copies[i]);
+    }
+    SDL_FreeSurface(face);
+    SDL_FreeSurface(reference);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests reusing freed surface pixels with SDL_HINT_SURFACE_POOL_SIZE, and SDL_HINT_SURFACE_ALIGNED_PITCH
+ *
+ * @sa http://wiki.libsdl.org/SDL_CreateRGBSurfaceWithFormat
+ */
+int surface_testPixelPool(void *arg)
+{
+    const int widths[] = { 1, 3, 17, 100, 640, 1023 };
+    SDL_Surface *face, *surface, *aligned, *unaligned;
+    void *pixels;
+    int i, y, ret;
+
+    SDL_SetHint(SDL_HINT_SURFACE_POOL_SIZE, "16777216");
+
+    /* Freed pixels are reused for a surface of a similar size, and cleared */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 256, 250, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_CreateRGBSurfaceWithFormat is not NULL");
+    if (surface == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_FillRect(surface, NULL, 0xFFFFFFFF);
+    pixels = surface->pixels;
+    SDL_FreeSurface(surface);
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 256, 249, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_CreateRGBSurfaceWithFormat is not NULL");
+    if (surface == NULL) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(surface->pixels == pixels, "Verify freed pixels are reused");
+    for (y = 0; y < surface->h; ++y) {
+        const Uint32 *row = (const Uint32 *)((const Uint8 *)surface->pixels + y * surface->pitch);
+        for (i = 0; i < surface->w; ++i) {
+            if (row[i] != 0) {
+                break;
+            }
+        }
+        if (i < surface->w) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(y == surface->h, "Verify reused pixels are cleared");
+    SDL_FreeSurface(surface);
+
+    /* Aligned pixels that the application gives to a surface are smaller than
+       their size class, so they must not be pooled, even when shared by a copy */
+    for (i = 0; i < 2; ++i) {
+        void *placeholder;
+
+        pixels = SDL_SIMDAlloc(64 * 65 * 4);
+        SDLTest_AssertCheck(pixels != NULL, "Verify result from SDL_SIMDAlloc is not NULL");
+        surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels, 64, 65, 32, 64 * 4, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_CreateRGBSurfaceWithFormatFrom is not NULL");
+        if (surface == NULL) {
+            SDL_SIMDFree(pixels);
+            return TEST_ABORTED;
+        }
+        surface->flags &= ~SDL_PREALLOC;
+        surface->flags |= SDL_SIMD_ALIGNED;
+        if (i == 1) {
+            SDL_SetHint(SDL_HINT_SURFACE_COPY_ON_WRITE, "1");
+            aligned = SDL_DuplicateSurface(surface);
+            SDL_ResetHint(SDL_HINT_SURFACE_COPY_ON_WRITE);
+            SDLTest_AssertCheck(aligned != NULL && aligned->pixels == pixels, "Verify the copy shares the pixels");
+            SDL_FreeSurface(surface);
+            surface = aligned;
+        }
+        SDL_FreeSurface(surface);
+
+        /* Take the freed memory if it went back to the heap, so only the pool can return it */
+        placeholder = SDL_SIMDAlloc(64 * 65 * 4);
+        surface = SDL_CreateRGBSurfaceWithFormat(0, 64, 72, 32, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_CreateRGBSurfaceWithFormat is not NULL");
+        SDLTest_AssertCheck(surface == NULL || surface->pixels != pixels, "Verify %s pixels from the application aren't reused", i ? "shared" : "owned");
+        SDL_FreeSurface(surface);
+        SDL_SIMDFree(placeholder);
+    }
+
+    /* Resetting the hint releases the pooled pixels */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 256, 250, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_CreateRGBSurfaceWithFormat is not NULL");
+    SDL_FreeSurface(surface);
+    SDL_ResetHint(SDL_HINT_SURFACE_POOL_SIZE);
+    SDLTest_AssertPass("Call to SDL_ResetHint(SDL_HINT_SURFACE_POOL_SIZE)");
+
+    /* Aligned rows blit the same as unaligned ones */
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Verify face surface is not NULL");
+    if (face == NULL) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < (int)SDL_arraysize(widths); ++i) {
+        SDL_SetHintWithPriority(SDL_HINT_SURFACE_ALIGNED_PITCH, "1", SDL_HINT_OVERRIDE);
+        aligned = SDL_CreateRGBSurfaceWithFormat(0, widths[i], face->h, 24, SDL_PIXELFORMAT_RGB24);
+        SDL_SetHintWithPriority(SDL_HINT_SURFACE_ALIGNED_PITCH, "0", SDL_HINT_OVERRIDE);
+        unaligned = SDL_CreateRGBSurfaceWithFormat(0, widths[i], face->h, 24, SDL_PIXELFORMAT_RGB24);
+        SDLTest_AssertCheck(aligned != NULL && unaligned != NULL, "Verify results from SDL_CreateRGBSurfaceWithFormat are not NULL");
+        if (aligned == NULL || unaligned == NULL) {
+            SDL_FreeSurface(aligned);
+            SDL_FreeSurface(unaligned);
+            continue;
+        }
+        SDLTest_AssertCheck(aligned->pitch % SDL_SIMDGetAlignment() == 0 && ((size_t)aligned->pixels % SDL_SIMDGetAlignment()) == 0,
+                            "Verify width %d rows are SIMD aligned, pitch: %i", widths[i], aligned->pitch);
+        SDLTest_AssertCheck(unaligned->pitch == (widths[i] * 3 + 3) / 4 * 4, "Verify the default pitch, expected: %i, got: %i", (widths[i] * 3 + 3) / 4 * 4, unaligned->pitch);
+        SDL_BlitSurface(face, NULL, aligned, NULL);
+        SDL_BlitSurface(face, NULL, unaligned, NULL);
+        ret = SDLTest_CompareSurfaces(aligned, unaligned, 0);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+        SDL_FreeSurface(aligned);
+        SDL_FreeSurface(unaligned);
+    }
+    SDL_ResetHint(SDL_HINT_SURFACE_ALIGNED_PITCH);
+    SDL_FreeSurface(face);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_FillRects() at every pixel size, with rects of all widths and alignments
+ *
+ * @sa http://wiki.libsdl.org/SDL_FillRects
+ */
+int surface_testFillRects(void *arg)
+{
+    const Uint32 formats[] = { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 };
+    SDL_Rect rects[64];
+    int i, j, ret;
+
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        /* The last surface is large enough to be filled with streaming stores */
+        const int size = (formats[i] == SDL_PIXELFORMAT_ARGB8888) ? 2048 : 301;
+        SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, size, size, 0, formats[i]);
+        Uint32 color = 0;
+        int bpp, x, y, bad = 0;
+
+        SDLTest_AssertCheck(surface != NULL, "Verify %s surface is not NULL", SDL_GetPixelFormatName(formats[i]));
+        if (surface == NULL) {
+            continue;
+        }
+        bpp = surface->format->BytesPerPixel;
+        SDL_memset(surface->pixels, 0, (size_t)surface->pitch * surface->h);
+
+        for (j = 0; j < (int)SDL_arraysize(rects); ++j) {
+            rects[j].x = SDLTest_RandomIntegerInRange(-8, 300);
+            rects[j].y = SDLTest_RandomIntegerInRange(-8, 300);
+            rects[j].w = (j < 32) ? j : SDLTest_RandomIntegerInRange(32, 300);
+            rects[j].h = SDLTest_RandomIntegerInRange(1, 4);
+        }
+        /* The first rect covers the surface, the others are all within 610x310 pixels */
+        rects[0].x = rects[0].y = 0;
+        rects[0].w = rects[0].h = size;
+
+        /* Fill each rect separately, so later ones overwrite earlier ones */
+        for (j = 0; j < (int)SDL_arraysize(rects); ++j) {
+            color = (Uint32)(j + 1) * 0x01010101u;
+            ret = SDL_FillRect(surface, &rects[j], color);
+            if (ret != 0) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRect(), expected: 0, got: %i", ret);
+
+        for (y = 0; y < size && !bad; ++y) {
+            for (x = 0; x < size; ++x) {
+                const Uint8 *p = (const Uint8 *)surface->pixels + y * surface->pitch + x * bpp;
+                int expected = 1, k;
+                for (j = (int)SDL_arraysize(rects) - 1; j > 0 && x < 610 && y < 310; --j) {
+                    if (x >= rects[j].x && x < rects[j].x + rects[j].w &&
+                        y >= rects[j].y && y < rects[j].y + rects[j].h) {
+                        expected = j + 1;
+                        break;
+                    }
+                }
+                for (k = 0; k < bpp; ++k) {
+                    if (p[k] != (Uint8)expected) {
+                        break;
+                    }
+                }
+                if (k < bpp) {
+                    SDLTest_AssertCheck(SDL_FALSE, "Verify %s pixel at %d,%d, expected: %d, got: %d",
+                                        SDL_GetPixelFormatName(formats[i]), x, y, expected, p[k]);
+                    bad = 1;
+                    break;
+                }
+            }
+        }
+        if (!bad) {
+            SDLTest_AssertPass("Verified %s fill results", SDL_GetPixelFormatName(formats[i]));
+        }
+        SDL_FreeSurface(surface);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests clipped blits of RLE surfaces against the same blits without RLE
+ *
+ * @sa http://wiki.libsdl.org/SDL_SetSurfaceRLE
+ * @sa http://wiki.libsdl.org/SDL_SetClipRect
+ */
+int surface_testRLEClippedBlit(void *arg)
+{
+    const Uint32 formats[] = { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB555, SDL_PIXELFORMAT_ARGB8888 };
+    /* Unclipped, then clipped on the left, right, top, bottom and at the corners */
+    const SDL_Point positions[] = { { 10, 8 }, { -9, 6 }, { 45, 10 }, { 12, -7 }, { 8, 50 }, { -20, -15 }, { 50, 55 }, { -3, 40 } };
+    const SDL_Rect clip = { 4, 3, 62, 60 };
+    const int w = 37, h = 29;
+    int f, kind, i, x, y, error;
+
+    for (f = 0; f < (int)SDL_arraysize(formats); ++f) {
+        /* Colorkey, colorkey with alpha mod, and per-pixel alpha */
+        for (kind = 0; kind < 3; ++kind) {
+            const Uint32 src_format = (kind == 2) ? SDL_PIXELFORMAT_ARGB8888 : formats[f];
+            SDL_Surface *rle = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, src_format);
+            SDL_Surface *plain = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, src_format);
+            SDL_Surface *actual = SDL_CreateRGBSurfaceWithFormat(0, 70, 66, 0, formats[f]);
+            SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, 70, 66, 0, formats[f]);
+            Uint32 key = 0;
+
+            SDLTest_AssertCheck(rle && plain && actual && expected, "Verify %s surfaces are not NULL", SDL_GetPixelFormatName(formats[f]));
+            if (rle == NULL || plain == NULL || actual == NULL || expected == NULL) {
+                SDL_FreeSurface(rle);
+                SDL_FreeSurface(plain);
+                SDL_FreeSurface(actual);
+                SDL_FreeSurface(expected);
+                return TEST_ABORTED;
+            }
+
+            /* Runs of transparent, opaque and translucent pixels of varying lengths, and blank lines */
+            key = SDL_MapRGB(rle->format, 255, 0, 255);
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    const int run = ((x + y * 3) / (1 + y % 5)) % 4;
+                    Uint32 pixel;
+                    if (y == 0 || y == h - 1 || run == 0) {
+                        pixel = (kind == 2) ? SDL_MapRGBA(rle->format, 0, 0, 0, 0) : key;
+                    } else if (kind == 2) {
+                        pixel = SDL_MapRGBA(rle->format, (Uint8)(x * 7), (Uint8)(y * 9), (Uint8)(x * y), (run == 1) ? 255 : (Uint8)(x * 13 + y));
+                    } else {
+                        pixel = SDL_MapRGB(rle->format, (Uint8)(x * 7), (Uint8)(y * 9), (Uint8)(x * y));
+                        if (pixel == key) {
+                            pixel ^= 1;
+                        }
+                    }
+                    if (rle->format->BytesPerPixel == 4) {
+                        ((Uint32 *)((Uint8 *)rle->pixels + y * rle->pitch))[x] = pixel;
+                    } else {
+                        ((Uint16 *)((Uint8 *)rle->pixels + y * rle->pitch))[x] = (Uint16)pixel;
+                    }
+                }
+            }
+            SDL_SetSurfaceBlendMode(rle, SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(rle, NULL, plain, NULL);
+
+            if (kind != 2) {
+                SDL_SetColorKey(rle, SDL_TRUE, key);
+                SDL_SetColorKey(plain, SDL_TRUE, key);
+            }
+            if (kind != 0) {
+                SDL_SetSurfaceBlendMode(rle, SDL_BLENDMODE_BLEND);
+                SDL_SetSurfaceBlendMode(plain, SDL_BLENDMODE_BLEND);
+            }
+            if (kind == 1) {
+                SDL_SetSurfaceAlphaMod(rle, 100);
+                SDL_SetSurfaceAlphaMod(plain, 100);
+            }
+            SDL_SetSurfaceRLE(rle, 1);
+
+            for (i = 0; i < (int)SDL_arraysize(positions); ++i) {
+                SDL_Rect dstrect;
+
+                for (y = 0; y < actual->h; ++y) {
+                    for (x = 0; x < actual->w * actual->format->BytesPerPixel; ++x) {
+                        ((Uint8 *)actual->pixels)[y * actual->pitch + x] = (Uint8)(x * 5 + y * 3);
+                    }
+                }
+                SDL_memcpy(expected->pixels, actual->pixels, (size_t)actual->pitch * actual->h);
+                SDL_SetClipRect(actual, (i % 2) ? &clip : NULL);
+                SDL_SetClipRect(expected, (i % 2) ? &clip : NULL);
+
+                dstrect.x = positions[i].x;
+                dstrect.y = positions[i].y;
+                SDL_BlitSurface(rle, NULL, actual, &dstrect);
+                dstrect.x = positions[i].x;
+                dstrect.y = positions[i].y;
+                SDL_BlitSurface(plain, NULL, expected, &dstrect);
+                SDLTest_AssertCheck(SDL_HasSurfaceRLE(rle), "Verify the source surface is RLE encoded");
+
+                /* The RLE blenders round differently than the other blitters,
+                   and don't keep the destination alpha with per-pixel alpha */
+                error = 0;
+                for (y = 0; y < actual->h; ++y) {
+                    for (x = 0; x < actual->w; ++x) {
+                        const Uint8 *a = (Uint8 *)actual->pixels + y * actual->pitch + x * actual->format->BytesPerPixel;
+                        const Uint8 *e = (Uint8 *)expected->pixels + y * expected->pitch + x * expected->format->BytesPerPixel;
+                        Uint32 apixel, epixel;
+                        Uint8 ac[4], ec[4];
+                        int k;
+
+                        if (actual->format->BytesPerPixel == 4) {
+                            apixel = *(const Uint32 *)a;
+                            epixel = *(const Uint32 *)e;
+                        } else {
+                            apixel = *(const Uint16 *)a;
+                            epixel = *(const Uint16 *)e;
+                        }
+                        SDL_GetRGBA(apixel, actual->format, &ac[0], &ac[1], &ac[2], &ac[3]);
+                        SDL_GetRGBA(epixel, expected->format, &ec[0], &ec[1], &ec[2], &ec[3]);
+                        for (k = 0; k < ((kind == 2) ? 3 : 4); ++k) {
+                            error = SDL_max(error, SDL_abs(ac[k] - ec[k]));
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(error <= ((kind == 0) ? 0 : (actual->format->BytesPerPixel == 2) ? 9 : 2), "Verify %s blit %d of source %d at %d,%d, largest difference: %d",
+                                    SDL_GetPixelFormatName(formats[f]), i, kind, positions[i].x, positions[i].y, error);
+            }
+
+            SDL_FreeSurface(rle);
+            SDL_FreeSurface(plain);
+            SDL_FreeSurface(actual);
+            SDL_FreeSurface(expected);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -819,11 +1631,45 @@ static const SDLTest_TestCaseReference surfaceTestOverflow = {
     surface_testOverflow, "surface_testOverflow", "Test overflow detection.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestPaletteRemap = {
+    (SDLTest_TestCaseFp)surface_testPaletteRemap, "surface_testPaletteRemap", "Tests remapping palettes that change between blits.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestConvertThreaded = {
+    (SDLTest_TestCaseFp)surface_testConvertThreaded, "surface_testConvertThreaded", "Tests conversions split across threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestLoadBMPFormat = {
+    (SDLTest_TestCaseFp)surface_testLoadBMPFormat, "surface_testLoadBMPFormat", "Tests loading BMP files straight into a pixel format.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestLoadBMPMapped = {
+    (SDLTest_TestCaseFp)surface_testLoadBMPMapped, "surface_testLoadBMPMapped", "Tests loading BMP files without copying the pixels.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestCopyOnWrite = {
+    (SDLTest_TestCaseFp)surface_testCopyOnWrite, "surface_testCopyOnWrite", "Tests that surface copies share pixels until they are written.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestPixelPool = {
+    (SDLTest_TestCaseFp)surface_testPixelPool, "surface_testPixelPool", "Tests reusing freed surface pixels and aligned surface rows.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestFillRects = {
+    (SDLTest_TestCaseFp)surface_testFillRects, "surface_testFillRects", "Tests filling rects of all sizes and alignments.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestRLEClippedBlit = {
+    (SDLTest_TestCaseFp)surface_testRLEClippedBlit, "surface_testRLEClippedBlit", "Tests clipped blits of RLE surfaces.", TEST_ENABLED
+};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, &surfaceTestPaletteRemap,
+    &surfaceTestConvertThreaded, &surfaceTestLoadBMPFormat, &surfaceTestLoadBMPMapped, &surfaceTestCopyOnWrite, &surfaceTestPixelPool,
+    &surfaceTestFillRects, &surfaceTestRLEClippedBlit, NULL
 };
 
 /* Surface test suite (global) */
@@ -0,0 +1,415 @@
+/*
+  Copyright (C) 1997-2022 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Compares the damage regions used internally by SDL against a bitmap of
+   covered pixels, and times them with --benchmark */
+
+#include "../src/SDL_internal.h"
+
+#include "SDL_test.h"
+#include "../src/video/SDL_region_c.h"
+#include "../src/video/SDL_region.c"
+
+/* The bitmap covers -BITMAP_OFFSET <= x, y < BITMAP_SIZE - BITMAP_OFFSET,
+   the random rects stay well inside that even after translating them */
+#define BITMAP_SIZE   128
+#define BITMAP_OFFSET 32
+
+typedef Uint8 Bitmap[BITMAP_SIZE][BITMAP_SIZE];
+
+static SDLTest_RandomContext rndctx;
+static int failures;
+
+static int RandomRange(int min, int max)
+{
+    return min + (int)(SDLTest_Random(&rndctx) % (unsigned int)(max - min + 1));
+}
+
+static void RandomRect(SDL_Rect *rect)
+{
+    rect->x = RandomRange(-8, 48);
+    rect->y = RandomRange(-8, 48);
+    rect->w = RandomRange(0, 32);
+    rect->h = RandomRange(0, 32);
+}
+
+static void FillBitmap(Bitmap bitmap, const SDL_Rect *rect)
+{
+    int x, y;
+
+    for (y = rect->y; y < rect->y + rect->h; ++y) {
+        for (x = rect->x; x < rect->x + rect->w; ++x) {
+            bitmap[y + BITMAP_OFFSET][x + BITMAP_OFFSET] = 1;
+        }
+    }
+}
+
+static void DrawRegion(Bitmap bitmap, const SDL_Region *region)
+{
+    int i, x, y;
+
+    SDL_memset(bitmap, 0, sizeof(Bitmap));
+    for (i = 0; i < region->numboxes; ++i) {
+        const SDL_RegionBox *box = &region->boxes[i];
+        for (y = box->y1; y < box->y2; ++y) {
+            for (x = box->x1; x < box->x2; ++x) {
+                bitmap[y + BITMAP_OFFSET][x + BITMAP_OFFSET] = 1;
+            }
+        }
+    }
+}
+
+static void Fail(const char *what, const char *why)
+{
+    if (failures++ < 10) {
+        SDL_Log("%s: %s", what, why);
+    }
+}
+
+/* Checks the banding rules and the extents, and that adjacent bands with
+   the same spans are coalesced if the region came out of an operation */
+static SDL_bool CheckRegion(const char *what, const SDL_Region *region, SDL_bool coalesced)
+{
+    const SDL_RegionBox *boxes = region->boxes;
+    SDL_RegionBox extents;
+    int i, j, prev_band = -1, band = 0;
+
+    SDL_zero(extents);
+    for (i = 0; i < region->numboxes; ++i) {
+        if (boxes[i].x1 >= boxes[i].x2 || boxes[i].y1 >= boxes[i].y2) {
+            Fail(what, "empty box");
+            return SDL_FALSE;
+        }
+        if (i == 0) {
+            extents = boxes[i];
+            continue;
+        }
+        extents.x1 = SDL_min(extents.x1, boxes[i].x1);
+        extents.x2 = SDL_max(extents.x2, boxes[i].x2);
+        extents.y2 = boxes[i].y2;
+
+        if (boxes[i].y1 == boxes[i - 1].y1) {
+            if (boxes[i].y2 != boxes[i - 1].y2) {
+                Fail(what, "boxes in a band with different heights");
+                return SDL_FALSE;
+            }
+            if (boxes[i].x1 <= boxes[i - 1].x2) {
+                Fail(what, "boxes in a band out of order or touching");
+                return SDL_FALSE;
+            }
+            continue;
+        }
+        if (boxes[i].y1 < boxes[i - 1].y2) {
+            Fail(what, "bands out of order or overlapping");
+            return SDL_FALSE;
+        }
+
+        /* A new band starts at i, see if the last one equals the one before */
+        if (coalesced && prev_band >= 0 && i - band == band - prev_band &&
+            boxes[band].y1 == boxes[prev_band].y2) {
+            for (j = 0; j < i - band; ++j) {
+                if (boxes[band + j].x1 != boxes[prev_band + j].x1 ||
+                    boxes[band + j].x2 != boxes[prev_band + j].x2) {
+                    break;
+                }
+            }
+            if (j == i - band) {
+                Fail(what, "bands not coalesced");
+                return SDL_FALSE;
+            }
+        }
+        prev_band = band;
+        band = i;
+    }
+    if (SDL_memcmp(&extents, &region->extents, sizeof(extents)) != 0) {
+        Fail(what, "wrong extents");
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+static void CheckBitmap(const char *what, const SDL_Region *region, Bitmap expected)
+{
+    static Bitmap actual;
+
+    if (!CheckRegion(what, region, SDL_TRUE)) {
+        return;
+    }
+    DrawRegion(actual, region);
+    if (SDL_memcmp(actual, expected, sizeof(Bitmap)) != 0) {
+        Fail(what, "wrong pixels");
+    }
+}
+
+static void RandomRegion(SDL_Region *region, Bitmap bitmap)
+{
+    const int count = RandomRange(0, 12);
+    SDL_Rect rects[12];
+    int i;
+
+    SDL_ClearRegion(region);
+    SDL_memset(bitmap, 0, sizeof(Bitmap));
+    for (i = 0; i < count; ++i) {
+        RandomRect(&rects[i]);
+        FillBitmap(bitmap, &rects[i]);
+    }
+    if (RandomRange(0, 1)) {
+        for (i = 0; i < count; ++i) {
+            SDL_UnionRegionRect(region, &rects[i]);
+        }
+        CheckBitmap("SDL_UnionRegionRect", region, bitmap);
+    } else {
+        SDL_UnionRegionRects(region, rects, count);
+        CheckBitmap("SDL_UnionRegionRects", region, bitmap);
+    }
+}
+
+typedef int (*RegionOp)(SDL_Region *dst, const SDL_Region *a, const SDL_Region *b);
+
+static void TestOp(const char *what, RegionOp op, int bitmap_op,
+                   const SDL_Region *a, Bitmap A, const SDL_Region *b, Bitmap B)
+{
+    static Bitmap expected;
+    SDL_Region dst;
+    int x, y;
+
+    for (y = 0; y < BITMAP_SIZE; ++y) {
+        for (x = 0; x < BITMAP_SIZE; ++x) {
+            switch (bitmap_op) {
+            case 0:
+                expected[y][x] = A[y][x] | B[y][x];
+                break;
+            case 1:
+                expected[y][x] = A[y][x] & B[y][x];
+                break;
+            default:
+                expected[y][x] = A[y][x] & !B[y][x];
+                break;
+            }
+        }
+    }
+
+    SDL_InitRegion(&dst);
+    op(&dst, a, b);
+    CheckBitmap(what, &dst, expected);
+
+    /* The destination may be either source */
+    SDL_CopyRegion(&dst, a);
+    op(&dst, &dst, b);
+    CheckBitmap(what, &dst, expected);
+    SDL_CopyRegion(&dst, b);
+    op(&dst, a, &dst);
+    CheckBitmap(what, &dst, expected);
+    SDL_FreeRegion(&dst);
+}
+
+static void RunFuzzTest(int iterations)
+{
+    static Bitmap A, B, expected, actual;
+    SDL_Region a, b, c;
+    SDL_Rect rect, rects[64];
+    int i, j, n, x, y, dx, dy;
+
+    SDL_InitRegion(&a);
+    SDL_InitRegion(&b);
+    SDL_InitRegion(&c);
+    for (i = 0; i < iterations; ++i) {
+        RandomRegion(&a, A);
+        RandomRegion(&b, B);
+
+        TestOp("SDL_UnionRegion", SDL_UnionRegion, 0, &a, A, &b, B);
+        TestOp("SDL_IntersectRegion", SDL_IntersectRegion, 1, &a, A, &b, B);
+        TestOp("SDL_SubtractRegion", SDL_SubtractRegion, 2, &a, A, &b, B);
+        TestOp("SDL_UnionRegion with itself", SDL_UnionRegion, 0, &a, A, &a, A);
+        TestOp("SDL_IntersectRegion with itself", SDL_IntersectRegion, 1, &a, A, &a, A);
+        TestOp("SDL_SubtractRegion from itself", SDL_SubtractRegion, 2, &a, A, &a, A);
+
+        RandomRect(&rect);
+        SDL_CopyRegion(&c, &a);
+        SDL_IntersectRegionRect(&c, &rect);
+        SDL_memset(expected, 0, sizeof(expected));
+        FillBitmap(expected, &rect);
+        for (y = 0; y < BITMAP_SIZE; ++y) {
+            for (x = 0; x < BITMAP_SIZE; ++x) {
+                expected[y][x] &= A[y][x];
+            }
+        }
+        CheckBitmap("SDL_IntersectRegionRect", &c, expected);
+
+        dx = RandomRange(-16, 16);
+        dy = RandomRange(-16, 16);
+        SDL_CopyRegion(&c, &a);
+        SDL_TranslateRegion(&c, dx, dy);
+        SDL_memset(expected, 0, sizeof(expected));
+        /* Random regions only cover 24 <= x, y < 112 of the bitmap, so
+           translated by up to 16 pixels they stay inside of it */
+        for (y = 16; y < BITMAP_SIZE - 16; ++y) {
+            for (x = 16; x < BITMAP_SIZE - 16; ++x) {
+                expected[y + dy][x + dx] = A[y][x];
+            }
+        }
+        CheckBitmap("SDL_TranslateRegion", &c, expected);
+
+        /* Simplified regions cover at least the same pixels with fewer boxes */
+        n = RandomRange(1, 8);
+        SDL_CopyRegion(&c, &a);
+        SDL_SimplifyRegion(&c, n);
+        if (CheckRegion("SDL_SimplifyRegion", &c, SDL_FALSE)) {
+            if (c.numboxes > n) {
+                Fail("SDL_SimplifyRegion", "too many boxes");
+            }
+            if (a.numboxes <= n && (c.numboxes != a.numboxes ||
+                                    SDL_memcmp(c.boxes, a.boxes, a.numboxes * sizeof(*a.boxes)) != 0)) {
+                Fail("SDL_SimplifyRegion", "changed a simple enough region");
+            }
+            DrawRegion(actual, &c);
+            for (y = 0; y < BITMAP_SIZE; ++y) {
+                for (x = 0; x < BITMAP_SIZE; ++x) {
+                    if (A[y][x] && !actual[y][x]) {
+                        Fail("SDL_SimplifyRegion", "lost pixels");
+                        y = BITMAP_SIZE;
+                        break;
+                    }
+                }
+            }
+        }
+
+        n = SDL_GetRegionRects(&a, rects, SDL_arraysize(rects));
+        if (n != a.numboxes) {
+            Fail("SDL_GetRegionRects", "wrong count");
+        } else {
+            SDL_memset(actual, 0, sizeof(actual));
+            for (j = 0; j < n; ++j) {
+                FillBitmap(actual, &rects[j]);
+            }
+            if (SDL_memcmp(actual, A, sizeof(actual)) != 0) {
+                Fail("SDL_GetRegionRects", "wrong pixels");
+            }
+        }
+    }
+    SDL_FreeRegion(&a);
+    SDL_FreeRegion(&b);
+    SDL_FreeRegion(&c);
+}
+
+static void RunBenchmark(void)
+{
+    const int w = 1920, h = 1080, repeats = 100;
+    const SDL_Rect window = { 0, 0, 1920, 1080 };
+    SDL_Rect damage[1000], opaque[50];
+    SDL_Region region, occluders, result;
+    Uint64 start, ticks[6];
+    int i, r;
+
+    for (i = 0; i < (int)SDL_arraysize(damage); ++i) {
+        damage[i].w = RandomRange(8, 128);
+        damage[i].h = RandomRange(8, 128);
+        damage[i].x = RandomRange(-64, w);
+        damage[i].y = RandomRange(-64, h);
+    }
+    for (i = 0; i < (int)SDL_arraysize(opaque); ++i) {
+        opaque[i].w = RandomRange(100, 400);
+        opaque[i].h = RandomRange(100, 400);
+        opaque[i].x = RandomRange(0, w);
+        opaque[i].y = RandomRange(0, h);
+    }
+
+    SDL_InitRegion(&region);
+    SDL_InitRegion(&occluders);
+    SDL_InitRegion(&result);
+    SDL_zeroa(ticks);
+    for (r = 0; r < repeats; ++r) {
+        start = SDL_GetPerformanceCounter();
+        SDL_ClearRegion(&region);
+        for (i = 0; i < (int)SDL_arraysize(damage); ++i) {
+            SDL_UnionRegionRect(&region, &damage[i]);
+        }
+        ticks[0] += SDL_GetPerformanceCounter() - start;
+
+        start = SDL_GetPerformanceCounter();
+        SDL_ClearRegion(&region);
+        SDL_UnionRegionRects(&region, damage, SDL_arraysize(damage));
+        ticks[5] += SDL_GetPerformanceCounter() - start;
+
+        SDL_ClearRegion(&occluders);
+        for (i = 0; i < (int)SDL_arraysize(opaque); ++i) {
+            SDL_UnionRegionRect(&occluders, &opaque[i]);
+        }
+
+        start = SDL_GetPerformanceCounter();
+        SDL_IntersectRegionRect(&region, &window);
+        ticks[1] += SDL_GetPerformanceCounter() - start;
+
+        start = SDL_GetPerformanceCounter();
+        SDL_SubtractRegion(&result, &region, &occluders);
+        ticks[2] += SDL_GetPerformanceCounter() - start;
+
+        start = SDL_GetPerformanceCounter();
+        SDL_TranslateRegion(&result, 3, -7);
+        ticks[3] += SDL_GetPerformanceCounter() - start;
+
+        start = SDL_GetPerformanceCounter();
+        SDL_SimplifyRegion(&result, 16);
+        ticks[4] += SDL_GetPerformanceCounter() - start;
+    }
+    SDL_Log("%d damage rects in a %dx%d window make %d boxes, minus %d occluding rects %d boxes",
+            (int)SDL_arraysize(damage), w, h, region.numboxes, (int)SDL_arraysize(opaque), occluders.numboxes);
+    SDL_Log("  union of the damage rects: %8.2f us", (double)ticks[0] * 1000000.0 / SDL_GetPerformanceFrequency() / repeats);
+    SDL_Log("  ... all at once:           %8.2f us", (double)ticks[5] * 1000000.0 / SDL_GetPerformanceFrequency() / repeats);
+    SDL_Log("  clip to the window:        %8.2f us", (double)ticks[1] * 1000000.0 / SDL_GetPerformanceFrequency() / repeats);
+    SDL_Log("  subtract occluders:        %8.2f us", (double)ticks[2] * 1000000.0 / SDL_GetPerformanceFrequency() / repeats);
+    SDL_Log("  translate:                 %8.2f us", (double)ticks[3] * 1000000.0 / SDL_GetPerformanceFrequency() / repeats);
+    SDL_Log("  simplify to 16 boxes:      %8.2f us", (double)ticks[4] * 1000000.0 / SDL_GetPerformanceFrequency() / repeats);
+    SDL_FreeRegion(&region);
+    SDL_FreeRegion(&occluders);
+    SDL_FreeRegion(&result);
+}
+
+int main(int argc, char *argv[])
+{
+    SDL_bool benchmark = SDL_FALSE;
+    int i, iterations = 10000;
+
+    SDLTest_RandomInitTime(&rndctx);
+    if (SDL_getenv("SDL_TESTS_QUICK") != NULL) {
+        iterations = 1000;
+    }
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+            benchmark = SDL_TRUE;
+        } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            iterations = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--seed") == 0 && argv[i + 1]) {
+            const unsigned int seed = (unsigned int)SDL_strtoul(argv[++i], NULL, 0);
+            SDLTest_RandomInit(&rndctx, seed, 0);
+        } else {
+            SDL_Log("Usage: %s [--iterations N] [--seed N] [--benchmark]", argv[0]);
+            return 1;
+        }
+    }
+    SDL_Log("Using random seed 0x%08x", rndctx.x);
+
+    if (benchmark) {
+        RunBenchmark();
+        return 0;
+    }
+
+    RunFuzzTest(iterations);
+    if (failures > 0) {
+        SDL_Log("%d checks failed in %d iterations", failures, iterations);
+        return 1;
+    }
+    SDL_Log("All %d iterations passed", iterations);
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -38,7 +38,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
 
         /* R, G, B in alternating horizontal bands */
         for (y = 0; y < pattern->h; y += thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && (y + i) < pattern->h; ++i) {
                 p = (Uint8 *)pattern->pixels + (y + i) * pattern->pitch + ((y / thickness) % 3);
                 for (x = 0; x < pattern->w; ++x) {
                     *p = 0xFF;
@@ -50,7 +50,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
         /* Black and white in alternating vertical bands */
         c = 0xFF;
         for (x = 1 * thickness; x < pattern->w; x += 2 * thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && (x + i) < pattern->w; ++i) {
                 p = (Uint8 *)pattern->pixels + (x + i) * 3;
                 for (y = 0; y < pattern->h; ++y) {
                     SDL_memset(p, c, 3);
@@ -211,6 +211,63 @@ done:
     return result;
 }
 
+/* Time YUV to RGB conversion of every YUV format with and without SIMD */
+static void run_benchmark(SDL_Surface *original, Uint32 rgb_format, int iterations)
+{
+    const Uint32 yuv_formats[] = {
+        SDL_PIXELFORMAT_YV12,
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY,
+        SDL_PIXELFORMAT_YVYU,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21,
+    };
+    const char *simd = SDL_HasSSE2() ? "SSE2" : SDL_HasNEON() ? "NEON" : SDL_HasLSX() ? "LSX" : "none";
+    const int w = original->w, h = original->h;
+    Uint8 *yuv = SDL_calloc(1, MAX_YUV_SURFACE_SIZE(w, h, 0));
+    SDL_Surface *converted = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, rgb_format);
+    Uint32 i;
+    int intrinsics, iteration;
+
+    if (yuv == NULL || converted == NULL) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_free(yuv);
+        SDL_FreeSurface(converted);
+        return;
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Converting %dx%d to %s, %d iterations\n", w, h, SDL_GetPixelFormatName(rgb_format), iterations);
+    for (i = 0; i < SDL_arraysize(yuv_formats); ++i) {
+        const Uint32 yuv_format = yuv_formats[i];
+        const int pitch = CalculateYUVPitch(yuv_format, w);
+        double ms[2];
+
+        ConvertRGBtoYUV(yuv_format, original->pixels, original->pitch, yuv, w, h,
+                        SDL_GetYUVConversionModeForResolution(w, h), 0, 100);
+
+        for (intrinsics = 0; intrinsics < 2; ++intrinsics) {
+            Uint64 start;
+
+            SDL_SetHint(SDL_HINT_YUV_INTRINSICS, intrinsics ? "1" : "0");
+            start = SDL_GetPerformanceCounter();
+            for (iteration = 0; iteration < iterations; ++iteration) {
+                SDL_ConvertPixels(w, h, yuv_format, yuv, pitch, rgb_format, converted->pixels, converted->pitch);
+            }
+            ms[intrinsics] = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+        }
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%-22s C: %6.2f ms (%7.1f Mpixels/s), %s: %6.2f ms (%7.1f Mpixels/s), %.2fx\n",
+                    SDL_GetPixelFormatName(yuv_format),
+                    ms[0], (w * h) / (ms[0] * 1000.0),
+                    simd, ms[1], (w * h) / (ms[1] * 1000.0),
+                    ms[0] / ms[1]);
+    }
+    SDL_ResetHint(SDL_HINT_YUV_INTRINSICS);
+
+    SDL_free(yuv);
+    SDL_FreeSurface(converted);
+}
+
 int main(int argc, char **argv)
 {
     struct
@@ -260,6 +317,13 @@ int main(int argc, char **argv)
     Uint8 *raw_yuv;
     Uint32 then, now, i, iterations = 100;
     SDL_bool should_run_automated_tests = SDL_FALSE;
+    SDL_bool should_run_benchmark = SDL_FALSE;
+
+    /* Needed for SDL_HINT_YUV_INTRINSICS to take effect */
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
 
     while (argv[arg] && *argv[arg] == '-') {
         if (SDL_strcmp(argv[arg], "--jpeg") == 0) {
@@ -300,8 +364,10 @@ int main(int argc, char **argv)
             rgb_format = SDL_PIXELFORMAT_BGRA8888;
         } else if (SDL_strcmp(argv[arg], "--automated") == 0) {
             should_run_automated_tests = SDL_TRUE;
+        } else if (SDL_strcmp(argv[arg], "--benchmark") == 0) {
+            should_run_benchmark = SDL_TRUE;
         } else {
-            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Usage: %s [--jpeg|--bt601|-bt709|--auto] [--yv12|--iyuv|--yuy2|--uyvy|--yvyu|--nv12|--nv21] [--rgb555|--rgb565|--rgb24|--argb|--abgr|--rgba|--bgra] [image_filename]\n", argv[0]);
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Usage: %s [--jpeg|--bt601|-bt709|--auto] [--yv12|--iyuv|--yuy2|--uyvy|--yvyu|--nv12|--nv21] [--rgb555|--rgb565|--rgb24|--argb|--abgr|--rgba|--bgra] [--automated|--benchmark] [image_filename]\n", argv[0]);
             return 1;
         }
         ++arg;
@@ -314,6 +380,7 @@ int main(int argc, char **argv)
                         automated_test_params[i].pattern_size,
                         automated_test_params[i].extra_pitch,
                         automated_test_params[i].enable_intrinsics ? "enabled" : "disabled");
+            SDL_SetHint(SDL_HINT_YUV_INTRINSICS, automated_test_params[i].enable_intrinsics ? "1" : "0");
             if (run_automated_tests(automated_test_params[i].pattern_size, automated_test_params[i].extra_pitch) < 0) {
                 return 2;
             }
@@ -332,6 +399,12 @@ int main(int argc, char **argv)
         return 3;
     }
 
+    if (should_run_benchmark) {
+        run_benchmark(original, rgb_format, iterations);
+        SDL_FreeSurface(original);
+        return 0;
+    }
+
     raw_yuv = SDL_calloc(1, MAX_YUV_SURFACE_SIZE(original->w, original->h, 0));
     ConvertRGBtoYUV(yuv_format, original->pixels, original->pitch, raw_yuv, original->w, original->h,
                     SDL_GetYUVConversionModeForResolution(original->w, original->h),